@@ -1,8 +1,11 @@
 #pragma once
 
 #include "data/csv_parser.h"
+#include "data/bar_store.h"
+#include "data/bar_source.h"
 #include "strategy/strategy.h"
 #include "risk/risk_manager.h"
+#include "backtester/execution_simulator.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -12,13 +15,15 @@ namespace TradingBot {
     // Trade record
     struct Trade {
         std::string timestamp;
+        int64_t epoch;                // Bar time as UTC epoch seconds (NO_EPOCH if unknown)
+        std::string symbol;           // Traded symbol in multi-symbol runs, else empty
         std::string action;           // BUY, SELL
         double price;
         double quantity;
         double commission;
         double pnl;
         
-        Trade() : price(0.0), quantity(0.0), commission(0.0), pnl(0.0) {}
+        Trade() : epoch(TimeUtils::NO_EPOCH), price(0.0), quantity(0.0), commission(0.0), pnl(0.0) {}
     };
 
     // Backtest results
@@ -53,10 +58,77 @@ namespace TradingBot {
         std::string start_date;
         std::string end_date;
         bool enable_short_selling;
+        double periods_per_year;       // Bars per year, used to annualize returns and Sharpe
+        bool record_trades;            // Keep every Trade in BacktestResults::trades
+        bool record_equity_curve;      // Keep every equity point in BacktestResults::equity_curve
+        bool use_intrabar_execution;   // Stop-loss/take-profit as resting orders checked against high/low
         
         BacktestConfig() : 
             initial_capital(100000.0), commission_rate(0.001), slippage(0.0001),
-            enable_short_selling(false)
+            enable_short_selling(false), periods_per_year(252.0),
+            record_trades(true), record_equity_curve(true),
+            use_intrabar_execution(false)
+        {}
+    };
+
+    // Single-pass performance statistics. Updated as each equity point and
+    // trade is produced, so the full equity curve and trade list never need
+    // to be stored just to compute the summary metrics.
+    class PerformanceAccumulator {
+    public:
+        PerformanceAccumulator();
+        
+        // Clear all state and start a new run
+        void reset(double initial_capital);
+        
+        // Record the portfolio value at the end of a bar
+        void add_equity_point(double equity);
+        
+        // Record an executed trade (only non-zero pnl counts as win/loss)
+        void add_trade(const Trade& trade);
+        
+        // Write the accumulated metrics into results
+        void finalize(BacktestResults& results, double periods_per_year) const;
+        
+    private:
+        double initial_capital_;
+        double last_equity_;
+        double peak_equity_;
+        double max_drawdown_;
+        size_t equity_points_;
+        
+        // Welford running mean/variance of per-bar returns
+        size_t return_count_;
+        double return_mean_;
+        double return_m2_;
+        
+        int total_trades_;
+        int winning_trades_;
+        int losing_trades_;
+        double gross_profit_;
+        double gross_loss_;
+    };
+
+    // State of a run in progress, threaded through Backtester::process_bar
+    struct BacktestState {
+        PortfolioState portfolio;
+        Position position;
+        uint64_t bracket_group;        // Resting stop-loss/take-profit group (intrabar mode)
+        std::vector<Fill> fills;
+        
+        BacktestState() : bracket_group(0) {}
+    };
+
+    // One strategy's share of a multi-strategy run
+    struct StrategyRun {
+        std::shared_ptr<Strategy> strategy;
+        std::shared_ptr<RiskManager> risk_manager;
+        BacktestConfig config;
+        
+        StrategyRun() {}
+        StrategyRun(std::shared_ptr<Strategy> strategy, std::shared_ptr<RiskManager> risk_manager,
+                    const BacktestConfig& config) :
+            strategy(strategy), risk_manager(risk_manager), config(config)
         {}
     };
 
@@ -64,16 +136,41 @@ namespace TradingBot {
     class Backtester {
     public:
         Backtester();
-        ~Backtester();
+        virtual ~Backtester();
         
         // Initialize backtester
         bool initialize(const BacktestConfig& config);
         
-        // Run backtest with given strategy and data
+        // Run backtest with given strategy and data. Every run starts by
+        // resetting the strategy and risk manager, so the same instances can
+        // be passed to run after run.
         BacktestResults run_backtest(std::shared_ptr<Strategy> strategy,
                                    std::shared_ptr<CSVParser> data_parser,
                                    std::shared_ptr<RiskManager> risk_manager);
         
+        // Run backtest over a compressed history, decoding one block at a time
+        BacktestResults run_backtest(std::shared_ptr<Strategy> strategy,
+                                   const CompressedBarStore& bars,
+                                   std::shared_ptr<RiskManager> risk_manager);
+        
+        // Run backtest pulling bars from a source batch by batch; memory stays
+        // flat apart from the equity curve (see record_equity_curve)
+        BacktestResults run_backtest(std::shared_ptr<Strategy> strategy,
+                                   std::shared_ptr<BarSource> source,
+                                   std::shared_ptr<RiskManager> risk_manager);
+        
+        // Advance several strategies through a single pass over the data. Each
+        // run keeps its own portfolio, configuration and results (returned in
+        // input order) while the bar read and indicator series are shared.
+        // Runs must not share strategy or risk manager instances; groups of
+        // runs advance in parallel on the shared scheduler.
+        std::vector<BacktestResults> run_backtests(const std::vector<StrategyRun>& runs,
+                                                   std::shared_ptr<CSVParser> data_parser);
+        
+        // Same over a bar source (shares the read; indicators are per strategy)
+        std::vector<BacktestResults> run_backtests(const std::vector<StrategyRun>& runs,
+                                                   std::shared_ptr<BarSource> source);
+        
         // Get backtest configuration
         const BacktestConfig& get_config() const;
         
@@ -83,17 +180,43 @@ namespace TradingBot {
         // Get latest results
         const BacktestResults& get_results() const;
         
-    private:
+        // Share indicator series across runs over the same data (null disables)
+        void set_indicator_cache(std::shared_ptr<IndicatorCache> cache);
+        
+    protected:
         BacktestConfig config_;
         BacktestResults results_;
+        PerformanceAccumulator stats_;
+        std::shared_ptr<IndicatorCache> indicator_cache_;
+        ExecutionSimulator execution_;
+        
+        // Per-run steps shared by every driver (historical data, live quotes)
+        void begin_run(BacktestState& state);
+        void process_bar(const MarketData& bar, Strategy& strategy, RiskManager& risk_manager,
+                         BacktestState& state);
+        void end_run();
+        
+        // Backtesters holding each run's state for run_backtests, already begun
+        std::vector<std::unique_ptr<Backtester>> begin_runs(const std::vector<StrategyRun>& runs,
+                                                            std::vector<BacktestState>& states);
+        
+        // Advance every lane through bars[0, count). Lanes are split into
+        // groups run as tasks on the shared scheduler; each group still makes
+        // one pass over the bars.
+        void process_lanes(const std::vector<std::unique_ptr<Backtester>>& lanes,
+                           const std::vector<StrategyRun>& runs, std::vector<BacktestState>& states,
+                           const MarketData* bars, size_t count);
         
         // Internal methods
         void execute_trade(Trade& trade, const TradingSignal& signal, 
                           const MarketData& data, PortfolioState& portfolio);
+        void settle_trade(Trade& trade, SignalType type, const MarketData& data,
+                          Position& position, PortfolioState& portfolio, RiskManager& risk_manager);
+        void settle_fill(const Fill& fill, const MarketData& data, Position& position,
+                         PortfolioState& portfolio, RiskManager& risk_manager);
+        void record_trade(const Trade& trade);
         void update_equity_curve(double current_value);
         void calculate_statistics();
-        double calculate_sharpe_ratio(const std::vector<double>& returns);
-        double calculate_max_drawdown(const std::vector<double>& equity_curve);
     };
 
 } // namespace TradingBot
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "backtester/backtester.h"
+#include "risk/portfolio_risk.h"
+#include "strategy/cross_sectional_strategy.h"
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Closes of a symbol universe on one shared clock, bar-major: the closes
+    // of bar i are closes[i * symbol_count() .. (i + 1) * symbol_count()),
+    // NaN where a symbol has no bar at that time
+    struct UniverseData {
+        std::vector<std::string> symbols;
+        std::vector<int64_t> epochs;
+        std::vector<double> closes;
+
+        size_t bar_count() const { return epochs.size(); }
+        size_t symbol_count() const { return symbols.size(); }
+        const double* bar(size_t index) const { return closes.data() + index * symbols.size(); }
+
+        // Merge per-symbol histories onto the union of their bar times.
+        // Throws std::invalid_argument on a size mismatch or a bar without a time.
+        static UniverseData align(const std::vector<std::string>& symbols,
+                                  const std::vector<const std::vector<MarketData>*>& series);
+    };
+
+    // Backtester for cross-sectional strategies: one portfolio across the
+    // whole universe, rebalanced to equal weights in the strategy's picks.
+    //
+    // Every bar is ranked so indicator state stays current; every
+    // rebalance_period bars the holdings move to equity / top_k per pick, sells
+    // first, then buys out of the cash that frees up. A symbol without a quote
+    // keeps its position and last price until it trades again. Trades carry
+    // their symbol and feed the same statistics as single-symbol backtests.
+    //
+    // With portfolio limits set, every buy is checked against the book in a
+    // PortfolioRiskEngine first (a new day starts at each UTC midnight) and
+    // skipped if it breaches one. The engine's covariance update is O(n^2)
+    // per bar, so leave the limits off for very wide universes.
+    class CrossSectionalBacktester : public Backtester {
+    public:
+        CrossSectionalBacktester();
+        ~CrossSectionalBacktester() override;
+
+        // Rebalance every Nth bar (at least 1)
+        void set_rebalance_period(size_t bars);
+        size_t get_rebalance_period() const;
+
+        // Check buys against book-level limits; false (and unchanged) if the
+        // limits are invalid
+        bool set_portfolio_risk(const PortfolioRiskLimits& limits);
+        void clear_portfolio_risk();
+
+        // Buys the portfolio limits skipped in the last run
+        size_t get_rejected_orders() const;
+
+        // Run a ranking strategy over a universe; the strategy is reset first,
+        // so the same instance can be passed to run after run
+        BacktestResults run_universe_backtest(std::shared_ptr<CrossSectionalStrategy> strategy,
+                                              const UniverseData& universe);
+
+        // Shares held per symbol at the end of the last run
+        const std::vector<double>& get_holdings() const;
+
+    private:
+        size_t rebalance_period_;
+        std::vector<double> holdings_;
+        std::vector<double> avg_cost_;
+        std::vector<double> prices_;           // Last quoted close per symbol
+        std::vector<double> targets_;          // Target shares, scratch for a rebalance
+        std::optional<PortfolioRiskLimits> risk_limits_;
+        PortfolioRiskEngine risk_;             // Book mirror for pre-trade checks, index = symbol
+        std::vector<double> quotes_;           // Scratch for PortfolioRiskEngine::update_prices
+        size_t rejected_orders_;
+
+        void fill(size_t symbol, double quantity, double price, int64_t epoch, PortfolioState& portfolio,
+                  const UniverseData& universe);
+    };
+
+} // namespace TradingBot
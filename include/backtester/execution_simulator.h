@@ -0,0 +1,132 @@
+#pragma once
+
+#include "data/csv_parser.h"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace TradingBot {
+
+    // Order types supported by the simulator
+    enum class OrderType {
+        MARKET,
+        LIMIT,
+        STOP
+    };
+
+    enum class OrderSide {
+        BUY,
+        SELL
+    };
+
+    // Resting or immediate order
+    struct Order {
+        uint64_t id;
+        OrderType type;
+        OrderSide side;
+        double price;                  // Limit price or stop trigger (unused for market)
+        double quantity;
+        uint64_t oco_group;            // Orders sharing a group cancel each other on fill (0 = none)
+        std::string tag;
+
+        Order() : id(0), type(OrderType::MARKET), side(OrderSide::BUY),
+                  price(0.0), quantity(0.0), oco_group(0) {}
+    };
+
+    // Execution of an order
+    struct Fill {
+        uint64_t order_id;
+        OrderType type;
+        OrderSide side;
+        double price;
+        double quantity;
+        std::string timestamp;
+        std::string tag;
+
+        Fill() : order_id(0), type(OrderType::MARKET), side(OrderSide::BUY), price(0.0), quantity(0.0) {}
+    };
+
+    // Bar-level order execution with intrabar trigger evaluation.
+    //
+    // Resting orders are evaluated against each bar's high/low along a
+    // deterministic path: the open first (gaps fill at the open), then
+    // O -> L -> H -> C for up bars and O -> H -> L -> C for down bars.
+    // Orders are kept in price-sorted books, so a bar only touches the
+    // orders it actually triggers (O(log n) per fill).
+    class ExecutionSimulator {
+    public:
+        ExecutionSimulator();
+        ~ExecutionSimulator();
+
+        // Slippage fraction applied to market and stop fills (limits fill at their price)
+        void set_slippage(double slippage);
+
+        // Fill a market order immediately at the given reference price
+        Fill execute_market(OrderSide side, double quantity, double reference_price,
+                            const std::string& timestamp, const std::string& tag = "");
+
+        // Rest a limit or stop order; returns its id
+        uint64_t submit_limit(OrderSide side, double quantity, double limit_price, const std::string& tag = "");
+        uint64_t submit_stop(OrderSide side, double quantity, double stop_price, const std::string& tag = "");
+
+        // Rest an OCO exit bracket (stop-loss + take-profit) for a position.
+        // exit_side is SELL for long positions. Returns the OCO group id.
+        uint64_t submit_bracket(OrderSide exit_side, double quantity,
+                                double stop_price, double take_profit_price);
+
+        // Cancel a resting order; false if it is not resting
+        bool cancel(uint64_t order_id);
+
+        // Cancel every order in an OCO group
+        void cancel_group(uint64_t oco_group);
+
+        // Cancel all resting orders
+        void cancel_all();
+
+        // Evaluate resting orders against a bar; fills are appended to 'fills'
+        void process_bar(const MarketData& bar, std::vector<Fill>& fills);
+
+        // Number of resting orders
+        size_t pending_count() const;
+
+        // Look up a resting order
+        const Order* find_order(uint64_t order_id) const;
+
+    private:
+        // Buy limits and sell stops trigger on falling prices (highest first);
+        // sell limits and buy stops trigger on rising prices (lowest first)
+        using DescendingBook = std::multimap<double, uint64_t, std::greater<double>>;
+        using AscendingBook = std::multimap<double, uint64_t, std::less<double>>;
+
+        struct RestingOrder {
+            Order order;
+            DescendingBook::iterator descending_position;
+            AscendingBook::iterator ascending_position;
+        };
+
+        DescendingBook buy_limits_;
+        DescendingBook sell_stops_;
+        AscendingBook sell_limits_;
+        AscendingBook buy_stops_;
+        std::unordered_map<uint64_t, RestingOrder> orders_;
+        std::unordered_map<uint64_t, std::vector<uint64_t>> oco_groups_;
+        uint64_t next_order_id_;
+        uint64_t next_group_id_;
+        double slippage_;
+
+        uint64_t rest(const Order& order);
+        void remove(uint64_t order_id);
+        void fill(uint64_t order_id, double price, const std::string& timestamp, std::vector<Fill>& fills);
+
+        // Fill everything already through the market at the open
+        void process_open(const MarketData& bar, std::vector<Fill>& fills);
+
+        // Fill orders crossed while price moves from 'from' to 'to'
+        void process_falling(double from, double to, const std::string& timestamp, std::vector<Fill>& fills);
+        void process_rising(double from, double to, const std::string& timestamp, std::vector<Fill>& fills);
+    };
+
+} // namespace TradingBot
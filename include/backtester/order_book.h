@@ -0,0 +1,111 @@
+#pragma once
+
+#include "backtester/execution_simulator.h"
+#include "data/tick_data_parser.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // L2 limit order book for one symbol, rebuilt from replayed quote/trade
+    // events, with simulated strategy orders matched against it.
+    //
+    // Each side is a flat array of displayed sizes indexed by price tick, so a
+    // level update is an indexed store and the best price only moves by a
+    // short scan when the top level empties. Strategy orders are not part of
+    // the displayed depth: a resting order joins the back of its level's
+    // queue, advances as prints at its price consume the queue ahead of it
+    // (and as the level shrinks below its position), and fills partially
+    // from whatever the prints leave over.
+    class OrderBook {
+    public:
+        explicit OrderBook(double tick_size = 0.01);
+        ~OrderBook();
+
+        // Drop all levels and strategy orders
+        void reset();
+
+        double get_tick_size() const;
+
+        // Apply a market event; strategy orders it fills are appended to 'fills'
+        void apply(const BookEvent& event, std::vector<Fill>& fills);
+
+        // Submit a limit order. The marketable part fills immediately against
+        // displayed depth; the remainder rests at the back of its level's queue.
+        // Returns the order id (the order may already be complete).
+        uint64_t submit_limit(OrderSide side, double quantity, double price, int64_t timestamp,
+                              std::vector<Fill>& fills, const std::string& tag = "");
+
+        // Sweep the opposite side; any quantity the book cannot absorb is dropped
+        uint64_t submit_market(OrderSide side, double quantity, int64_t timestamp,
+                               std::vector<Fill>& fills, const std::string& tag = "");
+
+        // Cancel a resting strategy order; false if it is not resting
+        bool cancel(uint64_t order_id);
+
+        // Cancel all resting strategy orders
+        void cancel_all();
+
+        // Top of book (0 when the side is empty)
+        bool has_bid() const;
+        bool has_ask() const;
+        double best_bid() const;
+        double best_ask() const;
+
+        // Displayed size at a price
+        double depth(BookSide side, double price) const;
+
+        // Unfilled quantity of a resting strategy order (0 if complete or cancelled)
+        double remaining(uint64_t order_id) const;
+
+        // Displayed size still ahead of a resting strategy order (-1 if not resting)
+        double queue_ahead(uint64_t order_id) const;
+
+        // Number of resting strategy orders
+        size_t own_order_count() const;
+
+    private:
+        // Displayed depth for one side, indexed by (tick - base)
+        struct Ladder {
+            std::vector<double> depth;
+            int64_t base;
+            int64_t best;              // Best tick; valid only when levels > 0
+            size_t levels;             // Number of non-empty levels
+
+            Ladder() : base(0), best(0), levels(0) {}
+        };
+
+        struct OwnOrder {
+            Order order;
+            int64_t tick;
+            double queue_ahead;
+            double remaining;
+        };
+
+        double tick_size_;
+        Ladder bids_;
+        Ladder asks_;
+        std::vector<OwnOrder> own_orders_;
+        std::vector<size_t> matching_;         // Scratch for on_trade: own orders a print reaches
+        uint64_t next_order_id_;
+
+        int64_t to_tick(double price) const;
+        double to_price(int64_t tick) const;
+
+        // Grow the ladder so that 'tick' is addressable
+        void ensure_tick(Ladder& ladder, int64_t tick);
+
+        double level_depth(const Ladder& ladder, int64_t tick) const;
+        void set_level(Ladder& ladder, bool bid_side, int64_t tick, double quantity);
+
+        // Take displayed liquidity from the opposite side up to a limit tick
+        double sweep(OrderSide side, double quantity, int64_t limit_tick, uint64_t order_id,
+                     OrderType type, int64_t timestamp, const std::string& tag, std::vector<Fill>& fills);
+
+        void on_quote(const BookEvent& event, std::vector<Fill>& fills);
+        void on_trade(const BookEvent& event, std::vector<Fill>& fills);
+        void remove_completed();
+    };
+
+} // namespace TradingBot
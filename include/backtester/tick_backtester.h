@@ -0,0 +1,48 @@
+#pragma once
+
+#include "backtester/backtester.h"
+#include "backtester/order_book.h"
+#include "data/tick_data_parser.h"
+#include <memory>
+
+namespace TradingBot {
+
+    // Tick-level backtest configuration
+    struct TickBacktestConfig {
+        double tick_size;              // Price increment of the replayed symbol
+        bool passive_orders;           // Join the queue at the touch instead of crossing the spread
+        size_t signal_interval;        // Consult the strategy on every Nth trade print
+        int64_t timestamp_units;       // Feed timestamp units per second (1000 = milliseconds)
+
+        TickBacktestConfig() : tick_size(0.01), passive_orders(true), signal_interval(1), timestamp_units(1000) {}
+    };
+
+    // Backtester that replays an L2 quote/trade feed through an OrderBook.
+    //
+    // The strategy sees each trade print as a bar (open = high = low = close =
+    // print price) and its BUY/SELL signals become orders in the book, filled
+    // with queue position and partial fills. Fills are recorded as Trade
+    // records and feed the same statistics as bar backtests. Each print the
+    // strategy sees also updates the risk manager and marks equity.
+    class TickBacktester : public Backtester {
+    public:
+        TickBacktester();
+        ~TickBacktester() override;
+
+        void set_tick_config(const TickBacktestConfig& config);
+        const TickBacktestConfig& get_tick_config() const;
+
+        // Run backtest over a replayed quote/trade feed
+        BacktestResults run_tick_backtest(std::shared_ptr<Strategy> strategy,
+                                          std::shared_ptr<TickDataParser> tick_data,
+                                          std::shared_ptr<RiskManager> risk_manager);
+
+        // Book state at the end of the last run
+        const OrderBook& get_order_book() const;
+
+    private:
+        TickBacktestConfig tick_config_;
+        OrderBook book_;
+    };
+
+} // namespace TradingBot
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "backtester/backtester.h"
+#include "risk/risk_manager.h"
+#include "strategy/strategy.h"
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Input series of a batch
+    struct BatchDataSet {
+        std::string id;                // e.g. the symbol
+        std::string file;
+    };
+
+    // Named set of parameter overrides applied to a job
+    struct BatchOverride {
+        std::string name;
+        std::map<std::string, double> values;
+    };
+
+    // Every combination of data set x strategy x override is one job.
+    //
+    // Manifest file, one directive per line ('#' starts a comment):
+    //   data <id> <csv file>
+    //   strategy <name> [<name> ...]
+    //   override <name> <key>=<value> [<key>=<value> ...]
+    //   output <results csv>
+    //   threads <n>
+    // Override keys naming risk_management or backtesting fields of
+    // config.json go to the risk manager or the backtest config, range-checked
+    // when the manifest is loaded; all others go to the strategy. Without any
+    // override line each pair runs once with defaults.
+    struct BatchManifest {
+        std::vector<BatchDataSet> data_sets;
+        std::vector<std::string> strategies;
+        std::vector<BatchOverride> overrides;
+        std::string output_file;
+        size_t num_threads;            // Jobs run at once (0 = one per scheduler worker)
+
+        BatchManifest() : output_file("batch_results.csv"), num_threads(0) {}
+    };
+
+    // Outcome of one job
+    struct BatchJobResult {
+        std::string data_id;
+        std::string strategy_name;
+        std::string override_name;
+        bool success;
+        std::string error;
+        BacktestResults results;       // Statistics only; trades and equity curve are not kept
+        double elapsed_ms;
+
+        BatchJobResult() : success(false), elapsed_ms(0.0) {}
+    };
+
+    // Runs a manifest's jobs on the shared scheduler. Each distinct data file
+    // is loaded and validated once and shared read-only by all of its jobs,
+    // along with one indicator cache, so repeated indicator series are also
+    // computed once.
+    class BatchRunner {
+    public:
+        using StrategyFactory = std::function<std::unique_ptr<Strategy>(const std::string& strategy_name)>;
+        using ParameterProvider = std::function<std::map<std::string, double>(const std::string& strategy_name)>;
+
+        BatchRunner();
+
+        // Defaults every job starts from
+        bool initialize(const BacktestConfig& config, const RiskParameters& risk_params);
+
+        // Session calendar installed into every job's RiskManager
+        void set_session_calendar(const SessionCalendar& calendar);
+
+        // Parse a manifest file; on failure 'error' names the offending line
+        static bool load_manifest(const std::string& filename, BatchManifest& manifest, std::string& error);
+
+        // Run every job; results come back in manifest order (data, strategy, override).
+        // Factories are called from scheduler threads.
+        std::vector<BatchJobResult> run(const BatchManifest& manifest,
+                                        const StrategyFactory& factory,
+                                        const ParameterProvider& default_parameters);
+
+        // One CSV row per job
+        static bool write_results(const std::vector<BatchJobResult>& results, const std::string& filename);
+
+        // Data files actually loaded by the last run
+        size_t get_data_loads() const;
+
+    private:
+        BacktestConfig config_;
+        RiskParameters risk_params_;
+        SessionCalendar calendar_;
+        size_t data_loads_;
+    };
+
+} // namespace TradingBot
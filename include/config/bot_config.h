@@ -0,0 +1,145 @@
+#pragma once
+
+#include "backtester/backtester.h"
+#include "risk/portfolio_risk.h"
+#include "risk/risk_manager.h"
+#include "utils/json.h"
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TradingBot {
+
+    // "logging" section
+    struct LoggingConfig {
+        std::string log_file;
+        std::string min_level;         // DEBUG, INFO, WARNING or ERROR
+        bool console_output;
+        bool file_output;
+        bool timestamp;
+        double max_file_size_mb;
+
+        LoggingConfig() :
+            log_file("./logs/trading_bot.log"), min_level("INFO"), console_output(true),
+            file_output(true), timestamp(true), max_file_size_mb(10.0)
+        {}
+    };
+
+    // "api.alpha_vantage" section
+    struct AlphaVantageConfig {
+        std::string api_key;
+        bool enabled;
+        int rate_limit_per_minute;
+        int timeout_seconds;
+
+        AlphaVantageConfig() : enabled(true), rate_limit_per_minute(5), timeout_seconds(30) {}
+    };
+
+    // "api.yahoo_finance" section
+    struct YahooFinanceConfig {
+        bool enabled;
+        int timeout_seconds;
+
+        YahooFinanceConfig() : enabled(true), timeout_seconds(30) {}
+    };
+
+    // "api" section
+    struct ApiConfig {
+        std::string default_provider;  // yahoo_finance or alpha_vantage
+        AlphaVantageConfig alpha_vantage;
+        YahooFinanceConfig yahoo_finance;
+        std::string default_symbol;
+        std::string default_interval;
+        bool cache_enabled;
+        bool auto_save_csv;
+        std::string csv_output_directory;
+
+        ApiConfig() :
+            default_provider("yahoo_finance"), default_symbol("AAPL"), default_interval("daily"),
+            cache_enabled(true), auto_save_csv(true), csv_output_directory("./data/api_downloads")
+        {}
+    };
+
+    // "data" section
+    struct DataConfig {
+        std::string timestamp_column;
+        std::string open_column;
+        std::string high_column;
+        std::string low_column;
+        std::string close_column;
+        std::string volume_column;
+        std::string date_format;
+        bool check_missing_values;
+        bool check_price_consistency;
+        double min_volume;
+
+        DataConfig() :
+            timestamp_column("timestamp"), open_column("open"), high_column("high"), low_column("low"),
+            close_column("close"), volume_column("volume"), date_format("%Y-%m-%d %H:%M:%S"),
+            check_missing_values(true), check_price_consistency(true), min_volume(0.0)
+        {}
+    };
+
+    // Typed view of config.json. Anything the file leaves out keeps its default.
+    struct BotConfig {
+        BacktestConfig backtesting;                                    // "backtesting"
+        RiskParameters risk;                                           // "risk_management"
+        SessionHours session;                                          // "session": where trading days split
+        std::vector<std::string> holidays;                             // "session.holidays": closed dates
+        std::optional<PortfolioRiskLimits> portfolio_risk;             // "portfolio_risk": universe run limits, off if absent
+        std::map<std::string, std::map<std::string, double>> strategies; // "strategies": numeric parameters by strategy
+        LoggingConfig logging;                                         // "logging"
+        ApiConfig api;                                                 // "api"
+        DataConfig data;                                               // "data"
+    };
+
+    // Set one backtest or risk field by its config key ("stop_loss_pct",
+    // "initial_capital", ...), range-checked against the same schema the
+    // file is validated with. Batch and optimizer overrides go through these.
+    // False with 'error' set if the value is out of range; false with
+    // 'error' empty if the key is not a field of that struct.
+    bool set_backtest_parameter(BacktestConfig& config, std::string_view key, double value, std::string& error);
+    bool set_risk_parameter(RiskParameters& params, std::string_view key, double value, std::string& error);
+
+    // Loads config.json into a BotConfig. Reloading is cheap when nothing
+    // changed: the file's size and modification time are compared first,
+    // then a hash of its bytes, and only a changed document is parsed. A
+    // document that fails validation never replaces the current config.
+    class ConfigLoader {
+    public:
+        enum class ReloadResult { UNCHANGED, RELOADED, FAILED };
+
+        ConfigLoader();
+
+        // Parse a document over defaults. On failure 'error' names the
+        // offending path, e.g. "risk_management.stop_loss_pct (line 20):
+        // expected a number between 0 and 1".
+        static bool parse(std::string_view text, BotConfig& config, std::string& error);
+
+        // Read and parse a file; 'error' is prefixed with the file name
+        bool load(const std::string& filename, std::string& error);
+
+        // Pick up edits to the last loaded file
+        ReloadResult reload(std::string& error);
+
+        const BotConfig& get() const;
+        const std::string& get_filename() const;
+
+        // Documents actually parsed (loads plus reloads that found a change)
+        size_t get_parse_count() const;
+
+    private:
+        BotConfig config_;
+        std::string filename_;
+        int64_t modified_;             // File time of the last read, in clock ticks
+        uintmax_t size_;
+        uint64_t hash_;
+        size_t parse_count_;
+
+        ReloadResult read(const std::string& filename, bool force, std::string& error);
+    };
+
+} // namespace TradingBot
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "data/bar_source.h"
+#include "data/api_data_fetcher.h"
+#include <cstdint>
+#include <string>
+
+namespace TradingBot {
+
+    // Historical bars fetched from the active provider in date windows, one
+    // request per batch, so a long history is never held in full. Bars a
+    // provider returns outside the requested window, or already emitted by an
+    // earlier window, are dropped. A failed request throws std::runtime_error
+    // from next_batch rather than ending the stream early. The fetcher must
+    // outlive the source.
+    class APIBarSource : public BarSource {
+    public:
+        // Dates are "YYYY-MM-DD"; window_days of 0 fetches the whole range at once
+        APIBarSource(APIDataFetcher& fetcher, const std::string& symbol, DataInterval interval,
+                     const std::string& start_date, const std::string& end_date, int window_days = 30);
+
+        bool next_batch(std::vector<MarketData>& batch) override;
+        bool rewind() override;
+        std::string get_name() const override;
+
+        // Error from the most recent failed request
+        const std::string& get_last_error() const;
+
+    private:
+        APIDataFetcher& fetcher_;
+        std::string symbol_;
+        DataInterval interval_;
+        int64_t start_day_;
+        int64_t end_day_;
+        int window_days_;
+
+        int64_t next_day_;
+        int64_t last_emitted_;
+        bool emitted_any_;
+        std::string last_error_;
+    };
+
+} // namespace TradingBot
@@ -6,9 +6,12 @@
 #include <map>
 #include <memory>
 #include <functional>
+#include <mutex>
 
 namespace TradingBot {
 
+class JournalWriter;
+
 // MarketData is already defined in csv_parser.h
 
 // API response structure
@@ -115,7 +118,7 @@ private:
     std::string make_request(const std::string& url);
     APIResponse parse_csv_response(const std::string& csv_response);
     APIResponse parse_json_chart_response(const std::string& json_response);
-    long long date_to_timestamp(const std::string& date);
+    bool date_to_timestamp(const std::string& date, long long& timestamp);
 };
 
 // Main API Data Fetcher class
@@ -129,6 +132,12 @@ public:
     // Set active provider
     bool set_provider(APIProvider provider);
     
+    // Install a client for a provider (e.g. a recorded-session stand-in)
+    void set_client(APIProvider provider, std::unique_ptr<APIClient> client);
+    
+    // Journal every response from every installed provider
+    void enable_recording(std::shared_ptr<JournalWriter> journal);
+    
     // Fetch data using active provider
     APIResponse fetch_data(
         const std::string& symbol,
@@ -137,6 +146,18 @@ public:
         const std::string& end_date
     );
     
+    // Fetch several symbols concurrently on the shared scheduler, at most
+    // max_concurrent requests at a time (0 = one per worker). Responses come
+    // back in symbol order. The active client must be safe to call from
+    // several threads, as the built-in clients are.
+    std::vector<APIResponse> fetch_many(
+        const std::vector<std::string>& symbols,
+        DataInterval interval,
+        const std::string& start_date,
+        const std::string& end_date,
+        size_t max_concurrent = 0
+    );
+    
     // Fetch latest quote
     APIResponse fetch_quote(const std::string& symbol);
     
@@ -157,10 +178,11 @@ private:
     APIProvider active_provider_;
     bool caching_enabled_;
     
-    // Cache structure: symbol -> interval -> data
+    // Cache structure: symbol|start|end -> interval -> data
     std::map<std::string, std::map<DataInterval, APIResponse>> cache_;
+    mutable std::mutex cache_mutex_;
     
-    // Helper methods
+    // Helper methods (the cache ones expect cache_mutex_ to be held)
     bool is_cached(const std::string& symbol, DataInterval interval) const;
     APIResponse get_cached_data(const std::string& symbol, DataInterval interval) const;
     void cache_data(const std::string& symbol, DataInterval interval, const APIResponse& response);
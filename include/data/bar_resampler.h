@@ -0,0 +1,91 @@
+#pragma once
+
+#include "data/csv_parser.h"
+#include "data/api_data_fetcher.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Short label for an interval ("1m", "15m", "1h", "1d", "1w", "1mo")
+    std::string interval_name(DataInterval interval);
+
+    // Builds bars of one timeframe from finer bars or ticks in time order.
+    //
+    // State is the single bar under construction: a finer bar that starts a
+    // new bucket completes the previous one. Intraday buckets are aligned to
+    // multiples of their length since the epoch, DAILY to UTC midnight,
+    // WEEKLY to Monday and MONTHLY to the first of the month. A bar that
+    // arrives late (for an earlier bucket) is folded into the open bar.
+    class BarAggregator {
+    public:
+        explicit BarAggregator(DataInterval interval);
+
+        DataInterval get_interval() const;
+
+        // Add a finer bar whose start time is 'epoch_seconds'. Returns true and
+        // fills 'completed' when the bar closes the previous bucket.
+        bool add(const MarketData& bar, int64_t epoch_seconds, MarketData& completed);
+
+        // Emit the bar under construction, if any
+        bool flush(MarketData& completed);
+
+        bool has_partial() const;
+        const MarketData& get_partial() const;
+
+        void reset();
+
+        // Start of the bucket containing a time
+        static int64_t bucket_start(DataInterval interval, int64_t epoch_seconds);
+
+    private:
+        DataInterval interval_;
+        int64_t bucket_;
+        bool active_;
+        MarketData current_;
+
+        void start_bucket(const MarketData& bar, int64_t bucket);
+    };
+
+    // Multi-timeframe resampler for one symbol. Each input bar's timestamp is
+    // parsed once and fanned out to every subscribed timeframe.
+    class BarResampler {
+    public:
+        using BarCallback = std::function<void(DataInterval interval, const MarketData& bar)>;
+
+        BarResampler();
+
+        // Receive completed bars of a timeframe; several timeframes may be subscribed
+        void subscribe(DataInterval interval, BarCallback callback);
+
+        // Feed one finer bar; false if its timestamp cannot be parsed
+        bool add_bar(const MarketData& bar);
+
+        // Feed one trade tick
+        bool add_tick(const std::string& timestamp, double price, double volume);
+
+        // Emit every timeframe's bar under construction (end of data)
+        void flush();
+
+        // Bar under construction for a timeframe (nullptr if none)
+        const MarketData* get_partial(DataInterval interval) const;
+
+        // Resample a whole series in one pass; the last bar may be partial
+        static std::vector<MarketData> resample(const std::vector<MarketData>& bars, DataInterval interval);
+
+    private:
+        struct Subscription {
+            BarAggregator aggregator;
+            std::vector<BarCallback> callbacks;
+
+            explicit Subscription(DataInterval interval) : aggregator(interval) {}
+        };
+
+        std::vector<Subscription> subscriptions_;
+        MarketData completed_;
+        MarketData tick_bar_;
+    };
+
+} // namespace TradingBot
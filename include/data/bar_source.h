@@ -0,0 +1,104 @@
+#pragma once
+
+#include "data/csv_parser.h"
+#include "data/bar_store.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace TradingBot {
+
+    // Pull-based source of bars in time order.
+    //
+    // Consumers call next_batch() until it returns false. A batch replaces
+    // the caller's vector contents, so handing the same vector back on every
+    // call lets sources reuse its elements (and their string buffers) and
+    // keeps memory flat however long the history is.
+    class BarSource {
+    public:
+        virtual ~BarSource() = default;
+
+        // Replace 'batch' with the next bars; false (and empty) when exhausted
+        virtual bool next_batch(std::vector<MarketData>& batch) = 0;
+
+        // Start again from the first bar; false if the source cannot
+        virtual bool rewind() = 0;
+
+        // Description for logs and errors
+        virtual std::string get_name() const = 0;
+    };
+
+    // Bars read from a CSV file a batch at a time, parsed exactly as CSVParser does
+    class CSVBarSource : public BarSource {
+    public:
+        explicit CSVBarSource(const std::string& filename, size_t batch_size = 4096);
+
+        bool is_open() const;
+
+        bool next_batch(std::vector<MarketData>& batch) override;
+        bool rewind() override;
+        std::string get_name() const override;
+
+    private:
+        std::string filename_;
+        size_t batch_size_;
+        std::ifstream file_;
+        std::string line_;
+
+        bool open();
+    };
+
+    // Bars decoded from a CompressedBarStore one block at a time
+    class CompressedBarSource : public BarSource {
+    public:
+        explicit CompressedBarSource(std::shared_ptr<const CompressedBarStore> store);
+
+        bool next_batch(std::vector<MarketData>& batch) override;
+        bool rewind() override;
+        std::string get_name() const override;
+
+    private:
+        std::shared_ptr<const CompressedBarStore> store_;
+        size_t block_;
+    };
+
+    // Wraps another source and fills a bounded queue of batches from it on a
+    // background thread, so reading and parsing overlap with the consumer.
+    // At most 'max_batches' batches are buffered; their vectors are recycled.
+    // An exception thrown by the inner source is rethrown from next_batch.
+    class ReadAheadBarSource : public BarSource {
+    public:
+        explicit ReadAheadBarSource(std::shared_ptr<BarSource> inner, size_t max_batches = 4);
+        ~ReadAheadBarSource() override;
+
+        bool next_batch(std::vector<MarketData>& batch) override;
+        bool rewind() override;
+        std::string get_name() const override;
+
+    private:
+        std::shared_ptr<BarSource> inner_;
+        size_t max_batches_;
+
+        std::thread reader_;
+        std::mutex mutex_;
+        std::condition_variable batch_ready_;
+        std::condition_variable slot_free_;
+        std::deque<std::vector<MarketData>> filled_;
+        std::vector<std::vector<MarketData>> free_;
+        bool started_;
+        bool finished_;
+        bool stop_;
+        std::exception_ptr error_;
+
+        void start();
+        void stop();
+        void read_loop();
+    };
+
+} // namespace TradingBot
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "data/csv_parser.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Compressed, column-encoded bar history.
+    //
+    // Bars are appended in time order and sealed into blocks of a fixed number
+    // of bars. Inside a block each column is encoded on its own:
+    //   - timestamps: delta-of-delta, zigzag varints
+    //   - prices: fixed-point (price * price_scale) zigzag varint deltas, open
+    //     against the previous close and high/low/close against the open
+    //   - volume: varint
+    // A block whose prices or volumes are not exact at price_scale falls back
+    // to XOR-with-previous IEEE bits, so decoding is always lossless. Every
+    // block records its minimum and maximum timestamp, so range reads skip
+    // blocks without decoding them, and a Cursor decodes one block at a time.
+    // Timestamps come back as "YYYY-MM-DD" or "YYYY-MM-DD HH:MM:SS".
+    class CompressedBarStore {
+    public:
+        explicit CompressedBarStore(double price_scale = 10000.0, size_t block_size = 1024);
+
+        // Append a bar; false if its timestamp cannot be parsed or goes backwards
+        bool append(const MarketData& bar);
+
+        // Append every bar of a loaded series; false on the first rejected bar
+        bool append_all(const std::vector<MarketData>& bars);
+
+        // Seal the bars not yet in a block (append may continue afterwards)
+        void seal();
+
+        size_t size() const;
+        size_t block_count() const;             // Sealed blocks
+        size_t compressed_bytes() const;        // Encoded size of sealed blocks
+        double get_price_scale() const;
+
+        int64_t first_timestamp() const;        // Epoch seconds (0 if empty)
+        int64_t last_timestamp() const;
+
+        // Decode block 'index' (block_count() is the unsealed tail) into 'out';
+        // throws std::runtime_error if the block's bytes run out mid-bar
+        void decode_block(size_t index, std::vector<MarketData>& out) const;
+
+        // Decode every bar (mostly for tests and small series)
+        std::vector<MarketData> decode_all() const;
+
+        // Decode bars with from <= timestamp <= to, skipping blocks outside the range
+        std::vector<MarketData> decode_range(int64_t from_epoch, int64_t to_epoch) const;
+
+        // Persist to / restore from a file ("TBC1" magic); save seals first.
+        // load rejects a header whose scale, block size or block table is inconsistent.
+        bool save(const std::string& filename);
+        bool load(const std::string& filename);
+
+        void clear();
+
+        // Forward iterator that keeps one decoded block in memory
+        class Cursor {
+        public:
+            explicit Cursor(const CompressedBarStore& store);
+
+            // Next bar, or nullptr at the end; valid until the following call
+            const MarketData* next();
+
+            void rewind();
+
+        private:
+            const CompressedBarStore* store_;
+            size_t block_;
+            size_t position_;
+            std::vector<MarketData> decoded_;
+        };
+
+        Cursor cursor() const;
+
+    private:
+        struct BlockInfo {
+            uint64_t offset;               // Into bytes_
+            uint32_t length;
+            uint32_t count;
+            int64_t min_timestamp;
+            int64_t max_timestamp;
+            uint8_t flags;
+        };
+
+        struct PendingBar {
+            int64_t timestamp;
+            double open;
+            double high;
+            double low;
+            double close;
+            double volume;
+            bool date_only;                // Input was "YYYY-MM-DD"
+        };
+
+        double price_scale_;
+        size_t block_size_;
+        size_t size_;
+        std::vector<uint8_t> bytes_;
+        std::vector<BlockInfo> blocks_;
+        std::vector<PendingBar> pending_;
+
+        bool fits_fixed_point(double value) const;
+        void decode_pending(std::vector<MarketData>& out) const;
+    };
+
+} // namespace TradingBot
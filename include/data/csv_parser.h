@@ -1,5 +1,7 @@
 #pragma once
 
+#include "utils/time_utils.h"
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -10,15 +12,20 @@ namespace TradingBot {
     // Market data structure
     struct MarketData {
         std::string timestamp;
+        int64_t epoch;                 // timestamp as UTC epoch seconds (NO_EPOCH if unread)
         double open;
         double high;
         double low;
         double close;
         double volume;
         
-        MarketData() : open(0.0), high(0.0), low(0.0), close(0.0), volume(0.0) {}
+        MarketData() : epoch(TimeUtils::NO_EPOCH), open(0.0), high(0.0), low(0.0), close(0.0), volume(0.0) {}
     };
 
+    // Epoch of a bar: the loader's value, or read from the timestamp for bars
+    // built by hand. False if neither gives a time.
+    bool get_epoch(const MarketData& bar, int64_t& epoch_seconds);
+
     // CSV Parser class for reading market data
     class CSVParser {
     public:
@@ -28,6 +35,13 @@ namespace TradingBot {
         // Load data from CSV file
         bool load_data(const std::string& filename);
         
+        // Load data from CSV file as up to num_threads tasks on the shared
+        // scheduler (0 = one per worker).
+        // The file is mapped, split into chunks at line boundaries, and the
+        // chunks are parsed concurrently and stitched in order; the result is
+        // identical to load_data.
+        bool load_data_parallel(const std::string& filename, size_t num_threads = 0);
+        
         // Get data at specific index
         const MarketData& get_data(size_t index) const;
         
@@ -37,20 +51,41 @@ namespace TradingBot {
         // Get data range
         std::vector<MarketData> get_data_range(size_t start, size_t end) const;
         
-        // Validate data integrity
+        // Get all loaded data
+        const std::vector<MarketData>& get_all_data() const;
+        
+        // Get the file the data was loaded from (empty if none)
+        const std::string& get_source() const;
+        
+        // Changes on every load or clear and is never reused, even by another
+        // parser, so (source, generation) names one loaded data set
+        uint64_t get_generation() const;
+        
+        // Validate data integrity (large series are checked in parallel chunks)
         bool validate_data() const;
         
         // Clear loaded data
         void clear();
         
+        // Parse one CSV row (no newline) into 'data'; shared by every loader
+        // so they agree field for field
+        static void parse_fields(const char* begin, const char* end, MarketData& data);
+        
     private:
         std::vector<MarketData> data_;
+        std::string source_;
+        uint64_t generation_;
         
         // Parse single line of CSV
         MarketData parse_line(const std::string& line);
         
         // Convert string to double with error handling
         double parse_double(const std::string& str);
+        
+        static double parse_double(const char* begin, const char* end);
+        
+        // Check rows [begin, end)
+        bool validate_range(size_t begin, size_t end) const;
     };
 
 
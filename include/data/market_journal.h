@@ -0,0 +1,151 @@
+#pragma once
+
+#include "data/api_data_fetcher.h"
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace TradingBot {
+
+    enum class JournalRecordType : uint8_t {
+        HISTORICAL_RESPONSE = 1,       // APIResponse from fetch_historical_data
+        QUOTE_RESPONSE = 2,            // APIResponse from fetch_latest_quote
+        QUOTE = 3                      // Single quote as consumed by the decision path
+    };
+
+    // One journal entry
+    struct JournalRecord {
+        JournalRecordType type;
+        int64_t captured_ns;           // Wall-clock capture time, ns since the Unix epoch
+        std::string symbol;
+        APIResponse response;          // HISTORICAL_RESPONSE / QUOTE_RESPONSE
+        MarketData quote;              // QUOTE
+
+        JournalRecord() : type(JournalRecordType::QUOTE), captured_ns(0) {}
+    };
+
+    // Append-only binary journal of market data sessions.
+    //
+    // File layout: "TBJ2" magic, then records of
+    //   u32 length | u8 type | i64 captured_ns | payload
+    // with strings as varint length + bytes and doubles as their raw IEEE
+    // bits (little-endian), so replayed values are bit-identical to what was
+    // recorded. Bars carry their epoch as well as the display timestamp, since
+    // a date-only string cannot give back an intraday time. Appends are serialized by a mutex, so recorders on several
+    // threads may share one writer.
+    class JournalWriter {
+    public:
+        JournalWriter();
+        ~JournalWriter();
+
+        // Open (creating or appending to) a journal file
+        bool open(const std::string& filename);
+        void close();
+        bool is_open() const;
+
+        // Append a record; captured_ns of 0 stamps the current time
+        bool record_response(JournalRecordType type, const std::string& symbol,
+                             const APIResponse& response, int64_t captured_ns = 0);
+        bool record_quote(const std::string& symbol, const MarketData& quote, int64_t captured_ns = 0);
+
+        void flush();
+
+        size_t get_records_written() const;
+
+    private:
+        std::ofstream file_;
+        std::string buffer_;
+        size_t records_written_;
+        mutable std::mutex mutex_;
+
+        bool append(JournalRecordType type, int64_t captured_ns);
+    };
+
+    // Sequential journal reader. A record cut short by a crash mid-append
+    // ends the journal rather than failing it.
+    class JournalReader {
+    public:
+        JournalReader();
+        ~JournalReader();
+
+        bool open(const std::string& filename);
+        void close();
+
+        // Read the next record; false at end of journal
+        bool next(JournalRecord& record);
+
+        // True if the journal ended in a partial or corrupt record
+        bool is_truncated() const;
+
+    private:
+        std::ifstream file_;
+        std::string buffer_;
+        bool truncated_;
+    };
+
+    // APIClient decorator that journals every response from the wrapped client
+    class RecordingAPIClient : public APIClient {
+    public:
+        RecordingAPIClient(std::unique_ptr<APIClient> client, std::shared_ptr<JournalWriter> journal);
+
+        APIResponse fetch_historical_data(
+            const std::string& symbol,
+            DataInterval interval,
+            const std::string& start_date,
+            const std::string& end_date
+        ) override;
+
+        APIResponse fetch_latest_quote(const std::string& symbol) override;
+
+        std::string get_provider_name() const override;
+
+        bool validate_api_key() override;
+
+    private:
+        std::unique_ptr<APIClient> client_;
+        std::shared_ptr<JournalWriter> journal_;
+    };
+
+    // Offline stand-in provider serving a recorded session. Each symbol's
+    // historical and quote responses are returned in recorded order; the
+    // journal does not keep request arguments, so a replay must make the
+    // same requests in the same order as the recording. Safe to call from
+    // several threads.
+    class JournalAPIClient : public APIClient {
+    public:
+        JournalAPIClient();
+
+        // Load all responses from a journal; false if it cannot be read
+        bool load(const std::string& filename);
+
+        APIResponse fetch_historical_data(
+            const std::string& symbol,
+            DataInterval interval,
+            const std::string& start_date,
+            const std::string& end_date
+        ) override;
+
+        APIResponse fetch_latest_quote(const std::string& symbol) override;
+
+        std::string get_provider_name() const override { return "Journal"; }
+
+        bool validate_api_key() override { return true; }
+
+    private:
+        struct ResponseQueue {
+            std::vector<APIResponse> responses;
+            size_t next;
+
+            ResponseQueue() : next(0) {}
+        };
+
+        std::map<std::string, ResponseQueue> historical_;
+        std::map<std::string, ResponseQueue> quotes_;
+        std::mutex mutex_;             // Guards the queues' read positions
+
+        APIResponse take(std::map<std::string, ResponseQueue>& queues, const std::string& symbol);
+    };
+
+} // namespace TradingBot
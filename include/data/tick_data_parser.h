@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    enum class BookSide {
+        BID,
+        ASK
+    };
+
+    enum class BookEventType {
+        QUOTE,      // L2 level update: size at (side, price) becomes quantity (0 removes the level)
+        TRADE       // Print at price; side is the resting side that was hit
+    };
+
+    // Single L2 book event
+    struct BookEvent {
+        int64_t timestamp;            // Exchange time, integer epoch units of the feed
+        BookEventType type;
+        BookSide side;
+        double price;
+        double quantity;
+
+        BookEvent() : timestamp(0), type(BookEventType::QUOTE), side(BookSide::BID),
+                      price(0.0), quantity(0.0) {}
+    };
+
+    // Reader for replayed quote/trade files.
+    //
+    // Format (one header line, then one event per line):
+    //   timestamp,type,side,price,quantity
+    //   1672650000000,Q,B,100.25,300
+    //   1672650000004,T,A,100.26,100
+    // type is Q (quote) or T (trade); side is B (bid) or A (ask).
+    class TickDataParser {
+    public:
+        TickDataParser();
+        ~TickDataParser();
+
+        // Load events from file; false if the file is missing or has no valid events
+        bool load_data(const std::string& filename);
+
+        // Get event at specific index
+        const BookEvent& get_event(size_t index) const;
+
+        // Get total number of events
+        size_t get_event_count() const;
+
+        // Get all loaded events
+        const std::vector<BookEvent>& get_all_events() const;
+
+        // Append an event (for generated or in-memory feeds)
+        void add_event(const BookEvent& event);
+
+        // Clear loaded events
+        void clear();
+
+    private:
+        std::vector<BookEvent> events_;
+
+        // Parse single line; false if malformed
+        bool parse_line(const char* begin, const char* end, BookEvent& event) const;
+    };
+
+} // namespace TradingBot
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "live/quote_feed.h"
+#include "data/api_data_fetcher.h"
+#include <string>
+
+namespace TradingBot {
+
+    // Live quotes from APIDataFetcher::fetch_quote on the active provider.
+    // The fetcher must outlive the feed.
+    class APIQuoteFeed : public QuoteFeed {
+    public:
+        explicit APIQuoteFeed(APIDataFetcher& fetcher);
+
+        bool poll(const std::string& symbol, MarketData& quote) override;
+
+        // Error from the most recent failed request
+        const std::string& get_last_error() const;
+
+    private:
+        APIDataFetcher& fetcher_;
+        std::string last_error_;
+    };
+
+} // namespace TradingBot
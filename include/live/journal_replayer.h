@@ -0,0 +1,50 @@
+#pragma once
+
+#include "backtester/backtester.h"
+#include "data/market_journal.h"
+#include "utils/latency_histogram.h"
+#include <memory>
+#include <string>
+
+namespace TradingBot {
+
+    // Feeds the quotes of a recorded session back through the backtest
+    // decision step (Strategy -> RiskManager -> execution) on one thread, so
+    // a journal written by PaperTrader reproduces its decisions exactly.
+    // Only QUOTE records are replayed; recorded API responses are served by
+    // JournalAPIClient instead.
+    class JournalReplayer : public Backtester {
+    public:
+        JournalReplayer();
+        ~JournalReplayer() override;
+
+        // 1 = original pace, N = N times faster, 0 = as fast as possible
+        void set_speed(double speed);
+        double get_speed() const;
+
+        // Only replay quotes for this symbol (empty = all)
+        void set_symbol(const std::string& symbol);
+
+        // Replay a journal; throws if it cannot be opened. The strategy and
+        // risk manager are reset first, so reused instances replay identically.
+        BacktestResults replay(const std::string& journal_file,
+                               std::shared_ptr<Strategy> strategy,
+                               std::shared_ptr<RiskManager> risk_manager);
+
+        size_t get_quotes_replayed() const;
+
+        // True if the last journal ended in a partially written record
+        bool was_truncated() const;
+
+        // Time spent deciding each replayed quote
+        const LatencyHistogram& get_latency_histogram() const;
+
+    private:
+        double speed_;
+        std::string symbol_;
+        size_t quotes_replayed_;
+        bool truncated_;
+        LatencyHistogram latency_;
+    };
+
+} // namespace TradingBot
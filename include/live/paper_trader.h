@@ -0,0 +1,110 @@
+#pragma once
+
+#include "backtester/backtester.h"
+#include "data/market_journal.h"
+#include "live/quote_feed.h"
+#include "utils/latency_histogram.h"
+#include "utils/spsc_queue.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace TradingBot {
+
+    // Paper trading configuration
+    struct PaperTradingConfig {
+        std::string symbol;
+        int poll_interval_ms;          // Time between quote polls (0 = as fast as the feed answers)
+        size_t queue_capacity;         // Quotes buffered between ingestion and decision threads
+        int decision_cpu;              // Core to pin the decision thread to (-1 = no pinning)
+        size_t max_quotes;             // Stop after this many quotes (0 = until stopped or feed ends)
+        bool skip_unchanged_quotes;    // Drop polls that return the same quote as the last one
+
+        PaperTradingConfig() :
+            symbol("AAPL"), poll_interval_ms(1000), queue_capacity(1024),
+            decision_cpu(-1), max_quotes(0), skip_unchanged_quotes(true)
+        {}
+    };
+
+    // Live paper-trading loop.
+    //
+    // An ingestion thread polls a QuoteFeed on a fixed schedule and hands
+    // timestamped quotes to a decision thread through a lock-free SPSC queue;
+    // if the decision side falls behind, new quotes are dropped (and counted)
+    // rather than stalling ingestion. The decision thread, optionally pinned
+    // to a core, runs each quote through the same Strategy -> RiskManager ->
+    // execution step as a backtest, so simulated fills and statistics are
+    // recorded in the usual BacktestResults. Tick-to-decision latency (quote
+    // received to decision made) is kept in a histogram. With a journal set,
+    // every decided quote is recorded so JournalReplayer can reproduce the
+    // session offline.
+    class PaperTrader : public Backtester {
+    public:
+        PaperTrader();
+        ~PaperTrader() override;
+
+        void set_paper_config(const PaperTradingConfig& config);
+        const PaperTradingConfig& get_paper_config() const;
+
+        // Record every decided quote to a journal (null disables)
+        void set_journal(std::shared_ptr<JournalWriter> journal);
+
+        // Start both threads; false if already running or given a null component.
+        // The strategy and risk manager are reset when the session starts.
+        bool start(std::shared_ptr<Strategy> strategy,
+                   std::shared_ptr<QuoteFeed> feed,
+                   std::shared_ptr<RiskManager> risk_manager);
+
+        // Ask the loop to stop; queued quotes are still decided
+        void stop();
+
+        // Wait for the loop to finish and return the session results
+        const BacktestResults& wait();
+
+        bool is_running() const;
+
+        // Session counters (final after wait())
+        size_t get_quotes_received() const;
+        size_t get_quotes_dropped() const;
+        size_t get_decisions() const;
+        bool is_decision_thread_pinned() const;
+
+        // Tick-to-decision latency (valid after wait())
+        const LatencyHistogram& get_latency_histogram() const;
+
+    private:
+        struct QuoteEvent {
+            MarketData quote;
+            int64_t received_ns;       // Steady clock, for latency
+            int64_t received_wall_ns;  // Wall clock, for the journal
+
+            QuoteEvent() : received_ns(0), received_wall_ns(0) {}
+        };
+
+        PaperTradingConfig paper_config_;
+        std::shared_ptr<Strategy> strategy_;
+        std::shared_ptr<QuoteFeed> feed_;
+        std::shared_ptr<RiskManager> risk_manager_;
+        std::shared_ptr<JournalWriter> journal_;
+
+        std::unique_ptr<SPSCQueue<QuoteEvent>> queue_;
+        std::thread ingest_thread_;
+        std::thread decision_thread_;
+        std::atomic<bool> running_;
+        std::atomic<bool> stop_requested_;
+        std::atomic<bool> ingest_done_;
+        std::atomic<size_t> quotes_received_;
+        std::atomic<size_t> quotes_dropped_;
+        std::atomic<size_t> decisions_;
+        std::atomic<bool> pinned_;
+
+        BacktestState state_;
+        LatencyHistogram latency_;
+
+        void ingest_loop();
+        void decision_loop();
+    };
+
+} // namespace TradingBot
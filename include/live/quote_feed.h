@@ -0,0 +1,36 @@
+#pragma once
+
+#include "data/csv_parser.h"
+#include <memory>
+#include <string>
+
+namespace TradingBot {
+
+    // Source of live quotes for paper trading. poll() is called from a single
+    // ingestion thread on the paper trader's schedule.
+    class QuoteFeed {
+    public:
+        virtual ~QuoteFeed() = default;
+
+        // Fetch the latest quote for a symbol; false if none is available right now
+        virtual bool poll(const std::string& symbol, MarketData& quote) = 0;
+
+        // True once the feed will never produce another quote
+        virtual bool exhausted() const { return false; }
+    };
+
+    // Replays stored bars one per poll, standing in for a live provider.
+    // The data is one symbol's series, returned whatever symbol is polled.
+    class ReplayQuoteFeed : public QuoteFeed {
+    public:
+        explicit ReplayQuoteFeed(std::shared_ptr<CSVParser> data);
+
+        bool poll(const std::string& symbol, MarketData& quote) override;
+        bool exhausted() const override;
+
+    private:
+        std::shared_ptr<CSVParser> data_;
+        size_t next_index_;
+    };
+
+} // namespace TradingBot
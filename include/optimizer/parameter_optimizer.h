@@ -0,0 +1,153 @@
+#pragma once
+
+#include "backtester/backtester.h"
+#include "data/csv_parser.h"
+#include "risk/risk_manager.h"
+#include "strategy/strategy.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // One searchable dimension of the parameter space
+    struct ParameterRange {
+        std::string name;
+        double min_value;
+        double max_value;
+        double step;                   // Grid step (1 for periods); 0 = continuous
+
+        ParameterRange() : min_value(0.0), max_value(0.0), step(0.0) {}
+        ParameterRange(const std::string& param_name, double min_val, double max_val, double step_size)
+            : name(param_name), min_value(min_val), max_value(max_val), step(step_size) {}
+    };
+
+    // Metric the optimizer maximizes
+    enum class OptimizationObjective {
+        SHARPE_RATIO,
+        TOTAL_RETURN,
+        PROFIT_FACTOR
+    };
+
+    // Genetic search configuration and budget
+    struct OptimizerConfig {
+        size_t population_size;
+        size_t elite_count;            // Best individuals copied unchanged into the next generation
+        size_t tournament_size;
+        double crossover_rate;
+        double mutation_rate;          // Per-parameter mutation probability
+        size_t max_generations;
+        size_t max_evaluations;        // Backtest budget (memoized points are free)
+        double time_budget_seconds;    // 0 = no time limit
+        size_t num_threads;            // Concurrent evaluations on the shared scheduler (0 = one per worker)
+        unsigned int seed;
+        OptimizationObjective objective;
+
+        OptimizerConfig() :
+            population_size(24), elite_count(2), tournament_size(3),
+            crossover_rate(0.9), mutation_rate(0.2), max_generations(50),
+            max_evaluations(500), time_budget_seconds(0.0), num_threads(0),
+            seed(42), objective(OptimizationObjective::SHARPE_RATIO)
+        {}
+    };
+
+    // Best configuration found by an optimization run
+    struct OptimizationResult {
+        std::map<std::string, double> best_parameters;
+        double best_score;
+        BacktestResults best_results;
+        size_t evaluations;            // Backtests actually run
+        size_t cache_hits;             // Candidates answered from the memo table
+        size_t generations;
+
+        OptimizationResult() : best_score(0.0), evaluations(0), cache_hits(0), generations(0) {}
+    };
+
+    // Genetic optimizer over strategy and risk parameters.
+    // Parameter names matching risk_management fields of config.json
+    // (stop_loss_pct, take_profit_pct, max_position_size, max_drawdown,
+    // max_daily_loss, position_sizing_atr, atr_period) are applied to the
+    // RiskManager; all others go to the strategy.
+    class ParameterOptimizer {
+    public:
+        using StrategyFactory = std::function<std::unique_ptr<Strategy>()>;
+
+        ParameterOptimizer();
+        ~ParameterOptimizer();
+
+        // Initialize with search configuration
+        bool initialize(const OptimizerConfig& config);
+
+        // Add a parameter to the search space
+        void add_parameter(const ParameterRange& range);
+
+        // Get search space
+        const std::vector<ParameterRange>& get_parameters() const;
+        
+        // Indicator cache shared by all candidate backtests (one is created if unset)
+        void set_indicator_cache(std::shared_ptr<IndicatorCache> cache);
+
+        // Session calendar installed into every candidate's RiskManager
+        void set_session_calendar(const SessionCalendar& calendar);
+
+        // Run the search; data is shared read-only between worker threads
+        OptimizationResult optimize(const StrategyFactory& factory,
+                                    std::shared_ptr<CSVParser> data,
+                                    const BacktestConfig& backtest_config,
+                                    const RiskParameters& base_risk_params);
+
+    private:
+        using Genome = std::vector<double>;
+
+        struct Evaluation {
+            bool valid;
+            double score;
+            BacktestResults results;
+
+            Evaluation() : valid(false), score(0.0) {}
+        };
+
+        OptimizerConfig config_;
+        std::vector<ParameterRange> ranges_;
+        std::mt19937 rng_;
+        std::shared_ptr<IndicatorCache> indicator_cache_;
+        SessionCalendar calendar_;
+
+        // Memo table of already evaluated (snapped) genomes
+        std::map<Genome, Evaluation> evaluated_;
+
+        // Genetic operators
+        Genome random_genome();
+        Genome crossover(const Genome& a, const Genome& b);
+        void mutate(Genome& genome);
+        const Genome& tournament_select(const std::vector<Genome>& population);
+        void snap(Genome& genome) const;
+
+        // Constraint checks via Strategy::validate_parameters and RiskManager::initialize
+        bool is_valid(const Genome& genome, const StrategyFactory& factory,
+                      const RiskParameters& base_risk_params) const;
+        Genome valid_offspring(const std::vector<Genome>& population, const StrategyFactory& factory,
+                               const RiskParameters& base_risk_params);
+
+        // Route genes to strategy or risk parameters; false if a risk value is out of range
+        bool split_parameters(const Genome& genome, std::map<std::string, double>& strategy_params,
+                              RiskParameters& risk_params) const;
+        std::map<std::string, double> to_map(const Genome& genome) const;
+
+        // Evaluate all unseen genomes in parallel
+        void evaluate_batch(const std::vector<Genome>& genomes, const StrategyFactory& factory,
+                            std::shared_ptr<CSVParser> data, const BacktestConfig& backtest_config,
+                            const RiskParameters& base_risk_params,
+                            std::chrono::steady_clock::time_point deadline,
+                            OptimizationResult& result);
+        Evaluation evaluate(const Genome& genome, const StrategyFactory& factory,
+                            std::shared_ptr<CSVParser> data, const BacktestConfig& backtest_config,
+                            const RiskParameters& base_risk_params) const;
+        double score(const BacktestResults& results) const;
+    };
+
+} // namespace TradingBot
@@ -1,4 +1,5 @@
 #pragma once
+#include <map>
 #include <string>
 #include "backtester/backtester.h"
 
@@ -17,6 +18,11 @@ namespace TradingBot {
         // Generate CSV report
         bool generate_csv_report(const BacktestResults& results, const std::string& output_file);
         
+        // Write an HTML and a CSV report per named result (<prefix><name>.html/.csv)
+        // as tasks on the shared scheduler; returns the number of files written
+        size_t generate_reports(const std::map<std::string, BacktestResults>& results,
+                                const std::string& output_prefix);
+        
         // Generate basic text summary
         std::string generate_summary(const BacktestResults& results);
     };
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace TradingBot {
+
+    // Book-level limits, all relative to current equity
+    struct PortfolioRiskLimits {
+        double max_gross_exposure;     // Sum of |position value|
+        double max_net_exposure;       // |Sum of position values|
+        double max_concentration;      // Largest single |position value|
+        double max_daily_loss;         // Loss since start_day(), as a fraction of that day's opening equity
+        double max_var;                // One-bar parametric value at risk
+        double var_confidence;         // One-sided VaR confidence (0.99 = 99%)
+        double covariance_decay;       // EWMA decay per bar (RiskMetrics uses 0.94 on daily bars)
+        size_t var_warmup_bars;        // Bars of returns before VaR is enforced
+
+        PortfolioRiskLimits() :
+            max_gross_exposure(1.0),
+            max_net_exposure(1.0),
+            max_concentration(0.25),
+            max_daily_loss(0.05),
+            max_var(0.05),
+            var_confidence(0.99),
+            covariance_decay(0.94),
+            var_warmup_bars(20)
+        {}
+    };
+
+    // Outcome of a pre-trade check; anything but ACCEPTED names the limit hit
+    enum class RiskCheckResult {
+        ACCEPTED,
+        GROSS_EXPOSURE,
+        NET_EXPOSURE,
+        CONCENTRATION,
+        DAILY_LOSS,
+        VALUE_AT_RISK,
+        NO_PRICE                       // The symbol has never been quoted
+    };
+
+    std::string risk_check_name(RiskCheckResult result);
+
+    // Pre-trade risk for a multi-asset book.
+    //
+    // Symbols are registered once and addressed by index afterwards; prices,
+    // positions, exposures and the return covariance live in flat arrays.
+    // Each bar folds the return vector into an exponentially weighted
+    // covariance with a rank-1 update, and the same pass caches
+    // Sigma * exposure. A pre-trade check then needs only the traded
+    // symbol's row entries: the VaR after changing one position by d is
+    // V + 2 d (Sigma e)_i + d^2 Sigma_ii, so every check is O(1) whatever
+    // the size of the book. Fills update the cache in O(n).
+    class PortfolioRiskEngine {
+    public:
+        static const size_t npos = static_cast<size_t>(-1);
+
+        PortfolioRiskEngine();
+        ~PortfolioRiskEngine();
+
+        // Set limits and starting cash; clears positions, prices and history
+        bool initialize(const PortfolioRiskLimits& limits, double cash);
+
+        // Register a symbol (idempotent) and return its index
+        size_t add_symbol(const std::string& symbol);
+
+        // Index of a registered symbol, or npos
+        size_t find_symbol(const std::string& symbol) const;
+
+        size_t symbol_count() const;
+
+        // Close of every symbol for the next bar, by index. Non-positive
+        // entries mean no quote: the last price stands and the return is 0.
+        void update_prices(const std::vector<double>& closes);
+
+        // Would a signed order (buy > 0) at the current price breach a
+        // limit? Orders that only shrink a position are always accepted;
+        // anything else on a symbol without a mark yet is NO_PRICE.
+        RiskCheckResult check_order(size_t symbol, double quantity) const;
+
+        // Book an executed trade (signed quantity)
+        void apply_fill(size_t symbol, double quantity, double price);
+
+        // Mark the start of a trading day for the daily loss limit
+        void start_day();
+
+        double get_equity() const;
+        double get_gross_exposure() const;
+        double get_net_exposure() const;
+        double get_position(size_t symbol) const;
+        double get_price(size_t symbol) const;
+
+        // One-bar parametric VaR of the book in currency
+        double get_value_at_risk() const;
+
+        // Current return covariance of two symbols
+        double get_covariance(size_t a, size_t b) const;
+
+        const PortfolioRiskLimits& get_limits() const;
+
+    private:
+        PortfolioRiskLimits limits_;
+        double z_score_;
+        double cash_;
+        double day_start_equity_;
+        size_t bars_;
+
+        std::unordered_map<std::string, size_t> index_;
+        std::vector<double> positions_;
+        std::vector<double> prices_;
+        std::vector<double> exposures_;      // position x price
+        std::vector<double> returns_;        // Scratch for update_prices
+        std::vector<double> covariance_;     // Row-major n x n
+        std::vector<double> sigma_exposure_; // covariance x exposures
+        double gross_;
+        double net_;
+        double variance_;                    // exposures' x covariance x exposures
+    };
+
+} // namespace TradingBot
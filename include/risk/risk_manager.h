@@ -1,6 +1,8 @@
 #pragma once
 
 #include "strategy/strategy.h"
+#include "utils/rolling_stats.h"
+#include "utils/session_calendar.h"
 #include <string>
 #include <vector>
 
@@ -13,7 +15,8 @@ namespace TradingBot {
         double stop_loss_pct;          // Stop loss percentage
         double take_profit_pct;        // Take profit percentage
         double max_daily_loss;         // Maximum daily loss
-        double position_sizing_atr;    // Position sizing based on ATR
+        double position_sizing_atr;    // Position sizing based on ATR (0 sizes by price alone)
+        int atr_period;                // Bars in the ATR and return volatility windows
         
         RiskParameters() : 
             max_position_size(0.02),   // 2% max position size
@@ -21,10 +24,38 @@ namespace TradingBot {
             stop_loss_pct(0.05),       // 5% stop loss
             take_profit_pct(0.10),     // 10% take profit
             max_daily_loss(0.05),      // 5% max daily loss
-            position_sizing_atr(2.0)   // 2x ATR for position sizing
+            position_sizing_atr(2.0),  // 2x ATR for position sizing
+            atr_period(14)             // 14-bar ATR
         {}
     };
 
+    // Streaming volatility over the last 'period' bars, O(1) per bar: the
+    // average true range (as calculate_atr) and the standard deviation of
+    // close-to-close returns
+    class VolatilityTracker {
+    public:
+        explicit VolatilityTracker(int period = 14);
+        
+        // Forget every bar and start over with a new window
+        void reset(int period);
+        
+        // Add the next bar
+        void update(const MarketData& bar);
+        
+        // True once a full window of true ranges has been seen
+        bool is_ready() const;
+        
+        double get_atr() const;
+        double get_return_stdev() const;
+        int get_period() const;
+        
+    private:
+        RollingStats true_ranges_;
+        RollingStats returns_;
+        double prev_close_;
+        bool has_prev_;
+    };
+
     // Portfolio state
     struct PortfolioState {
         double cash;
@@ -33,6 +64,7 @@ namespace TradingBot {
         double realized_pnl;
         double max_drawdown;
         double current_drawdown;
+        double day_start_value;        // Value when the current trading day began (0 = not yet known)
         
         PortfolioState() : 
             cash(100000.0),           // Start with $100k
@@ -40,7 +72,8 @@ namespace TradingBot {
             unrealized_pnl(0.0),
             realized_pnl(0.0),
             max_drawdown(0.0),
-            current_drawdown(0.0)
+            current_drawdown(0.0),
+            day_start_value(0.0)
         {}
     };
 
@@ -53,10 +86,30 @@ namespace TradingBot {
         // Initialize with risk parameters
         bool initialize(const RiskParameters& params);
         
+        // Start a new run: clears the drawdown peak, the volatility windows
+        // (keeping their buffers) and the current trading day. Parameters
+        // and the session calendar are kept. The backtester calls this at
+        // the start of each run.
+        void reset();
+        
+        // Independent copy with the same parameters, calendar and state
+        std::unique_ptr<RiskManager> clone() const;
+        
         // Check if trade is allowed
         bool validate_trade(const TradingSignal& signal, const PortfolioState& portfolio);
         
-        // Calculate position size based on risk
+        // Feed the next bar to the volatility trackers and roll the trading
+        // day: the first bar of a session (per the calendar's table, so
+        // weekend and holiday bars join the next session) records the
+        // portfolio's value as it opens. The backtester calls this once per
+        // bar, before trading, so sizing never needs the history.
+        void update_market_data(const MarketData& bar, PortfolioState& portfolio);
+        
+        // Calculate position size based on risk. Once a full ATR window has
+        // been seen (and position_sizing_atr > 0) the size is the number of
+        // shares whose loss over position_sizing_atr x ATR equals
+        // max_position_size of the portfolio; before that, max_position_size
+        // of the portfolio by value. Either way capped at 10% of the portfolio.
         double calculate_position_size(const TradingSignal& signal, 
                                     const PortfolioState& portfolio,
                                     const MarketData& current_data);
@@ -71,13 +124,21 @@ namespace TradingBot {
                                  const MarketData& current_data,
                                  const PortfolioState& portfolio);
         
+        // Exchange hours and holidays deciding where trading days split
+        void set_session_calendar(const SessionCalendar& calendar);
+        const SessionCalendar& get_session_calendar() const;
+        
         // Get risk parameters
         const RiskParameters& get_risk_parameters() const;
         
         // Set risk parameters
         void set_risk_parameters(const RiskParameters& params);
         
-        // Calculate ATR (Average True Range)
+        // Current streaming volatility
+        const VolatilityTracker& get_volatility() const;
+        
+        // Calculate ATR (Average True Range) over the last 'period' bars of
+        // data, computed by IndicatorKernels
         double calculate_atr(const std::vector<MarketData>& data, int period);
         
         // Calculate drawdown
@@ -85,6 +146,15 @@ namespace TradingBot {
         
     private:
         RiskParameters risk_params_;
+        double peak_value_;            // Highest portfolio value seen by update_portfolio_state
+        VolatilityTracker volatility_;
+        SessionCalendar calendar_;
+        int64_t day_begin_;            // Current calendar day as [begin, end) epoch seconds
+        int64_t day_end_;
+        int64_t session_;              // Session index of the current trading day
+        std::vector<double> atr_high_;     // Scratch columns for calculate_atr
+        std::vector<double> atr_low_;
+        std::vector<double> atr_close_;
         
         // Helper methods
         bool check_drawdown_limit(const PortfolioState& portfolio);
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "strategy/strategy_registry.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // A symbol's score at one bar, as ranked by CrossSectionalStrategy
+    struct ScoredSymbol {
+        double score;
+        uint32_t symbol;
+    };
+
+    // Base class for strategies that rank a whole symbol universe at every
+    // bar and hold the top_k best scores.
+    //
+    // Symbols are addressed by index; a bar arrives as one close per symbol
+    // (NaN or non-positive = no quote). Per-symbol indicator state lives in
+    // flat arrays updated in O(1) per symbol, and the ranking is a partial
+    // sort (nth_element) over a contiguous score array, so a bar costs
+    // O(symbols + top_k log top_k).
+    class CrossSectionalStrategy {
+    public:
+        explicit CrossSectionalStrategy(const std::string& name);
+        virtual ~CrossSectionalStrategy();
+
+        const std::string& get_name() const;
+
+        // Set parameters; every ranking strategy takes "top_k"
+        virtual bool initialize(const std::map<std::string, double>& params) = 0;
+        virtual std::map<std::string, double> get_parameters() const = 0;
+
+        // Independent copy with the same parameters and state
+        virtual std::unique_ptr<CrossSectionalStrategy> clone() const = 0;
+
+        // Size the per-symbol state for a universe and forget every bar.
+        // Buffers keep their capacity across runs of the same size.
+        void reset(size_t symbol_count);
+
+        // Fold in the next bar (one close per symbol) and return the symbols
+        // to hold: the top_k highest scores, best first (fewer while too few
+        // symbols have a score). Valid until the next call.
+        const std::vector<uint32_t>& rank(const double* closes);
+
+        // Score of every symbol at the last bar (NaN = not ranked)
+        const std::vector<double>& get_scores() const;
+
+        size_t get_top_k() const;
+        size_t get_symbol_count() const;
+
+    protected:
+        std::string name_;
+        size_t top_k_;
+
+        // Allocate per-symbol state for a universe, all bars forgotten
+        virtual void reset_state(size_t symbol_count) = 0;
+
+        // Update the state with one bar and write each symbol's score,
+        // higher is better (NaN where it cannot be ranked or traded)
+        virtual void score(const double* closes, double* scores) = 0;
+
+        // Read "top_k" (at least 1)
+        bool read_top_k(const std::map<std::string, double>& params);
+
+    private:
+        size_t symbol_count_;
+        std::vector<double> scores_;
+        std::vector<ScoredSymbol> ranked_;     // Scratch for the partial sort
+        std::vector<uint32_t> picks_;
+    };
+
+    // Holds the symbols with the largest return over lookback_period bars
+    class MomentumRankStrategy : public CrossSectionalStrategy {
+    public:
+        MomentumRankStrategy();
+
+        bool initialize(const std::map<std::string, double>& params) override;
+        std::map<std::string, double> get_parameters() const override;
+        std::unique_ptr<CrossSectionalStrategy> clone() const override;
+
+    protected:
+        void reset_state(size_t symbol_count) override;
+        void score(const double* closes, double* scores) override;
+
+    private:
+        size_t lookback_period_;
+        size_t symbol_count_;
+        size_t slot_;                          // Ring row the current bar goes to
+        std::vector<double> history_;          // (lookback + 1) rows of last known closes
+        std::vector<double> last_close_;
+        std::vector<uint32_t> bars_seen_;      // Bars since the symbol's first quote
+    };
+
+    // Holds the symbols with the highest RSI (or the lowest, with
+    // hold_lowest = 1). RSI is the simple average of the last 'period' gains
+    // and losses, as RSIStrategy, kept as running sums per symbol.
+    class RSIRankStrategy : public CrossSectionalStrategy {
+    public:
+        RSIRankStrategy();
+
+        bool initialize(const std::map<std::string, double>& params) override;
+        std::map<std::string, double> get_parameters() const override;
+        std::unique_ptr<CrossSectionalStrategy> clone() const override;
+
+    protected:
+        void reset_state(size_t symbol_count) override;
+        void score(const double* closes, double* scores) override;
+
+    private:
+        size_t period_;
+        bool hold_lowest_;
+        size_t symbol_count_;
+        size_t slot_;
+        std::vector<double> gains_;            // 'period' rows of per-bar gains
+        std::vector<double> losses_;
+        std::vector<double> gain_sum_;
+        std::vector<double> loss_sum_;
+        std::vector<double> last_close_;
+        std::vector<uint32_t> bars_seen_;
+
+        void resum();
+    };
+
+    // A cross-sectional strategy type, described by the same parameter
+    // schema as single-symbol strategies
+    struct CrossSectionalInfo {
+        std::string name;                          // Canonical name (as in config.json "strategies")
+        std::string description;
+        std::vector<ParameterSpec> parameters;
+        std::function<std::unique_ptr<CrossSectionalStrategy>()> create;
+    };
+
+    // Name -> cross-sectional strategy type table, the ranking counterpart
+    // of StrategyRegistry. The built-in ranking strategies are registered on
+    // first use. Lookups and creation are safe from several threads at once.
+    class CrossSectionalRegistry {
+    public:
+        // Process-wide registry holding the built-in ranking strategies
+        static CrossSectionalRegistry& instance();
+
+        CrossSectionalRegistry();
+
+        CrossSectionalRegistry(const CrossSectionalRegistry&) = delete;
+        CrossSectionalRegistry& operator=(const CrossSectionalRegistry&) = delete;
+
+        // Add a strategy type; false if its name is taken, a default lies
+        // outside its range, or it has no factory
+        bool register_strategy(const CrossSectionalInfo& info, std::string& error);
+
+        // Type registered under a name (nullptr if none); stays valid for
+        // the life of the registry
+        const CrossSectionalInfo* find(const std::string& name) const;
+
+        // Canonical names, in registration order
+        std::vector<std::string> get_names() const;
+
+        // New instance of a strategy type (nullptr if unknown); not yet initialized
+        std::unique_ptr<CrossSectionalStrategy> create(const std::string& name) const;
+
+        // Every parameter at its default
+        std::map<std::string, double> get_default_parameters(const std::string& name) const;
+
+        // Defaults overlaid with 'overrides', checked as StrategyRegistry does
+        bool resolve_parameters(const std::string& name, const std::map<std::string, double>& overrides,
+                                std::map<std::string, double>& params, std::string& error) const;
+
+    private:
+        mutable std::shared_mutex mutex_;
+        std::deque<CrossSectionalInfo> strategies_;                  // Stable addresses for find()
+        std::map<std::string, const CrossSectionalInfo*> by_name_;
+
+        void register_builtins();
+    };
+
+} // namespace TradingBot
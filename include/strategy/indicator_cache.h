@@ -0,0 +1,84 @@
+#pragma once
+
+#include "data/csv_parser.h"
+#include <cstddef>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Indicator series the cache can compute
+    enum class IndicatorType {
+        SMA,
+        EMA,
+        RSI
+    };
+
+    // Shared cache of whole-series indicators keyed by (series id, type, period).
+    // Each series is computed once and handed out as a read-only array where
+    // element i is the indicator value at bar i (NaN during warm-up). Values
+    // match Strategy::calculate_sma/ema/rsi evaluated on the bars up to i.
+    // Thread-safe; concurrent requests for the same key compute it only once.
+    class IndicatorCache {
+    public:
+        using Series = std::shared_ptr<const std::vector<double>>;
+
+        explicit IndicatorCache(size_t memory_budget_bytes = 256 * 1024 * 1024);
+        ~IndicatorCache();
+
+        // Get (computing on first use) an indicator series for the given data
+        Series get(const std::string& series_id, const std::vector<MarketData>& data,
+                   IndicatorType type, int period);
+
+        // Memory budget for cached series; least recently used entries are evicted
+        void set_memory_budget(size_t bytes);
+        size_t get_memory_budget() const;
+
+        // Bytes held by cached series
+        size_t get_memory_usage() const;
+
+        // Number of cached series
+        size_t size() const;
+
+        // Lookup statistics
+        size_t get_hits() const;
+        size_t get_misses() const;
+
+        // Drop every cached series (arrays already handed out stay valid)
+        void clear();
+
+        // Compute an indicator series without caching
+        static std::vector<double> compute(const std::vector<MarketData>& data, IndicatorType type, int period);
+
+    private:
+        struct Key {
+            std::string series_id;
+            IndicatorType type;
+            int period;
+
+            bool operator<(const Key& other) const;
+        };
+
+        struct Entry {
+            std::shared_future<Series> series;
+            std::list<Key>::iterator lru_position;
+            size_t bytes;                  // 0 while still being computed
+        };
+
+        mutable std::mutex mutex_;
+        std::map<Key, Entry> entries_;
+        std::list<Key> lru_;                   // Most recently used first
+        size_t memory_budget_;
+        size_t memory_usage_;
+        size_t hits_;
+        size_t misses_;
+
+        void evict_to_budget();
+    };
+
+} // namespace TradingBot
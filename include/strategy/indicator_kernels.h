@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+
+namespace TradingBot {
+
+// Whole-array indicator kernels over contiguous doubles.
+//
+// Every kernel has a portable scalar version plus AVX2 and AVX-512 versions;
+// the widest one the CPU supports is picked at run time. Output i covers the
+// input up to and including i, and outputs before the first full window are
+// NaN, so out[i] is what a strategy would see at bar i.
+//
+// Window reductions (rolling sum/SMA, RSI, ATR, z-score) put consecutive
+// outputs in SIMD lanes and sum each window oldest first, exactly as the
+// scalar loop does: sums, SMA, RSI, ATR and min/max are bit-for-bit equal at
+// every level. They cost O(count x period / lanes). EMA is a blocked prefix
+// scan and z-score may use fused multiply-adds, so those agree with scalar
+// to rounding (~1e-12 relative), and are identical between calls on one
+// machine.
+namespace IndicatorKernels {
+
+    // Instruction sets the kernels can use
+    enum class SimdLevel {
+        SCALAR,
+        AVX2,
+        AVX512
+    };
+
+    // Widest level this CPU supports
+    SimdLevel detect_simd_level();
+
+    // Level the kernels use (detect_simd_level() unless changed)
+    SimdLevel get_simd_level();
+
+    // Use a narrower level, e.g. to compare against scalar; clamped to what
+    // the CPU supports. Returns the level now in effect.
+    SimdLevel set_simd_level(SimdLevel level);
+
+    const char* simd_level_name(SimdLevel level);
+
+    // Sum / mean of the last 'period' values
+    void rolling_sum(const double* values, size_t count, int period, double* out);
+    void sma(const double* values, size_t count, int period, double* out);
+
+    // EMA seeded with the SMA of the first 'period' values (out[period - 1]).
+    // Returns the last value (NaN if count < period); 'out' may be null.
+    double ema(const double* values, size_t count, int period, double* out);
+
+    // RSI from the simple average of the last 'period' gains and losses;
+    // the first value is out[period]
+    void rsi(const double* closes, size_t count, int period, double* out);
+
+    // True range; out[0] is high - low (no previous close)
+    void true_range(const double* high, const double* low, const double* close, size_t count, double* out);
+
+    // Mean true range of the last 'period' bars; the first value is out[period]
+    void atr(const double* high, const double* low, const double* close, size_t count, int period, double* out);
+
+    // Lowest / highest of the last 'period' values (monotonic deque, O(count))
+    void rolling_min(const double* values, size_t count, int period, double* out);
+    void rolling_max(const double* values, size_t count, int period, double* out);
+
+    // (value - mean) / standard deviation over the last 'period' values,
+    // population deviation as RollingStats; 0 where the window is flat
+    void zscore(const double* values, size_t count, int period, double* out);
+
+    // Single-window forms equal to the last output of the kernels above
+    double window_sum(const double* values, int period);              // values[0 .. period)
+    double rsi_value(const double* closes, int period);               // closes[0 .. period]
+    double atr_value(const double* high, const double* low, const double* close, int period);  // bars [0 .. period]
+}
+
+} // namespace TradingBot
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "strategy/strategy.h"
+#include "data/bar_resampler.h"
+
+namespace TradingBot {
+
+    // Runs a strategy on a coarser timeframe than the data it is fed.
+    //
+    // Incoming bars are aggregated into 'interval' bars; the wrapped strategy
+    // is asked for a signal only when a coarse bar completes, and the signal
+    // is acted on at the current (fine) bar. Between completions it holds.
+    class ResampledStrategy : public Strategy {
+    public:
+        ResampledStrategy(std::shared_ptr<Strategy> inner, DataInterval interval);
+
+        bool initialize(const std::map<std::string, double>& params) override;
+        TradingSignal generate_signal(const MarketData& data, const Position& current_position) override;
+        std::map<std::string, double> get_parameters() const override;
+        bool validate_parameters(const std::map<std::string, double>& params) const override;
+        void reset() override;
+
+        // Copies the wrapped strategy too
+        std::unique_ptr<Strategy> clone() const override;
+
+        DataInterval get_interval() const;
+        const std::shared_ptr<Strategy>& get_inner() const;
+
+    private:
+        std::shared_ptr<Strategy> inner_;
+        BarAggregator aggregator_;
+        MarketData completed_;
+    };
+
+} // namespace TradingBot
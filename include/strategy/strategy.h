@@ -1,6 +1,8 @@
 #pragma once
 
 #include "data/csv_parser.h"
+#include "strategy/indicator_cache.h"
+#include "utils/rolling_stats.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -61,14 +63,54 @@ namespace TradingBot {
         // Validate strategy parameters
         virtual bool validate_parameters(const std::map<std::string, double>& params) const = 0;
         
+        // Forget every bar seen so the next run starts from scratch.
+        // Parameters are kept and history buffers keep their capacity, so a
+        // reused instance does not reallocate. The backtester calls this at
+        // the start of each run.
+        virtual void reset();
+        
+        // Independent copy with the same parameters and state
+        virtual std::unique_ptr<Strategy> clone() const = 0;
+        
+        // Serve indicators from a shared cache; bar i of the next run must be data[i]
+        void attach_indicator_cache(std::shared_ptr<IndicatorCache> cache,
+                                    const std::string& series_id,
+                                    const std::vector<MarketData>& data);
+        
+        // Go back to computing indicators from the strategy's own history
+        void detach_indicator_cache();
+        
     protected:
         std::string name_;
         std::map<std::string, double> parameters_;
+        std::shared_ptr<IndicatorCache> indicator_cache_;
+        
+        // Index of the current bar in the cached series (checks it matches data)
+        size_t next_cached_bar(const MarketData& data);
         
-        // Helper methods for common calculations
+        // Cached indicator value at a bar (NaN during warm-up)
+        double cached_indicator(IndicatorType type, int period, size_t index);
+        
+        // Helper methods for common calculations, computed by IndicatorKernels
         double calculate_sma(const std::vector<MarketData>& data, int period);
         double calculate_ema(const std::vector<MarketData>& data, int period);
         double calculate_rsi(const std::vector<MarketData>& data, int period);
+        
+    private:
+        struct CachedSeries {
+            IndicatorType type;
+            int period;
+            IndicatorCache::Series values;
+        };
+        
+        std::string series_id_;
+        const std::vector<MarketData>* series_data_;
+        std::vector<double> closes_;                // Scratch column for the indicator kernels
+        size_t bar_index_;
+        std::vector<CachedSeries> cached_series_;   // Series used by this run, looked up once
+        
+        // Closes of data[begin ..] as a contiguous array (valid until the next call)
+        const double* gather_closes(const std::vector<MarketData>& data, size_t begin);
     };
 
     // Simple moving average crossover strategy
@@ -80,6 +122,8 @@ namespace TradingBot {
         TradingSignal generate_signal(const MarketData& data, const Position& current_position) override;
         std::map<std::string, double> get_parameters() const override;
         bool validate_parameters(const std::map<std::string, double>& params) const override;
+        void reset() override;
+        std::unique_ptr<Strategy> clone() const override;
         
     private:
         int short_period_;
@@ -96,6 +140,8 @@ namespace TradingBot {
         TradingSignal generate_signal(const MarketData& data, const Position& current_position) override;
         std::map<std::string, double> get_parameters() const override;
         bool validate_parameters(const std::map<std::string, double>& params) const override;
+        void reset() override;
+        std::unique_ptr<Strategy> clone() const override;
         
     private:
         int rsi_period_;
@@ -113,6 +159,8 @@ namespace TradingBot {
         TradingSignal generate_signal(const MarketData& data, const Position& current_position) override;
         std::map<std::string, double> get_parameters() const override;
         bool validate_parameters(const std::map<std::string, double>& params) const override;
+        void reset() override;
+        std::unique_ptr<Strategy> clone() const override;
         
     private:
         int short_period_;
@@ -120,4 +168,26 @@ namespace TradingBot {
         std::vector<MarketData> price_history_;
     };
 
+    // Mean reversion on Bollinger-style bands: buys when the close falls
+    // more than std_dev_threshold standard deviations below its
+    // lookback_period mean, and sells when it rises that far above or, while
+    // long, reverts to the mean. Window statistics are kept incrementally, so
+    // each bar costs O(1) whatever the lookback.
+    class MeanReversionStrategy : public Strategy {
+    public:
+        MeanReversionStrategy();
+        
+        bool initialize(const std::map<std::string, double>& params) override;
+        TradingSignal generate_signal(const MarketData& data, const Position& current_position) override;
+        std::map<std::string, double> get_parameters() const override;
+        bool validate_parameters(const std::map<std::string, double>& params) const override;
+        void reset() override;
+        std::unique_ptr<Strategy> clone() const override;
+        
+    private:
+        int lookback_period_;
+        double std_dev_threshold_;
+        RollingStats closes_;
+    };
+
 } // namespace TradingBot
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "strategy/strategy.h"
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Value domain of a strategy parameter
+    enum class ParameterType {
+        INTEGER,                       // Whole numbers (periods)
+        REAL
+    };
+
+    // One tunable parameter a strategy accepts
+    struct ParameterSpec {
+        std::string name;
+        ParameterType type;
+        double min_value;
+        double max_value;
+        double default_value;
+        double step;                   // Grid step for sweeps (1 for periods); 0 = continuous
+        std::string description;
+
+        ParameterSpec() : type(ParameterType::REAL), min_value(0.0), max_value(0.0), default_value(0.0), step(0.0) {}
+        ParameterSpec(const std::string& param_name, ParameterType param_type, double min_val, double max_val,
+                      double default_val, double step_size, const std::string& text = "")
+            : name(param_name), type(param_type), min_value(min_val), max_value(max_val),
+              default_value(default_val), step(step_size), description(text) {}
+    };
+
+    // Why 'value' does not fit 'spec' (empty if it does)
+    std::string check_parameter(const ParameterSpec& spec, double value);
+
+    // Defaults of 'schema' overlaid with 'overrides', each checked against
+    // its spec (known name, within range, whole for integers). False with
+    // 'error' naming the first bad parameter. Every registry resolves
+    // through this, so all strategy kinds share one rule set.
+    bool resolve_parameter_schema(const std::string& strategy_name, const std::vector<ParameterSpec>& schema,
+                                  const std::map<std::string, double>& overrides,
+                                  std::map<std::string, double>& params, std::string& error);
+
+    // A strategy type: how to build it and which parameters it takes
+    struct StrategyInfo {
+        std::string name;                          // Canonical name (as in config.json "strategies")
+        std::vector<std::string> aliases;          // Other accepted names, e.g. "SMA"
+        std::string description;
+        std::vector<ParameterSpec> parameters;
+        std::function<std::unique_ptr<Strategy>()> create;
+    };
+
+    // Version of the plugin entry point below; a plugin built against a
+    // different version is refused
+    const int STRATEGY_PLUGIN_API_VERSION = 2;
+
+    // A strategy plugin is a shared library exporting
+    //   extern "C" int tradingbot_strategy_plugin_version();      // STRATEGY_PLUGIN_API_VERSION
+    //   extern "C" bool tradingbot_register_strategies(TradingBot::StrategyRegistry& registry);
+    // built with the same compiler and headers as the host. The library
+    // stays loaded for the life of the process.
+    #define TRADINGBOT_PLUGIN_VERSION_SYMBOL "tradingbot_strategy_plugin_version"
+    #define TRADINGBOT_PLUGIN_REGISTER_SYMBOL "tradingbot_register_strategies"
+
+    // Name -> strategy type table. The built-in strategies are registered on
+    // first use; more can be added in code or from plugins. Lookups and
+    // creation are safe from several threads at once.
+    class StrategyRegistry {
+    public:
+        // Process-wide registry holding the built-in strategies
+        static StrategyRegistry& instance();
+
+        StrategyRegistry();
+
+        StrategyRegistry(const StrategyRegistry&) = delete;
+        StrategyRegistry& operator=(const StrategyRegistry&) = delete;
+
+        // Add a strategy type; false if its name or an alias is taken, a
+        // default lies outside its range, or it has no factory
+        bool register_strategy(const StrategyInfo& info, std::string& error);
+
+        // Load a plugin library and run its registration
+        bool load_plugin(const std::string& path, std::string& error);
+
+        // Type registered under a name or alias (nullptr if none). The
+        // pointer stays valid for the life of the registry.
+        const StrategyInfo* find(const std::string& name) const;
+
+        // Canonical names, in registration order
+        std::vector<std::string> get_names() const;
+
+        // New instance of a strategy type (nullptr if unknown); not yet initialized
+        std::unique_ptr<Strategy> create(const std::string& name) const;
+
+        // Every parameter at its default
+        std::map<std::string, double> get_default_parameters(const std::string& name) const;
+
+        // Defaults overlaid with 'overrides', each checked against the
+        // schema (known name, within range, whole for integers). False with
+        // 'error' naming the first bad parameter.
+        bool resolve_parameters(const std::string& name, const std::map<std::string, double>& overrides,
+                                std::map<std::string, double>& params, std::string& error) const;
+
+    private:
+        mutable std::shared_mutex mutex_;
+        std::deque<StrategyInfo> strategies_;                  // Stable addresses for find()
+        std::map<std::string, const StrategyInfo*> by_name_;   // Names and aliases
+        std::vector<void*> plugins_;                           // Library handles, never closed
+
+        void register_builtins();
+    };
+
+} // namespace TradingBot
@@ -1,15 +1,21 @@
 #pragma once
 
 // Main trading bot header that includes all components
+#include "config/bot_config.h"
 #include "data/csv_parser.h"
 #include "data/api_data_fetcher.h"
 #include "strategy/strategy.h"
+#include "strategy/strategy_registry.h"
 #include "risk/risk_manager.h"
 #include "backtester/backtester.h"
+#include "backtester/cross_sectional_backtester.h"
 #include "reporting/report_generator.h"
 #include "utils/logger.h"
+#include "optimizer/parameter_optimizer.h"
+#include "live/paper_trader.h"
 #include <string>
 #include <map>
+#include <vector>
 #include <memory>
 
 namespace TradingBot {
@@ -22,9 +28,29 @@ namespace TradingBot {
         // Initialize the bot with configuration
         bool initialize(const std::string& config_file);
         
-        // Run backtesting with CSV file
+        // Re-read the configuration file if it changed; risk and backtest
+        // settings apply to the runs that follow. False if the new file is
+        // invalid (the previous configuration stays in effect).
+        bool reload_configuration();
+        
+        // Run backtesting with CSV file. Repeated calls reuse the loaded data
+        // (when the file is the same), the strategy instance (when the name
+        // is the same) and the risk manager.
         bool run_backtest(const std::string& data_file, const std::string& strategy_name);
         
+        // Backtest several strategies in one pass over a CSV file loaded once
+        bool run_backtests(const std::string& data_file, const std::vector<std::string>& strategy_names);
+        
+        // Run a cross-sectional strategy ("CS_MOMENTUM", "CS_RSI") over a
+        // universe of CSV files, one per symbol (symbol -> file). Parameters
+        // come from the strategy's defaults overridden by the config's
+        // "strategies" section; rebalances every rebalance_period bars.
+        bool run_universe_backtest(const std::map<std::string, std::string>& data_files,
+                                   const std::string& strategy_name, size_t rebalance_period = 1);
+        
+        // Run every job of a batch manifest and write one consolidated results file
+        bool run_batch(const std::string& manifest_file);
+        
         // Run backtesting with API data
         bool run_backtest_with_api(
             const std::string& symbol,
@@ -43,6 +69,29 @@ namespace TradingBot {
             DataInterval interval = DataInterval::DAILY
         );
         
+        // Search strategy and risk parameters with the genetic optimizer
+        OptimizationResult optimize_strategy(
+            const std::string& data_file,
+            const std::string& strategy_name,
+            const OptimizerConfig& optimizer_config = OptimizerConfig()
+        );
+        
+        // Paper trade live quotes from the active API provider until the
+        // session's quote limit is reached (runs until killed if unlimited)
+        bool run_paper_trading(
+            const std::string& strategy_name,
+            const PaperTradingConfig& paper_config = PaperTradingConfig()
+        );
+        
+        // Journal every API response and paper-traded quote to a file
+        bool start_recording(const std::string& journal_file);
+        
+        // Serve the active provider's data from a recorded journal instead of the network
+        bool use_recorded_session(const std::string& journal_file);
+        
+        // Register the strategies of a plugin library (see StrategyRegistry)
+        bool load_strategy_plugin(const std::string& library_file);
+        
         // Set API provider (Alpha Vantage, Yahoo Finance, etc.)
         bool set_api_provider(APIProvider provider);
         
@@ -52,25 +101,36 @@ namespace TradingBot {
         // Get performance metrics
         const BacktestResults& get_results() const;
         
+        // Results of the last run_backtests, by strategy name
+        const std::map<std::string, BacktestResults>& get_comparison_results() const;
+        
     private:
-        std::unique_ptr<CSVParser> csv_parser_;
+        std::shared_ptr<CSVParser> csv_parser_;        // Shared with the backtester during a run
+        int64_t data_modified_;                        // File time and size of the loaded data
+        uintmax_t data_size_;
         std::unique_ptr<APIDataFetcher> api_fetcher_;
-        std::unique_ptr<Strategy> strategy_;
-        std::unique_ptr<RiskManager> risk_manager_;
+        std::shared_ptr<Strategy> strategy_;
+        std::string strategy_name_;                    // Name strategy_ was created under
+        std::shared_ptr<RiskManager> risk_manager_;
         std::unique_ptr<Backtester> backtester_;
         std::unique_ptr<ReportGenerator> report_generator_;
         std::unique_ptr<Logger> logger_;
         
+        std::shared_ptr<JournalWriter> journal_;
+        
         BacktestResults results_;
-        std::map<std::string, std::map<std::string, std::string>> config_data_;
+        std::map<std::string, BacktestResults> comparison_results_;
+        ConfigLoader config_;
         bool api_enabled_;
         
         // Helper methods
         std::unique_ptr<Strategy> create_strategy(const std::string& strategy_name);
         std::map<std::string, double> get_strategy_parameters(const std::string& strategy_name);
+        std::vector<ParameterRange> get_parameter_ranges(const std::string& strategy_name);
         bool load_configuration(const std::string& config_file);
         RiskParameters load_risk_parameters();
+        SessionCalendar load_session_calendar();
         BacktestConfig load_backtest_config();
-        std::map<std::string, std::map<std::string, std::string>> parse_simple_json(const std::string& json_content);
+        std::string available_strategies() const;
     };
 }
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace TradingBot {
+
+    // Parsed JSON document node. Objects keep their members in file order
+    // (config objects are small, so lookups are a linear scan), and every
+    // node remembers the line it started on for error messages.
+    class JsonValue {
+    public:
+        enum class Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+        using Member = std::pair<std::string, JsonValue>;
+
+        JsonValue();
+
+        Type type() const;
+        size_t line() const;
+
+        bool is_null() const;
+        bool is_bool() const;
+        bool is_number() const;
+        bool is_string() const;
+        bool is_array() const;
+        bool is_object() const;
+
+        // Contents; only meaningful for the matching type
+        bool as_bool() const;
+        double as_number() const;
+        const std::string& as_string() const;
+        const std::vector<JsonValue>& items() const;
+        const std::vector<Member>& members() const;
+
+        // Member of an object (nullptr if absent or not an object)
+        const JsonValue* find(std::string_view key) const;
+
+        // Name of a type for messages ("number", "object", ...)
+        static const char* type_name(Type type);
+
+    private:
+        friend class JsonParser;
+
+        Type type_;
+        size_t line_;
+        bool bool_;
+        double number_;
+        std::string string_;
+        std::vector<JsonValue> items_;
+        std::vector<Member> members_;
+    };
+
+    // Parse a complete RFC 8259 document into 'value'. On failure returns
+    // false with 'error' as "line L, column C: <reason>".
+    bool parse_json(std::string_view text, JsonValue& value, std::string& error);
+
+} // namespace TradingBot
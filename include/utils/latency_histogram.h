@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Fixed-memory latency histogram with log-linear buckets: each power of two
+    // is split into 16 linear sub-buckets, so any recorded value is reported
+    // within ~6% regardless of magnitude. Recording is a couple of bit
+    // operations and an increment; not thread-safe (one histogram per thread,
+    // merge afterwards).
+    class LatencyHistogram {
+    public:
+        LatencyHistogram();
+
+        // Record one latency sample in nanoseconds
+        void record(uint64_t nanoseconds);
+
+        // Add another histogram's samples to this one
+        void merge(const LatencyHistogram& other);
+
+        void reset();
+
+        uint64_t count() const;
+        uint64_t min() const;
+        uint64_t max() const;
+        double mean() const;
+
+        // Latency at the given percentile (0-100), in nanoseconds
+        uint64_t percentile(double p) const;
+
+        // One-line summary in microseconds: count, mean, p50, p90, p99, p99.9, max
+        std::string summary() const;
+
+    private:
+        static const int kSubBucketBits = 4;
+        static const size_t kSubBuckets = size_t(1) << kSubBucketBits;
+
+        std::vector<uint64_t> buckets_;
+        uint64_t count_;
+        uint64_t min_;
+        uint64_t max_;
+        double sum_;
+
+        static size_t bucket_index(uint64_t value);
+        static uint64_t bucket_upper_bound(size_t index);
+    };
+
+} // namespace TradingBot
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace TradingBot {
+
+    // Mean and variance of the last 'window' values, O(1) per value.
+    //
+    // Values are kept in a ring; adding one to a full window swaps out the
+    // oldest with Welford's update for a sliding window. Once per lap the
+    // sums are recomputed from the ring, so rounding error never outlives one
+    // window however many values go through. The ring is sized by reset();
+    // push() never allocates.
+    class RollingStats {
+    public:
+        explicit RollingStats(int window = 20);
+
+        // Forget every value and start over with a new window (keeps capacity)
+        void reset(int window);
+
+        // Forget every value, same window
+        void reset();
+
+        // Add the next value
+        void push(double value);
+
+        // True once a full window has been seen
+        bool is_ready() const;
+
+        // Values currently in the window (at most get_window())
+        size_t get_count() const;
+        int get_window() const;
+
+        double get_mean() const;
+        double get_sum() const;
+
+        // Sample variance / standard deviation (n - 1); 0 below two values
+        double get_variance() const;
+        double get_stdev() const;
+
+        // Population variance / standard deviation (n), as Bollinger bands use
+        double get_population_variance() const;
+        double get_population_stdev() const;
+
+        // Standard score of 'value' against the window (population stdev);
+        // 0 when the window has no spread
+        double get_zscore(double value) const;
+
+        // Most recent value (0 before the first)
+        double get_last() const;
+
+    private:
+        int window_;
+        size_t count_;                 // Values in the window
+        size_t next_;                  // Ring slot the next value overwrites
+        std::vector<double> values_;
+        double sum_;
+        double m2_;                    // Sum of squared deviations from the mean
+
+        void resum();
+    };
+
+} // namespace TradingBot
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Exchange hours in exchange-local time
+    struct SessionHours {
+        int utc_offset_minutes;        // Local time minus UTC (fixed; no daylight saving)
+        int open_minutes;              // Session open, minutes after local midnight
+        int close_minutes;             // Session close; below the open for sessions spanning midnight
+        bool weekends_closed;          // Saturdays and Sundays are not trading days
+
+        SessionHours() :
+            utc_offset_minutes(0),     // UTC
+            open_minutes(0),           // Around the clock: days split at midnight
+            close_minutes(24 * 60),
+            weekends_closed(true)
+        {}
+    };
+
+    // Maps epoch timestamps to trading days.
+    //
+    // A trading day runs from one session open to the next (local midnight
+    // for sessions inside a calendar day), and is labelled with the date of
+    // its close. Holidays and weekends are folded into a per-day lookup table
+    // by build(), so per-bar questions are arithmetic plus one array read;
+    // callers tracking the current day need only compare against
+    // day_bounds() until a bar falls outside it.
+    class SessionCalendar {
+    public:
+        SessionCalendar();
+        explicit SessionCalendar(const SessionHours& hours);
+
+        const SessionHours& get_hours() const;
+
+        // Close the exchange on a date ("YYYY-MM-DD"); false if not a date
+        bool add_holiday(const std::string& date);
+
+        // Precompute the table for trading days between two timestamps
+        void build(int64_t first_epoch, int64_t last_epoch);
+
+        // Whether the table holds a trading day (lookups outside it still
+        // work, by counting)
+        bool covers(int64_t day) const;
+
+        // Trading day (days since 1970-01-01 of its label date) a time falls in
+        int64_t trading_day(int64_t epoch_seconds) const;
+
+        // [begin, end) in epoch seconds of the trading day containing a time
+        void day_bounds(int64_t epoch_seconds, int64_t& begin, int64_t& end) const;
+
+        // Whether a day number is a scheduled session (not a weekend or holiday)
+        bool is_trading_day(int64_t day) const;
+
+        // Whether the exchange is open at a time
+        bool is_open(int64_t epoch_seconds) const;
+
+        // Trading days from 1970-01-01 up to (not including) 'day', so
+        // consecutive sessions have consecutive indexes
+        int64_t session_index(int64_t day) const;
+
+    private:
+        SessionHours hours_;
+        std::vector<int64_t> holidays_;    // Sorted day numbers
+        int64_t table_first_;              // Day number of table entry 0
+        std::vector<int32_t> table_;       // session_index << 1, low bit set on trading days
+
+        bool compute_is_trading_day(int64_t day) const;
+        int64_t count_sessions(int64_t from, int64_t to) const;
+        int64_t local_offset() const;
+    };
+
+} // namespace TradingBot
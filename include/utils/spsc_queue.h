@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace TradingBot {
+
+    // Bounded lock-free single-producer/single-consumer ring buffer.
+    //
+    // Exactly one thread may push and exactly one thread may pop. Neither side
+    // ever blocks: try_push fails when the ring is full and try_pop fails when
+    // it is empty. Head and tail live on separate cache lines, and each side
+    // keeps a cached copy of the other's index so the shared line is only
+    // re-read when the cached value says the ring looks full (or empty).
+    template <typename T>
+    class SPSCQueue {
+    public:
+        // Capacity is rounded up to a power of two
+        explicit SPSCQueue(size_t capacity)
+            : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
+            if (capacity == 0) {
+                throw std::invalid_argument("Queue capacity must be positive");
+            }
+            size_t size = 1;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            slots_.resize(size);
+            mask_ = size - 1;
+        }
+
+        SPSCQueue(const SPSCQueue&) = delete;
+        SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+        // Producer side
+        bool try_push(T value) {
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - cached_head_ > mask_) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                if (tail - cached_head_ > mask_) {
+                    return false;
+                }
+            }
+            slots_[tail & mask_] = std::move(value);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side
+        bool try_pop(T& value) {
+            size_t head = head_.load(std::memory_order_relaxed);
+            if (head == cached_tail_) {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                if (head == cached_tail_) {
+                    return false;
+                }
+            }
+            value = std::move(slots_[head & mask_]);
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Approximate when called concurrently with push/pop
+        size_t size() const {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        size_t capacity() const {
+            return mask_ + 1;
+        }
+
+    private:
+        static const size_t kCacheLine = 64;
+
+        std::vector<T> slots_;
+        size_t mask_;
+
+        // Consumer-owned
+        alignas(kCacheLine) std::atomic<size_t> head_;
+        size_t cached_tail_;
+
+        // Producer-owned
+        alignas(kCacheLine) std::atomic<size_t> tail_;
+        size_t cached_head_;
+    };
+
+} // namespace TradingBot
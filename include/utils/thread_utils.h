@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace TradingBot {
+
+    // Pin the calling thread to one CPU core; false if unsupported or refused
+    bool pin_current_thread(int cpu);
+
+    // Number of cores available to this process (at least 1)
+    int available_cpu_count();
+
+    // CPUs available to this process grouped by NUMA node (a single group
+    // when the topology is unknown); never empty
+    std::vector<std::vector<int>> numa_cpu_nodes();
+
+    // Name the calling thread for debuggers and profilers (best effort)
+    void set_current_thread_name(const std::string& name);
+
+} // namespace TradingBot
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace TradingBot {
+
+// Calendar and timestamp helpers. All times are UTC seconds since the Unix epoch.
+namespace TimeUtils {
+    // Days since 1970-01-01 for a proleptic Gregorian date
+    int64_t days_from_civil(int year, unsigned month, unsigned day);
+
+    // Inverse of days_from_civil
+    void civil_from_days(int64_t days, int& year, unsigned& month, unsigned& day);
+
+    // Day of week for a day number (0 = Monday ... 6 = Sunday)
+    int weekday_from_days(int64_t days);
+
+    // Epoch of a timestamp that could not be read
+    const int64_t NO_EPOCH = INT64_MIN;
+
+    // Parse "YYYY-MM-DD", "YYYY-MM-DD HH:MM" or "YYYY-MM-DD HH:MM:SS" (space or
+    // 'T' separator; fractional seconds and a trailing 'Z' are ignored) or a
+    // bare integer epoch. False if the text is not a valid timestamp.
+    // Fields sit at fixed offsets, so no locale or stream is involved.
+    bool parse_timestamp(std::string_view text, int64_t& epoch_seconds);
+
+    // Same formats, keeping up to nine digits of fractional seconds
+    bool parse_timestamp_ns(std::string_view text, int64_t& epoch_nanoseconds);
+
+    // "YYYY-MM-DD HH:MM:SS"
+    std::string format_timestamp(int64_t epoch_seconds);
+
+    // "YYYY-MM-DD"
+    std::string format_date(int64_t epoch_seconds);
+
+    // Allocation-free forms: write 19 (timestamp) or 10 (date) characters
+    // to 'out' and return the count
+    size_t format_timestamp(int64_t epoch_seconds, char* out);
+    size_t format_date(int64_t epoch_seconds, char* out);
+}
+
+} // namespace TradingBot
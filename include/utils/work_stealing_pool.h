@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TradingBot {
+
+    // How a scheduler places its workers
+    struct SchedulerOptions {
+        size_t num_threads;            // 0 = one per available core
+        bool pin_threads;              // Pin each worker to its own core
+        bool numa_aware;               // With pinning: deal workers across NUMA nodes, steal within a node first
+
+        SchedulerOptions() : num_threads(0), pin_threads(false), numa_aware(true) {}
+    };
+
+    // Fixed-size thread pool with one task deque per worker.
+    //
+    // Tasks submitted from outside the pool are dealt round-robin across the
+    // deques; tasks submitted by a running task go to that worker's own
+    // deque. A worker pops its newest task first and, when its deque is
+    // empty, steals the oldest task from another worker, so uneven jobs keep
+    // every thread busy without a central queue.
+    //
+    // shared() is the process-wide instance every parallel subsystem submits
+    // to, so running several of them at once does not oversubscribe cores.
+    class WorkStealingPool {
+    public:
+        using Task = std::function<void()>;
+
+        explicit WorkStealingPool(size_t num_threads = 0);   // 0 = one per core
+        explicit WorkStealingPool(const SchedulerOptions& options);
+        ~WorkStealingPool();                                 // Finishes queued tasks first
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        // Process-wide scheduler, created on first use
+        static WorkStealingPool& shared();
+
+        // Options for the shared scheduler; false once it has been created
+        static bool configure_shared(const SchedulerOptions& options);
+
+        void submit(Task task);
+
+        // Block until every submitted task has finished; rethrows the first
+        // exception a task threw. Not to be called from a task.
+        void wait_idle();
+
+        size_t get_thread_count() const;
+        size_t get_steals() const;
+        size_t get_node_count() const;
+        size_t get_pinned_count() const;
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+            int cpu;                       // -1 = not pinned
+            std::vector<size_t> victims;   // Steal order: same node first
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+        std::vector<std::thread> threads_;
+
+        std::mutex idle_mutex_;
+        std::condition_variable work_available_;
+        std::condition_variable all_done_;
+        std::atomic<size_t> queued_;       // Tasks sitting in deques
+        std::atomic<size_t> pending_;      // Tasks submitted and not yet finished
+        std::atomic<size_t> next_worker_;
+        std::atomic<size_t> steals_;
+        std::atomic<size_t> pinned_;
+        size_t node_count_;
+        bool stop_;
+        std::exception_ptr error_;
+
+        void start(const SchedulerOptions& options);
+        bool try_pop(size_t index, Task& task);
+        bool try_steal(const std::vector<size_t>& victims, Task& task);
+        void push(size_t index, Task task);
+        void execute(Task& task);
+        void worker_loop(size_t index);
+    };
+
+    // Tasks that are waited for or cancelled together. Tasks of different
+    // groups share the pool's workers.
+    //
+    // wait() runs the group's own not-yet-started tasks on the waiting thread
+    // instead of blocking, so a task may wait for a group of its own without
+    // tying up a worker. It never picks up other groups' work, which could
+    // block on something the waiter is holding up. The first exception a
+    // task throws cancels the rest of the group and is rethrown by wait().
+    class TaskGroup {
+    public:
+        explicit TaskGroup(WorkStealingPool& pool = WorkStealingPool::shared());
+        ~TaskGroup();                      // Waits; errors not collected by wait() are dropped
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        void run(WorkStealingPool::Task task);
+        void wait();
+
+        // Tasks not yet started are skipped; running ones can poll is_cancelled()
+        void cancel();
+        bool is_cancelled() const;
+
+    private:
+        struct State {
+            std::mutex mutex;
+            std::condition_variable done;
+            std::deque<WorkStealingPool::Task> queue;  // Not yet started
+            std::atomic<size_t> pending;               // Queued or running
+            std::atomic<bool> cancelled;
+            std::exception_ptr error;
+
+            State() : pending(0), cancelled(false) {}
+        };
+
+        WorkStealingPool& pool_;
+        std::shared_ptr<State> state_;
+
+        // Run the group's oldest (pool workers) or newest (the waiter) queued task
+        static bool run_queued(State& state, bool newest);
+    };
+
+    // Run fn(i) for every i in [0, count) as at most 'max_tasks' tasks on
+    // 'pool' (0 = one per worker), the calling thread included. Returns once
+    // every call has finished; rethrows the first exception fn threw.
+    template <typename Fn>
+    void parallel_for(WorkStealingPool& pool, size_t count, size_t max_tasks, Fn fn) {
+        size_t tasks = std::min(count, max_tasks > 0 ? max_tasks : pool.get_thread_count());
+        if (tasks <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                fn(i);
+            }
+            return;
+        }
+
+        std::atomic<size_t> next(0);
+        TaskGroup group(pool);
+        auto body = [&]() {
+            for (size_t i = next.fetch_add(1); i < count && !group.is_cancelled(); i = next.fetch_add(1)) {
+                fn(i);
+            }
+        };
+        for (size_t t = 1; t < tasks; ++t) {
+            group.run(body);
+        }
+
+        try {
+            body();
+        } catch (...) {
+            group.cancel();
+            try {
+                group.wait();
+            } catch (...) {
+            }
+            throw;
+        }
+        group.wait();
+    }
+
+} // namespace TradingBot
@@ -1,4 +1,5 @@
 #include "backtester/backtester.h"
+#include "utils/work_stealing_pool.h"
 #include <algorithm>
 #include <cmath>
 #include <numeric>
@@ -6,6 +7,16 @@
 
 namespace TradingBot {
 
+namespace {
+
+// Cache key for a parser's data: the file alone would serve stale series
+// after a reload, so the load's generation goes in too
+std::string series_id(const CSVParser& data_parser) {
+    return data_parser.get_source() + "#" + std::to_string(data_parser.get_generation());
+}
+
+} // namespace
+
 Backtester::Backtester() {}
 
 Backtester::~Backtester() {}
@@ -32,101 +43,149 @@ bool Backtester::initialize(const BacktestConfig& config) {
 BacktestResults Backtester::run_backtest(std::shared_ptr<Strategy> strategy,
                                         std::shared_ptr<CSVParser> data_parser,
                                         std::shared_ptr<RiskManager> risk_manager) {
-    // Initialize results
-    results_ = BacktestResults();
-    
     if (!strategy || !data_parser || !risk_manager) {
         throw std::invalid_argument("Null pointer provided to run_backtest");
     }
     
+    BacktestState state;
+    begin_run(state);
+    strategy->reset();
+    risk_manager->reset();
     
-    PortfolioState portfolio;
-    portfolio.cash = config_.initial_capital;
-    portfolio.total_value = config_.initial_capital;
-    
-    Position current_position;
+    size_t data_count = data_parser->get_data_count();
     
+    // Cached series are keyed by the loaded file, so in-memory data computes its own
+    bool use_indicator_cache = indicator_cache_ && !data_parser->get_source().empty();
+    if (use_indicator_cache) {
+        strategy->attach_indicator_cache(indicator_cache_, series_id(*data_parser),
+                                         data_parser->get_all_data());
+    }
     
-    size_t data_count = data_parser->get_data_count();
+    if (config_.record_equity_curve) {
+        results_.equity_curve.reserve(data_count);
+    }
     
     for (size_t i = 0; i < data_count; ++i) {
-        const MarketData& current_data = data_parser->get_data(i);
-        
-        
-        TradingSignal signal;
-        try {
-            signal = strategy->generate_signal(current_data, current_position);
-        } catch (const std::exception& e) {
-            
-            continue;
-        }
-        
-        
-        if (signal.type != SignalType::HOLD && risk_manager->validate_trade(signal, portfolio)) {
-            
-            
-            double position_size = risk_manager->calculate_position_size(signal, portfolio, current_data);
-            signal.quantity = position_size;
-            
-            
-            Trade trade;
-            execute_trade(trade, signal, current_data, portfolio);
-            
-            
-            risk_manager->update_portfolio_state(portfolio, signal, current_data);
-            
-            
-            if (signal.type == SignalType::BUY) {
-                current_position.quantity += signal.quantity;
-                current_position.avg_price = signal.price; // Simplified - should be weighted average
-                current_position.symbol = "STOCK"; // Simplified - should track actual symbol
-            } else if (signal.type == SignalType::SELL) {
-                current_position.quantity -= signal.quantity;
-                if (current_position.quantity <= 0) {
-                    current_position.quantity = 0.0;
-                    current_position.avg_price = 0.0;
-                }
-            }
-            
-            // Record the trade
-            results_.trades.push_back(trade);
-        }
-        
-        // Check for risk-based position closures (stop-loss, take-profit)
-        if (current_position.quantity > 0 && 
-            risk_manager->should_close_position(current_position, current_data, portfolio)) {
-            
-            // Create sell signal for position closure
-            TradingSignal close_signal;
-            close_signal.type = SignalType::SELL;
-            close_signal.price = current_data.close;
-            close_signal.quantity = current_position.quantity;
-            close_signal.timestamp = current_data.timestamp;
-            close_signal.reason = "Risk management closure (stop-loss/take-profit)";
-            
-            // Execute the closure trade
-            Trade close_trade;
-            execute_trade(close_trade, close_signal, current_data, portfolio);
-            risk_manager->update_portfolio_state(portfolio, close_signal, current_data);
-            
-            // Reset position
-            current_position.quantity = 0.0;
-            current_position.avg_price = 0.0;
-            
-            // Record the trade
-            results_.trades.push_back(close_trade);
+        process_bar(data_parser->get_data(i), *strategy, *risk_manager, state);
+    }
+    
+    if (use_indicator_cache) {
+        strategy->detach_indicator_cache();
+    }
+    
+    end_run();
+    
+    return results_;
+}
+
+BacktestResults Backtester::run_backtest(std::shared_ptr<Strategy> strategy,
+                                        const CompressedBarStore& bars,
+                                        std::shared_ptr<RiskManager> risk_manager) {
+    if (!strategy || !risk_manager) {
+        throw std::invalid_argument("Null pointer provided to run_backtest");
+    }
+    
+    BacktestState state;
+    begin_run(state);
+    strategy->reset();
+    risk_manager->reset();
+    
+    if (config_.record_equity_curve) {
+        results_.equity_curve.reserve(bars.size());
+    }
+    
+    CompressedBarStore::Cursor cursor = bars.cursor();
+    while (const MarketData* bar = cursor.next()) {
+        process_bar(*bar, *strategy, *risk_manager, state);
+    }
+    
+    end_run();
+    
+    return results_;
+}
+
+BacktestResults Backtester::run_backtest(std::shared_ptr<Strategy> strategy,
+                                        std::shared_ptr<BarSource> source,
+                                        std::shared_ptr<RiskManager> risk_manager) {
+    if (!strategy || !source || !risk_manager) {
+        throw std::invalid_argument("Null pointer provided to run_backtest");
+    }
+    
+    BacktestState state;
+    begin_run(state);
+    strategy->reset();
+    risk_manager->reset();
+    
+    std::vector<MarketData> batch;
+    while (source->next_batch(batch)) {
+        for (const MarketData& bar : batch) {
+            process_bar(bar, *strategy, *risk_manager, state);
         }
-        
-        // Update equity curve
-        update_equity_curve(portfolio.total_value);
     }
     
-    // Calculate final statistics
-    calculate_statistics();
+    end_run();
     
     return results_;
 }
 
+std::vector<BacktestResults> Backtester::run_backtests(const std::vector<StrategyRun>& runs,
+                                                      std::shared_ptr<CSVParser> data_parser) {
+    if (!data_parser) {
+        throw std::invalid_argument("Null pointer provided to run_backtests");
+    }
+    
+    std::vector<BacktestState> states;
+    std::vector<std::unique_ptr<Backtester>> lanes = begin_runs(runs, states);
+    
+    // Strategies asking for the same indicator read one series; in-memory data
+    // uses a cache private to this call since it has no id to share under
+    bool shared_cache = indicator_cache_ && !data_parser->get_source().empty();
+    std::shared_ptr<IndicatorCache> cache = shared_cache ? indicator_cache_ : std::make_shared<IndicatorCache>();
+    std::string id = shared_cache ? series_id(*data_parser) : "run_backtests";
+    
+    size_t data_count = data_parser->get_data_count();
+    for (size_t k = 0; k < runs.size(); ++k) {
+        runs[k].strategy->attach_indicator_cache(cache, id, data_parser->get_all_data());
+        if (runs[k].config.record_equity_curve) {
+            lanes[k]->results_.equity_curve.reserve(data_count);
+        }
+    }
+    
+    process_lanes(lanes, runs, states, data_parser->get_all_data().data(), data_count);
+    
+    std::vector<BacktestResults> results;
+    results.reserve(lanes.size());
+    for (size_t k = 0; k < lanes.size(); ++k) {
+        runs[k].strategy->detach_indicator_cache();
+        lanes[k]->end_run();
+        results.push_back(lanes[k]->results_);
+    }
+    return results;
+}
+
+std::vector<BacktestResults> Backtester::run_backtests(const std::vector<StrategyRun>& runs,
+                                                      std::shared_ptr<BarSource> source) {
+    if (!source) {
+        throw std::invalid_argument("Null pointer provided to run_backtests");
+    }
+    
+    std::vector<BacktestState> states;
+    std::vector<std::unique_ptr<Backtester>> lanes = begin_runs(runs, states);
+    
+    std::vector<MarketData> batch;
+    while (source->next_batch(batch)) {
+        process_lanes(lanes, runs, states, batch.data(), batch.size());
+    }
+    
+    std::vector<BacktestResults> results;
+    results.reserve(lanes.size());
+    for (size_t k = 0; k < lanes.size(); ++k) {
+        lanes[k]->end_run();
+        results.push_back(lanes[k]->results_);
+    }
+    return results;
+}
+
 const BacktestConfig& Backtester::get_config() const {
     return config_;
 }
@@ -139,12 +198,169 @@ const BacktestResults& Backtester::get_results() const {
     return results_;
 }
 
+void Backtester::set_indicator_cache(std::shared_ptr<IndicatorCache> cache) {
+    indicator_cache_ = cache;
+}
+
 // Private helper methods
 
+void Backtester::begin_run(BacktestState& state) {
+    // Initialize results
+    results_ = BacktestResults();
+    stats_.reset(config_.initial_capital);
+    
+    state = BacktestState();
+    state.portfolio.cash = config_.initial_capital;
+    state.portfolio.total_value = config_.initial_capital;
+    
+    // Resting stop-loss/take-profit bracket for the open position (intrabar mode)
+    execution_.cancel_all();
+    execution_.set_slippage(config_.slippage);
+}
+
+void Backtester::process_bar(const MarketData& current_data, Strategy& strategy,
+                             RiskManager& risk_manager, BacktestState& state) {
+    PortfolioState& portfolio = state.portfolio;
+    Position& current_position = state.position;
+    
+    // Volatility for sizing and the trading day advance with every bar, traded or not
+    risk_manager.update_market_data(current_data, portfolio);
+    
+    // Resting exits see this bar's full high/low range before the strategy acts on its close
+    if (config_.use_intrabar_execution && current_position.quantity > 0) {
+        state.fills.clear();
+        execution_.process_bar(current_data, state.fills);
+        
+        for (const Fill& fill : state.fills) {
+            settle_fill(fill, current_data, current_position, portfolio, risk_manager);
+            state.bracket_group = 0;
+        }
+    }
+    
+    TradingSignal signal;
+    try {
+        signal = strategy.generate_signal(current_data, current_position);
+    } catch (const std::invalid_argument&) {
+        // A bar the strategy cannot use yet is skipped
+        return;
+    } catch (const std::logic_error&) {
+        // Any other logic error (an indicator cache out of step with the
+        // data, say) is a bug that must not turn the run into all-HOLD
+        throw;
+    } catch (const std::exception&) {
+        return;
+    }
+    
+    // Sells close the open position; without one there is nothing to sell
+    bool has_exposure = signal.type != SignalType::SELL || current_position.quantity > 0;
+    
+    if (signal.type != SignalType::HOLD && has_exposure &&
+        risk_manager.validate_trade(signal, portfolio)) {
+        
+        if (signal.type == SignalType::BUY) {
+            signal.quantity = risk_manager.calculate_position_size(signal, portfolio, current_data);
+        } else {
+            signal.quantity = current_position.quantity;
+        }
+        
+        
+        Trade trade;
+        execute_trade(trade, signal, current_data, portfolio);
+        settle_trade(trade, signal.type, current_data, current_position, portfolio, risk_manager);
+        
+        if (config_.use_intrabar_execution) {
+            // Re-bracket the whole position around its new average price
+            execution_.cancel_group(state.bracket_group);
+            state.bracket_group = 0;
+            
+            if (current_position.quantity > 0) {
+                const RiskParameters& risk = risk_manager.get_risk_parameters();
+                state.bracket_group = execution_.submit_bracket(
+                    OrderSide::SELL, current_position.quantity,
+                    current_position.avg_price * (1.0 - risk.stop_loss_pct),
+                    current_position.avg_price * (1.0 + risk.take_profit_pct));
+            }
+        }
+    }
+    
+    // Check for risk-based position closures (stop-loss, take-profit) at the close
+    if (!config_.use_intrabar_execution && current_position.quantity > 0 && 
+        risk_manager.should_close_position(current_position, current_data, portfolio)) {
+        
+        // Create sell signal for position closure
+        TradingSignal close_signal;
+        close_signal.type = SignalType::SELL;
+        close_signal.price = current_data.close;
+        close_signal.quantity = current_position.quantity;
+        close_signal.timestamp = current_data.timestamp;
+        close_signal.reason = "Risk management closure (stop-loss/take-profit)";
+        
+        // Execute the closure trade
+        Trade close_trade;
+        execute_trade(close_trade, close_signal, current_data, portfolio);
+        settle_trade(close_trade, SignalType::SELL, current_data, current_position, portfolio, risk_manager);
+    }
+    
+    // Mark the open position to market and update equity curve
+    portfolio.total_value = portfolio.cash + current_position.quantity * current_data.close;
+    update_equity_curve(portfolio.total_value);
+}
+
+std::vector<std::unique_ptr<Backtester>> Backtester::begin_runs(const std::vector<StrategyRun>& runs,
+                                                                std::vector<BacktestState>& states) {
+    std::vector<std::unique_ptr<Backtester>> lanes;
+    lanes.reserve(runs.size());
+    states.assign(runs.size(), BacktestState());
+    
+    for (size_t k = 0; k < runs.size(); ++k) {
+        if (!runs[k].strategy || !runs[k].risk_manager) {
+            throw std::invalid_argument("Null pointer provided to run_backtests");
+        }
+        for (size_t j = 0; j < k; ++j) {
+            if (runs[j].strategy == runs[k].strategy || runs[j].risk_manager == runs[k].risk_manager) {
+                throw std::invalid_argument("Runs must not share a strategy or risk manager");
+            }
+        }
+        
+        lanes.emplace_back(new Backtester());
+        if (!lanes.back()->initialize(runs[k].config)) {
+            throw std::invalid_argument("Invalid backtest configuration for run " + std::to_string(k));
+        }
+        lanes.back()->begin_run(states[k]);
+        runs[k].strategy->reset();
+        runs[k].risk_manager->reset();
+    }
+    return lanes;
+}
+
+void Backtester::process_lanes(const std::vector<std::unique_ptr<Backtester>>& lanes,
+                               const std::vector<StrategyRun>& runs, std::vector<BacktestState>& states,
+                               const MarketData* bars, size_t count) {
+    WorkStealingPool& pool = WorkStealingPool::shared();
+    size_t groups = std::min(lanes.size(), pool.get_thread_count());
+    
+    // Contiguous lane ranges; a group's lanes stay on one thread for the whole pass
+    parallel_for(pool, groups, groups, [&](size_t g) {
+        size_t first = lanes.size() * g / groups;
+        size_t last = lanes.size() * (g + 1) / groups;
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t k = first; k < last; ++k) {
+                lanes[k]->process_bar(bars[i], *runs[k].strategy, *runs[k].risk_manager, states[k]);
+            }
+        }
+    });
+}
+
+void Backtester::end_run() {
+    // Calculate final statistics
+    calculate_statistics();
+}
+
 void Backtester::execute_trade(Trade& trade, const TradingSignal& signal, 
                               const MarketData& data, PortfolioState& portfolio) {
     // Fill trade details
     trade.timestamp = signal.timestamp;
+    trade.epoch = data.epoch;
     trade.price = signal.price;
     trade.quantity = signal.quantity;
     
@@ -161,105 +377,173 @@ void Backtester::execute_trade(Trade& trade, const TradingSignal& signal,
     double trade_value = trade.price * trade.quantity;
     trade.commission = trade_value * config_.commission_rate;
     
-    // TODO: Calculate P&L for the trade
-    // For now, set to 0 - will be calculated in statistics
+    // settle_trade fills in the realized P&L of sells against the position
     trade.pnl = 0.0;
 }
 
-void Backtester::update_equity_curve(double current_value) {
-    results_.equity_curve.push_back(current_value);
-}
-
-void Backtester::calculate_statistics() {
-    if (results_.trades.empty()) {
-        return; // No trades to analyze
+void Backtester::settle_trade(Trade& trade, SignalType type, const MarketData& data,
+                              Position& position, PortfolioState& portfolio, RiskManager& risk_manager) {
+    if (type == SignalType::BUY) {
+        double new_quantity = position.quantity + trade.quantity;
+        if (new_quantity > 0) {
+            position.avg_price = (position.avg_price * position.quantity +
+                                  trade.price * trade.quantity) / new_quantity;
+        }
+        position.quantity = new_quantity;
+        position.symbol = "STOCK"; // Simplified - should track actual symbol
+    } else if (type == SignalType::SELL) {
+        trade.pnl = (trade.price - position.avg_price) * trade.quantity - trade.commission;
+        position.quantity -= trade.quantity;
+        if (position.quantity <= 0) {
+            position.quantity = 0.0;
+            position.avg_price = 0.0;
+        }
     }
     
-    // TODO: Implement comprehensive statistics calculation
-    // 1. Calculate total return
-    // 2. Calculate win rate
-    // 3. Calculate Sharpe ratio
-    // 4. Calculate maximum drawdown
-    // 5. Calculate profit factor
+    // Portfolio cash moves at the fill price, net of commission
+    TradingSignal fill_signal;
+    fill_signal.type = type;
+    fill_signal.price = trade.price;
+    fill_signal.quantity = trade.quantity;
+    fill_signal.timestamp = trade.timestamp;
+    risk_manager.update_portfolio_state(portfolio, fill_signal, data);
+    portfolio.cash -= trade.commission;
     
-    results_.total_trades = static_cast<int>(results_.trades.size());
+    // Record the trade
+    record_trade(trade);
+}
+
+void Backtester::settle_fill(const Fill& fill, const MarketData& data, Position& position,
+                             PortfolioState& portfolio, RiskManager& risk_manager) {
+    bool buy = fill.side == OrderSide::BUY;
     
-    // Count winning and losing trades
-    for (const auto& trade : results_.trades) {
-        if (trade.pnl > 0) {
-            results_.winning_trades++;
-        } else if (trade.pnl < 0) {
-            results_.losing_trades++;
-        }
-    }
+    Trade trade;
+    trade.timestamp = fill.timestamp;
+    trade.epoch = data.epoch;
+    trade.action = buy ? "BUY" : "SELL";
+    trade.price = fill.price;
+    trade.quantity = buy ? fill.quantity : std::min(fill.quantity, position.quantity);
+    trade.commission = trade.price * trade.quantity * config_.commission_rate;
     
-    // Calculate win rate
-    if (results_.total_trades > 0) {
-        results_.win_rate = static_cast<double>(results_.winning_trades) / results_.total_trades;
+    if (trade.quantity > 0.0) {
+        settle_trade(trade, buy ? SignalType::BUY : SignalType::SELL, data, position, portfolio, risk_manager);
     }
-    
-    // Calculate total return
-    if (!results_.equity_curve.empty() && config_.initial_capital > 0) {
-        double final_value = results_.equity_curve.back();
-        results_.total_return = (final_value - config_.initial_capital) / config_.initial_capital;
-    }
-    
-    // Calculate maximum drawdown
-    if (!results_.equity_curve.empty()) {
-        results_.max_drawdown = calculate_max_drawdown(results_.equity_curve);
+}
+
+void Backtester::record_trade(const Trade& trade) {
+    stats_.add_trade(trade);
+    if (config_.record_trades) {
+        results_.trades.push_back(trade);
     }
-    
-    // TODO: Calculate additional metrics
-    // - Annualized return
-    // - Sharpe ratio
-    // - Average win/loss
-    // - Profit factor
 }
 
-double Backtester::calculate_sharpe_ratio(const std::vector<double>& returns) {
-    if (returns.size() < 2) {
-        return 0.0;
+void Backtester::update_equity_curve(double current_value) {
+    stats_.add_equity_point(current_value);
+    if (config_.record_equity_curve) {
+        results_.equity_curve.push_back(current_value);
     }
+}
+
+void Backtester::calculate_statistics() {
+    stats_.finalize(results_, config_.periods_per_year);
+}
+
+// PerformanceAccumulator
+
+PerformanceAccumulator::PerformanceAccumulator() {
+    reset(0.0);
+}
+
+void PerformanceAccumulator::reset(double initial_capital) {
+    initial_capital_ = initial_capital;
+    last_equity_ = initial_capital;
+    peak_equity_ = initial_capital;
+    max_drawdown_ = 0.0;
+    equity_points_ = 0;
     
-    // Calculate mean return
-    double mean_return = std::accumulate(returns.begin(), returns.end(), 0.0) / returns.size();
+    return_count_ = 0;
+    return_mean_ = 0.0;
+    return_m2_ = 0.0;
     
-    // Calculate standard deviation
-    double variance = 0.0;
-    for (double ret : returns) {
-        variance += std::pow(ret - mean_return, 2);
+    total_trades_ = 0;
+    winning_trades_ = 0;
+    losing_trades_ = 0;
+    gross_profit_ = 0.0;
+    gross_loss_ = 0.0;
+}
+
+void PerformanceAccumulator::add_equity_point(double equity) {
+    // Per-bar return against the previous point (the first bar is measured
+    // against initial capital)
+    if (last_equity_ > 0.0) {
+        double ret = (equity - last_equity_) / last_equity_;
+        ++return_count_;
+        double delta = ret - return_mean_;
+        return_mean_ += delta / static_cast<double>(return_count_);
+        return_m2_ += delta * (ret - return_mean_);
     }
-    variance /= (returns.size() - 1);
-    double std_dev = std::sqrt(variance);
     
-    if (std_dev == 0.0) {
-        return 0.0;
+    if (equity > peak_equity_) {
+        peak_equity_ = equity;
+    } else if (peak_equity_ > 0.0) {
+        double drawdown = (peak_equity_ - equity) / peak_equity_;
+        if (drawdown > max_drawdown_) {
+            max_drawdown_ = drawdown;
+        }
     }
     
-    // Assume risk-free rate of 0 for simplicity
-    return mean_return / std_dev;
+    last_equity_ = equity;
+    ++equity_points_;
 }
 
-double Backtester::calculate_max_drawdown(const std::vector<double>& equity_curve) {
-    if (equity_curve.empty()) {
-        return 0.0;
+void PerformanceAccumulator::add_trade(const Trade& trade) {
+    ++total_trades_;
+    
+    if (trade.pnl > 0) {
+        ++winning_trades_;
+        gross_profit_ += trade.pnl;
+    } else if (trade.pnl < 0) {
+        ++losing_trades_;
+        gross_loss_ -= trade.pnl;
     }
+}
+
+void PerformanceAccumulator::finalize(BacktestResults& results, double periods_per_year) const {
+    results.total_trades = total_trades_;
+    results.winning_trades = winning_trades_;
+    results.losing_trades = losing_trades_;
     
-    double max_drawdown = 0.0;
-    double peak = equity_curve[0];
+    // Win rate over closed (realized) trades
+    int closed_trades = winning_trades_ + losing_trades_;
+    results.win_rate = closed_trades > 0 ?
+        static_cast<double>(winning_trades_) / closed_trades : 0.0;
     
-    for (double value : equity_curve) {
-        if (value > peak) {
-            peak = value;
-        }
+    results.avg_win = winning_trades_ > 0 ? gross_profit_ / winning_trades_ : 0.0;
+    results.avg_loss = losing_trades_ > 0 ? gross_loss_ / losing_trades_ : 0.0;
+    
+    // Undefined without losses; reported as 0 rather than infinity
+    results.profit_factor = gross_loss_ > 0.0 ? gross_profit_ / gross_loss_ : 0.0;
+    
+    results.max_drawdown = max_drawdown_;
+    
+    if (equity_points_ > 0 && initial_capital_ > 0.0) {
+        results.total_return = (last_equity_ - initial_capital_) / initial_capital_;
         
-        double drawdown = (peak - value) / peak;
-        if (drawdown > max_drawdown) {
-            max_drawdown = drawdown;
+        double growth = last_equity_ / initial_capital_;
+        if (growth > 0.0 && periods_per_year > 0.0) {
+            results.annualized_return =
+                std::pow(growth, periods_per_year / static_cast<double>(equity_points_)) - 1.0;
         }
     }
     
-    return max_drawdown;
+    // Annualized Sharpe ratio, risk-free rate assumed 0
+    if (return_count_ >= 2) {
+        double variance = return_m2_ / static_cast<double>(return_count_ - 1);
+        double std_dev = std::sqrt(variance);
+        if (std_dev > 0.0) {
+            results.sharpe_ratio = return_mean_ / std_dev * std::sqrt(periods_per_year);
+        }
+    }
 }
 
 } // namespace TradingBot
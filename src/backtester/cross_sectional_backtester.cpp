@@ -0,0 +1,253 @@
+#include "backtester/cross_sectional_backtester.h"
+#include "utils/time_utils.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace TradingBot {
+
+UniverseData UniverseData::align(const std::vector<std::string>& symbols,
+                                 const std::vector<const std::vector<MarketData>*>& series) {
+    if (symbols.size() != series.size()) {
+        throw std::invalid_argument("UniverseData::align needs one series per symbol");
+    }
+
+    UniverseData universe;
+    universe.symbols = symbols;
+
+    // The clock is every time any symbol has a bar
+    size_t total = 0;
+    for (const std::vector<MarketData>* bars : series) {
+        if (!bars) {
+            throw std::invalid_argument("Null series provided to UniverseData::align");
+        }
+        total += bars->size();
+    }
+    std::vector<int64_t>& epochs = universe.epochs;
+    epochs.reserve(total);
+    for (size_t s = 0; s < series.size(); ++s) {
+        for (const MarketData& bar : *series[s]) {
+            int64_t epoch;
+            if (!get_epoch(bar, epoch)) {
+                throw std::invalid_argument("Bar without a time in the series for " + symbols[s]);
+            }
+            epochs.push_back(epoch);
+        }
+    }
+    std::sort(epochs.begin(), epochs.end());
+    epochs.erase(std::unique(epochs.begin(), epochs.end()), epochs.end());
+
+    size_t width = symbols.size();
+    universe.closes.assign(epochs.size() * width, std::numeric_limits<double>::quiet_NaN());
+    for (size_t s = 0; s < series.size(); ++s) {
+        // Each series is in time order, so its row only moves forward
+        size_t row = 0;
+        for (const MarketData& bar : *series[s]) {
+            int64_t epoch;
+            get_epoch(bar, epoch);
+            if (row >= epochs.size() || epochs[row] > epoch) {
+                row = 0;
+            }
+            row = std::lower_bound(epochs.begin() + row, epochs.end(), epoch) - epochs.begin();
+            universe.closes[row * width + s] = bar.close;
+        }
+    }
+    return universe;
+}
+
+namespace {
+
+const int64_t kSecondsPerDay = 86400;
+
+} // namespace
+
+CrossSectionalBacktester::CrossSectionalBacktester() : rebalance_period_(1), rejected_orders_(0) {}
+
+CrossSectionalBacktester::~CrossSectionalBacktester() {}
+
+void CrossSectionalBacktester::set_rebalance_period(size_t bars) {
+    rebalance_period_ = bars > 0 ? bars : 1;
+}
+
+size_t CrossSectionalBacktester::get_rebalance_period() const {
+    return rebalance_period_;
+}
+
+bool CrossSectionalBacktester::set_portfolio_risk(const PortfolioRiskLimits& limits) {
+    PortfolioRiskEngine check;
+    if (!check.initialize(limits, config_.initial_capital)) {
+        return false;
+    }
+    risk_limits_ = limits;
+    return true;
+}
+
+void CrossSectionalBacktester::clear_portfolio_risk() {
+    risk_limits_.reset();
+}
+
+size_t CrossSectionalBacktester::get_rejected_orders() const {
+    return rejected_orders_;
+}
+
+const std::vector<double>& CrossSectionalBacktester::get_holdings() const {
+    return holdings_;
+}
+
+BacktestResults CrossSectionalBacktester::run_universe_backtest(std::shared_ptr<CrossSectionalStrategy> strategy,
+                                                                const UniverseData& universe) {
+    if (!strategy) {
+        throw std::invalid_argument("Null pointer provided to run_universe_backtest");
+    }
+    if (universe.closes.size() != universe.bar_count() * universe.symbol_count()) {
+        throw std::invalid_argument("Universe closes do not match its bars and symbols");
+    }
+
+    BacktestState state;
+    begin_run(state);
+    PortfolioState& portfolio = state.portfolio;
+
+    const size_t symbols = universe.symbol_count();
+    strategy->reset(symbols);
+    holdings_.assign(symbols, 0.0);
+    avg_cost_.assign(symbols, 0.0);
+    prices_.assign(symbols, 0.0);
+    targets_.assign(symbols, 0.0);
+
+    rejected_orders_ = 0;
+    int64_t risk_day = 0;
+    if (risk_limits_) {
+        if (!risk_.initialize(*risk_limits_, config_.initial_capital)) {
+            throw std::invalid_argument("Portfolio risk limits do not fit the initial capital");
+        }
+        for (const std::string& symbol : universe.symbols) {
+            risk_.add_symbol(symbol);
+        }
+        if (risk_.symbol_count() != symbols) {
+            throw std::invalid_argument("Universe lists a symbol twice");
+        }
+        quotes_.resize(symbols);
+    }
+
+    for (size_t index = 0; index < universe.bar_count(); ++index) {
+        const double* closes = universe.bar(index);
+        int64_t epoch = universe.epochs[index];
+
+        for (size_t s = 0; s < symbols; ++s) {
+            if (closes[s] > 0.0) {
+                prices_[s] = closes[s];
+            }
+        }
+
+        if (risk_limits_) {
+            // NaN closes count as no quote
+            std::copy(closes, closes + symbols, quotes_.begin());
+            risk_.update_prices(quotes_);
+            int64_t day = epoch / kSecondsPerDay - (epoch % kSecondsPerDay < 0);
+            if (index == 0 || day != risk_day) {
+                risk_day = day;
+                risk_.start_day();
+            }
+        }
+
+        // Rank every bar so the strategy's indicators see every close
+        const std::vector<uint32_t>& picks = strategy->rank(closes);
+
+        if (index % rebalance_period_ == 0) {
+            double equity = portfolio.cash;
+            for (size_t s = 0; s < symbols; ++s) {
+                equity += holdings_[s] * prices_[s];
+            }
+
+            // Equal weight per slot; while fewer than top_k symbols rank, the
+            // empty slots stay in cash
+            double slot_value = equity / static_cast<double>(strategy->get_top_k());
+            std::fill(targets_.begin(), targets_.end(), 0.0);
+            for (uint32_t s : picks) {
+                targets_[s] = std::floor(slot_value / prices_[s]);
+            }
+
+            // Sells first so their cash funds the buys; only quoted symbols trade
+            for (size_t s = 0; s < symbols; ++s) {
+                if (holdings_[s] > targets_[s] && closes[s] > 0.0) {
+                    fill(s, targets_[s] - holdings_[s], closes[s], epoch, portfolio, universe);
+                }
+            }
+            for (uint32_t s : picks) {
+                if (targets_[s] > holdings_[s] && closes[s] > 0.0) {
+                    fill(s, targets_[s] - holdings_[s], closes[s], epoch, portfolio, universe);
+                }
+            }
+        }
+
+        // Mark every holding to its last quote
+        double value = portfolio.cash;
+        for (size_t s = 0; s < symbols; ++s) {
+            value += holdings_[s] * prices_[s];
+        }
+        portfolio.total_value = value;
+        update_equity_curve(value);
+    }
+
+    end_run();
+
+    return results_;
+}
+
+void CrossSectionalBacktester::fill(size_t symbol, double quantity, double price, int64_t epoch,
+                                    PortfolioState& portfolio, const UniverseData& universe) {
+    Trade trade;
+    trade.epoch = epoch;
+
+    if (quantity > 0.0) {
+        trade.action = "BUY";
+        trade.price = price * (1.0 + config_.slippage);
+
+        // Buy no more than the cash covers, commission included
+        double affordable = std::floor(portfolio.cash / (trade.price * (1.0 + config_.commission_rate)));
+        trade.quantity = std::min(quantity, affordable);
+        if (trade.quantity <= 0.0) {
+            return;
+        }
+        if (risk_limits_ && risk_.check_order(symbol, trade.quantity) != RiskCheckResult::ACCEPTED) {
+            ++rejected_orders_;
+            return;
+        }
+        trade.commission = trade.price * trade.quantity * config_.commission_rate;
+
+        double held = holdings_[symbol] + trade.quantity;
+        avg_cost_[symbol] = (avg_cost_[symbol] * holdings_[symbol] + trade.price * trade.quantity) / held;
+        holdings_[symbol] = held;
+        portfolio.cash -= trade.price * trade.quantity + trade.commission;
+    } else {
+        trade.action = "SELL";
+        trade.price = price * (1.0 - config_.slippage);
+        trade.quantity = -quantity;
+        trade.commission = trade.price * trade.quantity * config_.commission_rate;
+        trade.pnl = (trade.price - avg_cost_[symbol]) * trade.quantity - trade.commission;
+
+        holdings_[symbol] -= trade.quantity;
+        if (holdings_[symbol] <= 0.0) {
+            holdings_[symbol] = 0.0;
+            avg_cost_[symbol] = 0.0;
+        }
+        portfolio.cash += trade.price * trade.quantity - trade.commission;
+        portfolio.realized_pnl += trade.pnl;
+    }
+
+    // Book at the all-in price so the engine's cash matches the portfolio's
+    if (risk_limits_) {
+        double sign = quantity > 0.0 ? 1.0 : -1.0;
+        risk_.apply_fill(symbol, sign * trade.quantity, trade.price + sign * trade.commission / trade.quantity);
+    }
+
+    // Statistics only need the numbers; the labels are for recorded trades
+    if (config_.record_trades) {
+        trade.timestamp = TimeUtils::format_timestamp(epoch);
+        trade.symbol = universe.symbols[symbol];
+    }
+    record_trade(trade);
+}
+
+} // namespace TradingBot
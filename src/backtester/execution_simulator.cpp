@@ -0,0 +1,291 @@
+#include "backtester/execution_simulator.h"
+#include <stdexcept>
+
+namespace TradingBot {
+
+ExecutionSimulator::ExecutionSimulator()
+    : next_order_id_(1), next_group_id_(1), slippage_(0.0) {
+}
+
+ExecutionSimulator::~ExecutionSimulator() {
+}
+
+void ExecutionSimulator::set_slippage(double slippage) {
+    slippage_ = slippage;
+}
+
+Fill ExecutionSimulator::execute_market(OrderSide side, double quantity, double reference_price,
+                                        const std::string& timestamp, const std::string& tag) {
+    Fill result;
+    result.order_id = next_order_id_++;
+    result.type = OrderType::MARKET;
+    result.side = side;
+    result.quantity = quantity;
+    result.timestamp = timestamp;
+    result.tag = tag;
+
+    // Buy at higher price, sell at lower price
+    result.price = side == OrderSide::BUY ? reference_price * (1.0 + slippage_)
+                                          : reference_price * (1.0 - slippage_);
+    return result;
+}
+
+uint64_t ExecutionSimulator::submit_limit(OrderSide side, double quantity, double limit_price,
+                                          const std::string& tag) {
+    Order order;
+    order.type = OrderType::LIMIT;
+    order.side = side;
+    order.price = limit_price;
+    order.quantity = quantity;
+    order.tag = tag;
+    return rest(order);
+}
+
+uint64_t ExecutionSimulator::submit_stop(OrderSide side, double quantity, double stop_price,
+                                         const std::string& tag) {
+    Order order;
+    order.type = OrderType::STOP;
+    order.side = side;
+    order.price = stop_price;
+    order.quantity = quantity;
+    order.tag = tag;
+    return rest(order);
+}
+
+uint64_t ExecutionSimulator::submit_bracket(OrderSide exit_side, double quantity,
+                                            double stop_price, double take_profit_price) {
+    // A long exit stops out below the take-profit; a short exit above it
+    bool long_exit = exit_side == OrderSide::SELL;
+    if (long_exit ? stop_price >= take_profit_price : stop_price <= take_profit_price) {
+        throw std::invalid_argument("Bracket stop must be on the losing side of take-profit");
+    }
+
+    uint64_t group = next_group_id_++;
+
+    Order stop;
+    stop.type = OrderType::STOP;
+    stop.side = exit_side;
+    stop.price = stop_price;
+    stop.quantity = quantity;
+    stop.oco_group = group;
+    stop.tag = "stop_loss";
+
+    Order target = stop;
+    target.type = OrderType::LIMIT;
+    target.price = take_profit_price;
+    target.tag = "take_profit";
+
+    oco_groups_[group] = {rest(stop), rest(target)};
+    return group;
+}
+
+bool ExecutionSimulator::cancel(uint64_t order_id) {
+    if (orders_.find(order_id) == orders_.end()) {
+        return false;
+    }
+    remove(order_id);
+    return true;
+}
+
+void ExecutionSimulator::cancel_group(uint64_t oco_group) {
+    auto group = oco_groups_.find(oco_group);
+    if (group == oco_groups_.end()) {
+        return;
+    }
+
+    std::vector<uint64_t> members;
+    members.swap(group->second);
+    oco_groups_.erase(group);
+
+    for (uint64_t order_id : members) {
+        cancel(order_id);
+    }
+}
+
+void ExecutionSimulator::cancel_all() {
+    buy_limits_.clear();
+    sell_stops_.clear();
+    sell_limits_.clear();
+    buy_stops_.clear();
+    orders_.clear();
+    oco_groups_.clear();
+}
+
+void ExecutionSimulator::process_bar(const MarketData& bar, std::vector<Fill>& fills) {
+    if (orders_.empty()) {
+        return;
+    }
+
+    process_open(bar, fills);
+
+    if (bar.close >= bar.open) {
+        // Up bar: O -> L -> H -> C
+        process_falling(bar.open, bar.low, bar.timestamp, fills);
+        process_rising(bar.low, bar.high, bar.timestamp, fills);
+        process_falling(bar.high, bar.close, bar.timestamp, fills);
+    } else {
+        // Down bar: O -> H -> L -> C
+        process_rising(bar.open, bar.high, bar.timestamp, fills);
+        process_falling(bar.high, bar.low, bar.timestamp, fills);
+        process_rising(bar.low, bar.close, bar.timestamp, fills);
+    }
+}
+
+size_t ExecutionSimulator::pending_count() const {
+    return orders_.size();
+}
+
+const Order* ExecutionSimulator::find_order(uint64_t order_id) const {
+    auto it = orders_.find(order_id);
+    return it != orders_.end() ? &it->second.order : nullptr;
+}
+
+// Private helper methods
+
+uint64_t ExecutionSimulator::rest(const Order& order) {
+    if (order.quantity <= 0.0) {
+        throw std::invalid_argument("Order quantity must be positive");
+    }
+
+    RestingOrder entry;
+    entry.order = order;
+    entry.order.id = next_order_id_++;
+
+    uint64_t id = entry.order.id;
+    bool buy = order.side == OrderSide::BUY;
+
+    if (order.type == OrderType::LIMIT) {
+        if (buy) {
+            entry.descending_position = buy_limits_.emplace(order.price, id);
+        } else {
+            entry.ascending_position = sell_limits_.emplace(order.price, id);
+        }
+    } else if (order.type == OrderType::STOP) {
+        if (buy) {
+            entry.ascending_position = buy_stops_.emplace(order.price, id);
+        } else {
+            entry.descending_position = sell_stops_.emplace(order.price, id);
+        }
+    } else {
+        throw std::invalid_argument("Market orders do not rest");
+    }
+
+    orders_.emplace(id, entry);
+    return id;
+}
+
+void ExecutionSimulator::remove(uint64_t order_id) {
+    auto it = orders_.find(order_id);
+    if (it == orders_.end()) {
+        return;
+    }
+
+    const Order& order = it->second.order;
+    bool buy = order.side == OrderSide::BUY;
+
+    if (order.type == OrderType::LIMIT) {
+        if (buy) {
+            buy_limits_.erase(it->second.descending_position);
+        } else {
+            sell_limits_.erase(it->second.ascending_position);
+        }
+    } else {
+        if (buy) {
+            buy_stops_.erase(it->second.ascending_position);
+        } else {
+            sell_stops_.erase(it->second.descending_position);
+        }
+    }
+
+    orders_.erase(it);
+}
+
+void ExecutionSimulator::fill(uint64_t order_id, double price, const std::string& timestamp,
+                              std::vector<Fill>& fills) {
+    auto it = orders_.find(order_id);
+    if (it == orders_.end()) {
+        return;
+    }
+
+    const Order& order = it->second.order;
+    Fill result;
+    result.order_id = order.id;
+    result.type = order.type;
+    result.side = order.side;
+    result.price = price;
+    result.quantity = order.quantity;
+    result.timestamp = timestamp;
+    result.tag = order.tag;
+    fills.push_back(result);
+
+    uint64_t group = order.oco_group;
+    remove(order_id);
+
+    if (group != 0) {
+        cancel_group(group);
+    }
+}
+
+void ExecutionSimulator::process_open(const MarketData& bar, std::vector<Fill>& fills) {
+    const double open = bar.open;
+
+    while (!buy_limits_.empty() && buy_limits_.begin()->first >= open) {
+        fill(buy_limits_.begin()->second, open, bar.timestamp, fills);
+    }
+    while (!sell_limits_.empty() && sell_limits_.begin()->first <= open) {
+        fill(sell_limits_.begin()->second, open, bar.timestamp, fills);
+    }
+    while (!sell_stops_.empty() && sell_stops_.begin()->first >= open) {
+        fill(sell_stops_.begin()->second, open * (1.0 - slippage_), bar.timestamp, fills);
+    }
+    while (!buy_stops_.empty() && buy_stops_.begin()->first <= open) {
+        fill(buy_stops_.begin()->second, open * (1.0 + slippage_), bar.timestamp, fills);
+    }
+}
+
+void ExecutionSimulator::process_falling(double from, double to, const std::string& timestamp,
+                                         std::vector<Fill>& fills) {
+    if (to >= from) {
+        return;
+    }
+
+    // Take whichever crossed order the path reaches first; stops win ties
+    while (true) {
+        bool limit_hit = !buy_limits_.empty() && buy_limits_.begin()->first >= to;
+        bool stop_hit = !sell_stops_.empty() && sell_stops_.begin()->first >= to;
+
+        if (stop_hit && (!limit_hit || sell_stops_.begin()->first >= buy_limits_.begin()->first)) {
+            double trigger = sell_stops_.begin()->first;
+            fill(sell_stops_.begin()->second, trigger * (1.0 - slippage_), timestamp, fills);
+        } else if (limit_hit) {
+            double limit = buy_limits_.begin()->first;
+            fill(buy_limits_.begin()->second, limit, timestamp, fills);
+        } else {
+            break;
+        }
+    }
+}
+
+void ExecutionSimulator::process_rising(double from, double to, const std::string& timestamp,
+                                        std::vector<Fill>& fills) {
+    if (to <= from) {
+        return;
+    }
+
+    while (true) {
+        bool limit_hit = !sell_limits_.empty() && sell_limits_.begin()->first <= to;
+        bool stop_hit = !buy_stops_.empty() && buy_stops_.begin()->first <= to;
+
+        if (stop_hit && (!limit_hit || buy_stops_.begin()->first <= sell_limits_.begin()->first)) {
+            double trigger = buy_stops_.begin()->first;
+            fill(buy_stops_.begin()->second, trigger * (1.0 + slippage_), timestamp, fills);
+        } else if (limit_hit) {
+            double limit = sell_limits_.begin()->first;
+            fill(sell_limits_.begin()->second, limit, timestamp, fills);
+        } else {
+            break;
+        }
+    }
+}
+
+} // namespace TradingBot
@@ -0,0 +1,357 @@
+#include "backtester/order_book.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+// Levels allocated when a side sees its first quote
+const size_t kInitialLevels = 4096;
+
+// Upper bound on levels per side (128 MiB of depth)
+const size_t kMaxLevels = size_t(1) << 24;
+
+Fill make_fill(uint64_t order_id, OrderType type, OrderSide side, double price,
+               double quantity, int64_t timestamp, const std::string& tag) {
+    Fill fill;
+    fill.order_id = order_id;
+    fill.type = type;
+    fill.side = side;
+    fill.price = price;
+    fill.quantity = quantity;
+    fill.timestamp = std::to_string(timestamp);
+    fill.tag = tag;
+    return fill;
+}
+
+} // namespace
+
+OrderBook::OrderBook(double tick_size)
+    : tick_size_(tick_size), next_order_id_(1) {
+    if (tick_size <= 0.0) {
+        throw std::invalid_argument("Tick size must be positive");
+    }
+}
+
+OrderBook::~OrderBook() {
+}
+
+void OrderBook::reset() {
+    bids_ = Ladder();
+    asks_ = Ladder();
+    own_orders_.clear();
+}
+
+double OrderBook::get_tick_size() const {
+    return tick_size_;
+}
+
+void OrderBook::apply(const BookEvent& event, std::vector<Fill>& fills) {
+    if (event.type == BookEventType::QUOTE) {
+        on_quote(event, fills);
+    } else {
+        on_trade(event, fills);
+    }
+}
+
+uint64_t OrderBook::submit_limit(OrderSide side, double quantity, double price, int64_t timestamp,
+                                 std::vector<Fill>& fills, const std::string& tag) {
+    if (quantity <= 0.0 || price <= 0.0) {
+        throw std::invalid_argument("Order quantity and price must be positive");
+    }
+
+    uint64_t id = next_order_id_++;
+    int64_t tick = to_tick(price);
+
+    double filled = sweep(side, quantity, tick, id, OrderType::LIMIT, timestamp, tag, fills);
+
+    if (quantity - filled > 0.0) {
+        OwnOrder own;
+        own.order.id = id;
+        own.order.type = OrderType::LIMIT;
+        own.order.side = side;
+        own.order.price = to_price(tick);
+        own.order.quantity = quantity;
+        own.order.tag = tag;
+        own.tick = tick;
+        own.remaining = quantity - filled;
+        own.queue_ahead = level_depth(side == OrderSide::BUY ? bids_ : asks_, tick);
+        own_orders_.push_back(own);
+    }
+
+    return id;
+}
+
+uint64_t OrderBook::submit_market(OrderSide side, double quantity, int64_t timestamp,
+                                  std::vector<Fill>& fills, const std::string& tag) {
+    if (quantity <= 0.0) {
+        throw std::invalid_argument("Order quantity must be positive");
+    }
+
+    uint64_t id = next_order_id_++;
+    int64_t limit_tick = side == OrderSide::BUY ? std::numeric_limits<int64_t>::max()
+                                                : std::numeric_limits<int64_t>::min();
+    sweep(side, quantity, limit_tick, id, OrderType::MARKET, timestamp, tag, fills);
+    return id;
+}
+
+bool OrderBook::cancel(uint64_t order_id) {
+    for (auto it = own_orders_.begin(); it != own_orders_.end(); ++it) {
+        if (it->order.id == order_id) {
+            own_orders_.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void OrderBook::cancel_all() {
+    own_orders_.clear();
+}
+
+bool OrderBook::has_bid() const {
+    return bids_.levels > 0;
+}
+
+bool OrderBook::has_ask() const {
+    return asks_.levels > 0;
+}
+
+double OrderBook::best_bid() const {
+    return bids_.levels > 0 ? to_price(bids_.best) : 0.0;
+}
+
+double OrderBook::best_ask() const {
+    return asks_.levels > 0 ? to_price(asks_.best) : 0.0;
+}
+
+double OrderBook::depth(BookSide side, double price) const {
+    return level_depth(side == BookSide::BID ? bids_ : asks_, to_tick(price));
+}
+
+double OrderBook::remaining(uint64_t order_id) const {
+    for (const OwnOrder& own : own_orders_) {
+        if (own.order.id == order_id) {
+            return own.remaining;
+        }
+    }
+    return 0.0;
+}
+
+double OrderBook::queue_ahead(uint64_t order_id) const {
+    for (const OwnOrder& own : own_orders_) {
+        if (own.order.id == order_id) {
+            return own.queue_ahead;
+        }
+    }
+    return -1.0;
+}
+
+size_t OrderBook::own_order_count() const {
+    return own_orders_.size();
+}
+
+// Private helper methods
+
+int64_t OrderBook::to_tick(double price) const {
+    return std::llround(price / tick_size_);
+}
+
+double OrderBook::to_price(int64_t tick) const {
+    return static_cast<double>(tick) * tick_size_;
+}
+
+void OrderBook::ensure_tick(Ladder& ladder, int64_t tick) {
+    if (ladder.depth.empty()) {
+        ladder.base = tick - static_cast<int64_t>(kInitialLevels / 2);
+        ladder.depth.assign(kInitialLevels, 0.0);
+        return;
+    }
+
+    int64_t top = ladder.base + static_cast<int64_t>(ladder.depth.size());
+    if (tick >= ladder.base && tick < top) {
+        return;
+    }
+
+    // Re-center with headroom on both sides so drifting prices grow rarely
+    int64_t low = std::min(ladder.base, tick);
+    int64_t high = std::max(top - 1, tick);
+    size_t span = static_cast<size_t>(high - low + 1);
+    size_t new_size = std::max(ladder.depth.size() * 2, span * 2);
+    if (new_size > kMaxLevels) {
+        throw std::out_of_range("Price outside order book range");
+    }
+
+    int64_t new_base = low - static_cast<int64_t>((new_size - span) / 2);
+    std::vector<double> depth(new_size, 0.0);
+    std::copy(ladder.depth.begin(), ladder.depth.end(), depth.begin() + (ladder.base - new_base));
+    ladder.depth.swap(depth);
+    ladder.base = new_base;
+}
+
+double OrderBook::level_depth(const Ladder& ladder, int64_t tick) const {
+    int64_t index = tick - ladder.base;
+    if (index < 0 || index >= static_cast<int64_t>(ladder.depth.size())) {
+        return 0.0;
+    }
+    return ladder.depth[static_cast<size_t>(index)];
+}
+
+void OrderBook::set_level(Ladder& ladder, bool bid_side, int64_t tick, double quantity) {
+    if (quantity > 0.0) {
+        ensure_tick(ladder, tick);
+    } else if (level_depth(ladder, tick) <= 0.0) {
+        return;
+    }
+
+    size_t index = static_cast<size_t>(tick - ladder.base);
+    double old = ladder.depth[index];
+    ladder.depth[index] = quantity > 0.0 ? quantity : 0.0;
+
+    if (old <= 0.0 && quantity > 0.0) {
+        if (ladder.levels++ == 0 || (bid_side ? tick > ladder.best : tick < ladder.best)) {
+            ladder.best = tick;
+        }
+    } else if (old > 0.0 && quantity <= 0.0) {
+        if (--ladder.levels > 0 && tick == ladder.best) {
+            // Walk away from the spread to the next non-empty level
+            if (bid_side) {
+                while (ladder.depth[--index] <= 0.0) {}
+            } else {
+                while (ladder.depth[++index] <= 0.0) {}
+            }
+            ladder.best = ladder.base + static_cast<int64_t>(index);
+        }
+    }
+}
+
+double OrderBook::sweep(OrderSide side, double quantity, int64_t limit_tick, uint64_t order_id,
+                        OrderType type, int64_t timestamp, const std::string& tag,
+                        std::vector<Fill>& fills) {
+    bool buy = side == OrderSide::BUY;
+    Ladder& opposite = buy ? asks_ : bids_;
+    double filled = 0.0;
+
+    while (filled < quantity && opposite.levels > 0) {
+        int64_t tick = opposite.best;
+        if (buy ? tick > limit_tick : tick < limit_tick) {
+            break;
+        }
+
+        double available = level_depth(opposite, tick);
+        double take = std::min(available, quantity - filled);
+        fills.push_back(make_fill(order_id, type, side, to_price(tick), take, timestamp, tag));
+        set_level(opposite, !buy, tick, available - take);
+        filled += take;
+    }
+
+    return filled;
+}
+
+void OrderBook::on_quote(const BookEvent& event, std::vector<Fill>& fills) {
+    int64_t tick = to_tick(event.price);
+    bool bid_side = event.side == BookSide::BID;
+    Ladder& ladder = bid_side ? bids_ : asks_;
+    set_level(ladder, bid_side, tick, event.quantity);
+
+    if (own_orders_.empty()) {
+        return;
+    }
+
+    bool filled = false;
+    for (OwnOrder& own : own_orders_) {
+        bool own_bid = own.order.side == OrderSide::BUY;
+
+        if (own_bid == bid_side) {
+            // Size leaving the level can only shorten the queue ahead of us
+            if (own.tick == tick && own.queue_ahead > event.quantity) {
+                own.queue_ahead = event.quantity;
+            }
+        } else if (event.quantity > 0.0 && (own_bid ? tick <= own.tick : tick >= own.tick)) {
+            // Opposite side quoted through our price: trade against it
+            double available = level_depth(ladder, tick);
+            double take = std::min(own.remaining, available);
+            if (take > 0.0) {
+                fills.push_back(make_fill(own.order.id, own.order.type, own.order.side,
+                                          to_price(tick), take, event.timestamp, own.order.tag));
+                own.remaining -= take;
+                set_level(ladder, bid_side, tick, available - take);
+                filled = true;
+            }
+        }
+    }
+
+    if (filled) {
+        remove_completed();
+    }
+}
+
+void OrderBook::on_trade(const BookEvent& event, std::vector<Fill>& fills) {
+    if (own_orders_.empty()) {
+        return;
+    }
+
+    int64_t tick = to_tick(event.price);
+    bool hit_bid = event.side == BookSide::BID;
+
+    // Orders the print reaches: prints on the bid side can only fill resting
+    // buys at or above the print price, and vice versa for the ask side
+    matching_.clear();
+    for (size_t i = 0; i < own_orders_.size(); ++i) {
+        const OwnOrder& own = own_orders_[i];
+        if ((own.order.side == OrderSide::BUY) == hit_bid && (hit_bid ? own.tick >= tick : own.tick <= tick)) {
+            matching_.push_back(i);
+        }
+    }
+
+    // Price-time priority: better prices first, then submission order
+    std::stable_sort(matching_.begin(), matching_.end(), [this, hit_bid](size_t a, size_t b) {
+        return hit_bid ? own_orders_[a].tick > own_orders_[b].tick : own_orders_[a].tick < own_orders_[b].tick;
+    });
+
+    // One remainder of the printed volume is drawn down by both the queue
+    // ahead at the print price and our fills. Queues at that price overlap
+    // (each counts from the front of the level), so 'cleared' tracks what
+    // the print already ate of the shared queue.
+    double printed = event.quantity;
+    double cleared = 0.0;
+    bool filled = false;
+
+    for (size_t index : matching_) {
+        if (printed <= 0.0) {
+            break;
+        }
+        OwnOrder& own = own_orders_[index];
+
+        if (own.tick == tick) {
+            double consumed = std::min(std::max(own.queue_ahead - cleared, 0.0), printed);
+            cleared += consumed;
+            printed -= consumed;
+            own.queue_ahead = std::max(own.queue_ahead - cleared, 0.0);
+        }
+
+        double take = std::min(own.remaining, printed);
+        if (take > 0.0) {
+            fills.push_back(make_fill(own.order.id, own.order.type, own.order.side,
+                                      own.order.price, take, event.timestamp, own.order.tag));
+            own.remaining -= take;
+            printed -= take;
+            filled = true;
+        }
+    }
+
+    if (filled) {
+        remove_completed();
+    }
+}
+
+void OrderBook::remove_completed() {
+    own_orders_.erase(std::remove_if(own_orders_.begin(), own_orders_.end(),
+                                     [](const OwnOrder& own) { return own.remaining <= 0.0; }),
+                      own_orders_.end());
+}
+
+} // namespace TradingBot
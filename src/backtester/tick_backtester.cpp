@@ -0,0 +1,133 @@
+#include "backtester/tick_backtester.h"
+#include <stdexcept>
+#include <string>
+
+namespace TradingBot {
+
+TickBacktester::TickBacktester() {}
+
+TickBacktester::~TickBacktester() {}
+
+void TickBacktester::set_tick_config(const TickBacktestConfig& config) {
+    tick_config_ = config;
+    book_ = OrderBook(config.tick_size);
+}
+
+const TickBacktestConfig& TickBacktester::get_tick_config() const {
+    return tick_config_;
+}
+
+const OrderBook& TickBacktester::get_order_book() const {
+    return book_;
+}
+
+BacktestResults TickBacktester::run_tick_backtest(std::shared_ptr<Strategy> strategy,
+                                                  std::shared_ptr<TickDataParser> tick_data,
+                                                  std::shared_ptr<RiskManager> risk_manager) {
+    if (!strategy || !tick_data || !risk_manager) {
+        throw std::invalid_argument("Null pointer provided to run_tick_backtest");
+    }
+
+    BacktestState state;
+    begin_run(state);
+    strategy->reset();
+    risk_manager->reset();
+    PortfolioState& portfolio = state.portfolio;
+    Position& current_position = state.position;
+    book_.reset();
+
+    const std::vector<BookEvent>& events = tick_data->get_all_events();
+    size_t interval = tick_config_.signal_interval > 0 ? tick_config_.signal_interval : 1;
+    size_t prints = 0;
+    int64_t units = tick_config_.timestamp_units > 0 ? tick_config_.timestamp_units : 1;
+
+    // At most one working order at a time, on the side of the last signal
+    uint64_t working_order = 0;
+    OrderSide working_side = OrderSide::BUY;
+    std::vector<Fill>& fills = state.fills;
+    MarketData print;
+
+    for (const BookEvent& event : events) {
+        // Fills caused by this event happen at its time
+        print.timestamp = std::to_string(event.timestamp);
+        print.epoch = event.timestamp / units;
+        print.close = event.price;
+
+        fills.clear();
+        book_.apply(event, fills);
+        for (const Fill& fill : fills) {
+            settle_fill(fill, print, current_position, portfolio, *risk_manager);
+        }
+
+        if (event.type != BookEventType::TRADE || ++prints % interval != 0) {
+            continue;
+        }
+
+        if (working_order != 0 && book_.remaining(working_order) <= 0.0) {
+            working_order = 0;
+        }
+
+        print.open = print.high = print.low = print.close = event.price;
+        print.volume = event.quantity;
+
+        // Volatility for sizing and the trading day advance with every print
+        risk_manager->update_market_data(print, portfolio);
+
+        fills.clear();
+
+        if (current_position.quantity > 0 &&
+            risk_manager->should_close_position(current_position, print, portfolio)) {
+            // Risk exits take liquidity rather than wait in the queue
+            book_.cancel(working_order);
+            working_order = 0;
+            book_.submit_market(OrderSide::SELL, current_position.quantity, event.timestamp, fills,
+                                "risk_exit");
+        } else {
+            TradingSignal signal;
+            try {
+                signal = strategy->generate_signal(print, current_position);
+            } catch (const std::exception& e) {
+                signal.type = SignalType::HOLD;
+            }
+
+            bool buy = signal.type == SignalType::BUY;
+            bool sell = signal.type == SignalType::SELL && current_position.quantity > 0;
+
+            OrderSide side = buy ? OrderSide::BUY : OrderSide::SELL;
+            bool already_working = working_order != 0 && working_side == side;
+
+            if ((buy || sell) && !already_working && risk_manager->validate_trade(signal, portfolio)) {
+                double quantity = buy ? risk_manager->calculate_position_size(signal, portfolio, print)
+                                      : current_position.quantity;
+
+                // An opposite signal replaces whatever is still working
+                book_.cancel(working_order);
+                working_order = 0;
+
+                if (quantity > 0.0) {
+                    if (!tick_config_.passive_orders) {
+                        book_.submit_market(side, quantity, event.timestamp, fills);
+                    } else if (buy ? book_.has_bid() : book_.has_ask()) {
+                        double touch = buy ? book_.best_bid() : book_.best_ask();
+                        working_order = book_.submit_limit(side, quantity, touch, event.timestamp, fills);
+                        working_side = side;
+                    }
+                }
+            }
+        }
+
+        for (const Fill& fill : fills) {
+            settle_fill(fill, print, current_position, portfolio, *risk_manager);
+        }
+
+        // Mark the open position to the print and update equity curve
+        portfolio.total_value = portfolio.cash + current_position.quantity * event.price;
+        update_equity_curve(portfolio.total_value);
+    }
+
+    end_run();
+
+    return results_;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,276 @@
+#include "batch/batch_runner.h"
+#include "config/bot_config.h"
+#include "utils/work_stealing_pool.h"
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+struct LoadedData {
+    std::shared_ptr<CSVParser> parser;
+    std::string error;
+};
+
+// Route an override to the risk parameters, the backtest config or the
+// strategy. False with 'error' set if a config field is out of range.
+bool apply_override(const std::string& key, double value, std::map<std::string, double>& strategy_params,
+                    RiskParameters& risk, BacktestConfig& config, std::string& error) {
+    if (set_risk_parameter(risk, key, value, error) || !error.empty() ||
+        set_backtest_parameter(config, key, value, error) || !error.empty()) {
+        return error.empty();
+    }
+    strategy_params[key] = value;
+    return true;
+}
+
+} // namespace
+
+BatchRunner::BatchRunner() : data_loads_(0) {
+}
+
+bool BatchRunner::initialize(const BacktestConfig& config, const RiskParameters& risk_params) {
+    config_ = config;
+    risk_params_ = risk_params;
+    return config.initial_capital > 0.0;
+}
+
+void BatchRunner::set_session_calendar(const SessionCalendar& calendar) {
+    calendar_ = calendar;
+}
+
+bool BatchRunner::load_manifest(const std::string& filename, BatchManifest& manifest, std::string& error) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        error = "cannot open " + filename;
+        return false;
+    }
+
+    manifest = BatchManifest();
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        std::string where = filename + ":" + std::to_string(line_number) + ": ";
+
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream words(line);
+        std::string directive;
+        if (!(words >> directive)) {
+            continue;
+        }
+
+        if (directive == "data") {
+            BatchDataSet data_set;
+            if (!(words >> data_set.id >> data_set.file)) {
+                error = where + "expected 'data <id> <file>'";
+                return false;
+            }
+            manifest.data_sets.push_back(data_set);
+        } else if (directive == "strategy") {
+            std::string name;
+            size_t before = manifest.strategies.size();
+            while (words >> name) {
+                manifest.strategies.push_back(name);
+            }
+            if (manifest.strategies.size() == before) {
+                error = where + "expected at least one strategy name";
+                return false;
+            }
+        } else if (directive == "override") {
+            BatchOverride override_set;
+            if (!(words >> override_set.name)) {
+                error = where + "expected 'override <name> <key>=<value> ...'";
+                return false;
+            }
+            std::string assignment;
+            while (words >> assignment) {
+                size_t equals = assignment.find('=');
+                char* end = nullptr;
+                double value = equals == std::string::npos ? 0.0 : std::strtod(assignment.c_str() + equals + 1, &end);
+                if (equals == std::string::npos || equals == 0 || end == assignment.c_str() + equals + 1 || *end != '\0') {
+                    error = where + "bad assignment '" + assignment + "'";
+                    return false;
+                }
+                // Range-check config fields here rather than failing every job later
+                std::string key = assignment.substr(0, equals);
+                std::map<std::string, double> strategy_params;
+                RiskParameters risk;
+                BacktestConfig config;
+                if (!apply_override(key, value, strategy_params, risk, config, error)) {
+                    error = where + error;
+                    return false;
+                }
+                override_set.values[key] = value;
+            }
+            manifest.overrides.push_back(override_set);
+        } else if (directive == "output") {
+            if (!(words >> manifest.output_file)) {
+                error = where + "expected 'output <file>'";
+                return false;
+            }
+        } else if (directive == "threads") {
+            long threads = -1;
+            if (!(words >> threads) || threads < 0) {
+                error = where + "expected 'threads <n>'";
+                return false;
+            }
+            manifest.num_threads = static_cast<size_t>(threads);
+        } else {
+            error = where + "unknown directive '" + directive + "'";
+            return false;
+        }
+    }
+
+    if (manifest.data_sets.empty() || manifest.strategies.empty()) {
+        error = filename + ": manifest needs at least one data line and one strategy";
+        return false;
+    }
+    return true;
+}
+
+std::vector<BatchJobResult> BatchRunner::run(const BatchManifest& manifest,
+                                             const StrategyFactory& factory,
+                                             const ParameterProvider& default_parameters) {
+    std::vector<BatchOverride> overrides = manifest.overrides;
+    if (overrides.empty()) {
+        overrides.push_back(BatchOverride());
+        overrides.back().name = "default";
+    }
+
+    // One load per distinct file, however many data ids and jobs refer to it
+    std::map<std::string, size_t> file_index;
+    std::vector<std::string> files;
+    std::vector<size_t> data_file(manifest.data_sets.size());
+    for (size_t d = 0; d < manifest.data_sets.size(); ++d) {
+        auto inserted = file_index.insert(std::make_pair(manifest.data_sets[d].file, files.size()));
+        if (inserted.second) {
+            files.push_back(manifest.data_sets[d].file);
+        }
+        data_file[d] = inserted.first->second;
+    }
+
+    // Loads and jobs run on the shared scheduler, at most num_threads at a time
+    WorkStealingPool& pool = WorkStealingPool::shared();
+
+    std::vector<LoadedData> loaded(files.size());
+    parallel_for(pool, files.size(), manifest.num_threads, [&](size_t f) {
+        auto parser = std::make_shared<CSVParser>();
+        if (!parser->load_data(files[f])) {
+            loaded[f].error = "failed to load " + files[f];
+        } else if (!parser->validate_data()) {
+            loaded[f].error = "data validation failed for " + files[f];
+        } else {
+            loaded[f].parser = parser;
+        }
+    });
+    data_loads_ = files.size();
+
+    // Job results are preallocated so workers write disjoint slots
+    std::vector<BatchJobResult> results(manifest.data_sets.size() * manifest.strategies.size() * overrides.size());
+    std::vector<size_t> job_data(results.size());
+    std::vector<const BatchOverride*> job_override(results.size());
+    size_t job = 0;
+    for (size_t d = 0; d < manifest.data_sets.size(); ++d) {
+        for (const std::string& strategy_name : manifest.strategies) {
+            for (const BatchOverride& override_set : overrides) {
+                results[job].data_id = manifest.data_sets[d].id;
+                results[job].strategy_name = strategy_name;
+                results[job].override_name = override_set.name;
+                job_data[job] = d;
+                job_override[job] = &override_set;
+                ++job;
+            }
+        }
+    }
+
+    auto indicator_cache = std::make_shared<IndicatorCache>();
+    parallel_for(pool, results.size(), manifest.num_threads, [&](size_t j) {
+        BatchJobResult& result = results[j];
+        const LoadedData& data = loaded[data_file[job_data[j]]];
+        if (!data.parser) {
+            result.error = data.error;
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        try {
+            std::map<std::string, double> strategy_params = default_parameters(result.strategy_name);
+            RiskParameters risk_params = risk_params_;
+            BacktestConfig config = config_;
+            std::string error;
+            for (const auto& entry : job_override[j]->values) {
+                if (!apply_override(entry.first, entry.second, strategy_params, risk_params, config, error)) {
+                    throw std::invalid_argument(error);
+                }
+            }
+            config.record_trades = false;
+            config.record_equity_curve = false;
+
+            std::shared_ptr<Strategy> strategy(factory(result.strategy_name));
+            if (!strategy) {
+                throw std::invalid_argument("unknown strategy " + result.strategy_name);
+            }
+            if (!strategy->initialize(strategy_params)) {
+                throw std::invalid_argument("invalid parameters for " + result.strategy_name);
+            }
+            auto risk_manager = std::make_shared<RiskManager>();
+            if (!risk_manager->initialize(risk_params)) {
+                throw std::invalid_argument("invalid risk parameters");
+            }
+            risk_manager->set_session_calendar(calendar_);
+
+            Backtester backtester;
+            if (!backtester.initialize(config)) {
+                throw std::invalid_argument("invalid backtest configuration");
+            }
+            backtester.set_indicator_cache(indicator_cache);
+            result.results = backtester.run_backtest(strategy, data.parser, risk_manager);
+            result.success = true;
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+        result.elapsed_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+    });
+
+    return results;
+}
+
+bool BatchRunner::write_results(const std::vector<BatchJobResult>& results, const std::string& filename) {
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    out << "data,strategy,override,status,total_trades,total_return,annualized_return,sharpe_ratio,"
+        << "max_drawdown,win_rate,profit_factor,elapsed_ms,error\n";
+    for (const BatchJobResult& result : results) {
+        const BacktestResults& r = result.results;
+        out << result.data_id << "," << result.strategy_name << "," << result.override_name << ","
+            << (result.success ? "ok" : "failed") << "," << r.total_trades << "," << r.total_return << ","
+            << r.annualized_return << "," << r.sharpe_ratio << "," << r.max_drawdown << "," << r.win_rate << ","
+            << r.profit_factor << "," << result.elapsed_ms << ",";
+        // Errors are free text; keep them to one field
+        std::string error = result.error;
+        for (char& c : error) {
+            if (c == ',' || c == '\n') {
+                c = ';';
+            }
+        }
+        out << error << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+size_t BatchRunner::get_data_loads() const {
+    return data_loads_;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,566 @@
+#include "config/bot_config.h"
+#include "utils/time_utils.h"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace TradingBot {
+
+namespace {
+
+const double UNBOUNDED = std::numeric_limits<double>::infinity();
+
+enum class FieldKind { NUMBER, INTEGER, BOOLEAN, TEXT, DATE, CHOICE };
+
+// One typed member of a config struct with its accepted range. Each
+// section's table is the whole schema for that section: the file loader,
+// batch overrides and the optimizer all validate through it.
+template <typename Struct>
+struct Field {
+    const char* key;
+    FieldKind kind;
+    double min_value;
+    double max_value;
+    bool positive;                     // min_value itself is excluded
+    const char* choices;               // CHOICE: accepted values separated by '|'
+    double Struct::*number;
+    int Struct::*integer;
+    bool Struct::*flag;
+    std::string Struct::*text;
+};
+
+template <typename Struct>
+Field<Struct> number_field(const char* key, double Struct::*member, double min_value, double max_value,
+                           bool positive = false) {
+    return {key, FieldKind::NUMBER, min_value, max_value, positive, nullptr, member, nullptr, nullptr, nullptr};
+}
+
+template <typename Struct>
+Field<Struct> integer_field(const char* key, int Struct::*member, double min_value, double max_value) {
+    return {key, FieldKind::INTEGER, min_value, max_value, false, nullptr, nullptr, member, nullptr, nullptr};
+}
+
+template <typename Struct>
+Field<Struct> bool_field(const char* key, bool Struct::*member) {
+    return {key, FieldKind::BOOLEAN, 0.0, 1.0, false, nullptr, nullptr, nullptr, member, nullptr};
+}
+
+template <typename Struct>
+Field<Struct> text_field(const char* key, std::string Struct::*member, FieldKind kind = FieldKind::TEXT,
+                         const char* choices = nullptr) {
+    return {key, kind, 0.0, 0.0, false, choices, nullptr, nullptr, nullptr, member};
+}
+
+const std::vector<Field<BacktestConfig>>& backtest_fields() {
+    static const std::vector<Field<BacktestConfig>> fields = {
+        number_field("initial_capital", &BacktestConfig::initial_capital, 0.0, UNBOUNDED, true),
+        number_field("commission_rate", &BacktestConfig::commission_rate, 0.0, 1.0),
+        number_field("slippage", &BacktestConfig::slippage, 0.0, 1.0),
+        number_field("periods_per_year", &BacktestConfig::periods_per_year, 0.0, UNBOUNDED, true),
+        bool_field("enable_short_selling", &BacktestConfig::enable_short_selling),
+        bool_field("record_trades", &BacktestConfig::record_trades),
+        bool_field("record_equity_curve", &BacktestConfig::record_equity_curve),
+        bool_field("use_intrabar_execution", &BacktestConfig::use_intrabar_execution),
+        text_field("start_date", &BacktestConfig::start_date, FieldKind::DATE),
+        text_field("end_date", &BacktestConfig::end_date, FieldKind::DATE),
+    };
+    return fields;
+}
+
+const std::vector<Field<RiskParameters>>& risk_fields() {
+    static const std::vector<Field<RiskParameters>> fields = {
+        number_field("max_position_size", &RiskParameters::max_position_size, 0.0, 1.0, true),
+        number_field("max_drawdown", &RiskParameters::max_drawdown, 0.0, 1.0, true),
+        number_field("stop_loss_pct", &RiskParameters::stop_loss_pct, 0.0, 1.0, true),
+        number_field("take_profit_pct", &RiskParameters::take_profit_pct, 0.0, 1.0, true),
+        number_field("max_daily_loss", &RiskParameters::max_daily_loss, 0.0, 1.0),
+        number_field("position_sizing_atr", &RiskParameters::position_sizing_atr, 0.0, UNBOUNDED),
+        integer_field("atr_period", &RiskParameters::atr_period, 1.0, 100000.0),
+    };
+    return fields;
+}
+
+const std::vector<Field<SessionHours>>& session_fields() {
+    static const std::vector<Field<SessionHours>> fields = {
+        integer_field("utc_offset_minutes", &SessionHours::utc_offset_minutes, -14.0 * 60, 14.0 * 60),
+        integer_field("open_minutes", &SessionHours::open_minutes, 0.0, 24.0 * 60),
+        integer_field("close_minutes", &SessionHours::close_minutes, 0.0, 24.0 * 60),
+        bool_field("weekends_closed", &SessionHours::weekends_closed),
+    };
+    return fields;
+}
+
+const std::vector<Field<PortfolioRiskLimits>>& portfolio_risk_fields() {
+    static const std::vector<Field<PortfolioRiskLimits>> fields = {
+        number_field("max_gross_exposure", &PortfolioRiskLimits::max_gross_exposure, 0.0, UNBOUNDED, true),
+        number_field("max_net_exposure", &PortfolioRiskLimits::max_net_exposure, 0.0, UNBOUNDED, true),
+        number_field("max_concentration", &PortfolioRiskLimits::max_concentration, 0.0, UNBOUNDED, true),
+        number_field("max_daily_loss", &PortfolioRiskLimits::max_daily_loss, 0.0, 1.0, true),
+        number_field("max_var", &PortfolioRiskLimits::max_var, 0.0, 1.0, true),
+        number_field("var_confidence", &PortfolioRiskLimits::var_confidence, 0.5, 0.9999, true),
+        number_field("covariance_decay", &PortfolioRiskLimits::covariance_decay, 0.0, 0.9999, true),
+    };
+    return fields;
+}
+
+const std::vector<Field<LoggingConfig>>& logging_fields() {
+    static const std::vector<Field<LoggingConfig>> fields = {
+        text_field("log_file", &LoggingConfig::log_file),
+        text_field("min_level", &LoggingConfig::min_level, FieldKind::CHOICE, "DEBUG|INFO|WARNING|ERROR"),
+        bool_field("console_output", &LoggingConfig::console_output),
+        bool_field("file_output", &LoggingConfig::file_output),
+        bool_field("timestamp", &LoggingConfig::timestamp),
+        number_field("max_file_size_mb", &LoggingConfig::max_file_size_mb, 0.0, UNBOUNDED, true),
+    };
+    return fields;
+}
+
+const std::vector<Field<ApiConfig>>& api_fields() {
+    static const std::vector<Field<ApiConfig>> fields = {
+        text_field("default_provider", &ApiConfig::default_provider, FieldKind::CHOICE,
+                   "yahoo_finance|alpha_vantage"),
+        text_field("default_symbol", &ApiConfig::default_symbol),
+        text_field("default_interval", &ApiConfig::default_interval),
+        bool_field("cache_enabled", &ApiConfig::cache_enabled),
+        bool_field("auto_save_csv", &ApiConfig::auto_save_csv),
+        text_field("csv_output_directory", &ApiConfig::csv_output_directory),
+    };
+    return fields;
+}
+
+const std::vector<Field<AlphaVantageConfig>>& alpha_vantage_fields() {
+    static const std::vector<Field<AlphaVantageConfig>> fields = {
+        text_field("api_key", &AlphaVantageConfig::api_key),
+        bool_field("enabled", &AlphaVantageConfig::enabled),
+        integer_field("rate_limit_per_minute", &AlphaVantageConfig::rate_limit_per_minute, 1.0, 100000.0),
+        integer_field("timeout_seconds", &AlphaVantageConfig::timeout_seconds, 1.0, 3600.0),
+    };
+    return fields;
+}
+
+const std::vector<Field<YahooFinanceConfig>>& yahoo_finance_fields() {
+    static const std::vector<Field<YahooFinanceConfig>> fields = {
+        bool_field("enabled", &YahooFinanceConfig::enabled),
+        integer_field("timeout_seconds", &YahooFinanceConfig::timeout_seconds, 1.0, 3600.0),
+    };
+    return fields;
+}
+
+const std::vector<Field<DataConfig>>& csv_format_fields() {
+    static const std::vector<Field<DataConfig>> fields = {
+        text_field("timestamp_column", &DataConfig::timestamp_column),
+        text_field("open_column", &DataConfig::open_column),
+        text_field("high_column", &DataConfig::high_column),
+        text_field("low_column", &DataConfig::low_column),
+        text_field("close_column", &DataConfig::close_column),
+        text_field("volume_column", &DataConfig::volume_column),
+        text_field("date_format", &DataConfig::date_format),
+    };
+    return fields;
+}
+
+const std::vector<Field<DataConfig>>& validation_fields() {
+    static const std::vector<Field<DataConfig>> fields = {
+        bool_field("check_missing_values", &DataConfig::check_missing_values),
+        bool_field("check_price_consistency", &DataConfig::check_price_consistency),
+        number_field("min_volume", &DataConfig::min_volume, 0.0, UNBOUNDED),
+    };
+    return fields;
+}
+
+template <typename Struct>
+const Field<Struct>* find_field(const std::vector<Field<Struct>>& fields, std::string_view key) {
+    for (const auto& field : fields) {
+        if (key == field.key) {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+std::string format_number(double value) {
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+template <typename Struct>
+std::string describe_range(const Field<Struct>& field) {
+    std::string noun = field.kind == FieldKind::INTEGER ? "an integer" : "a number";
+    if (field.kind == FieldKind::BOOLEAN) {
+        return "expected true or false";
+    }
+    if (field.max_value == UNBOUNDED) {
+        return "expected " + noun + (field.positive ? " > " : " >= ") + format_number(field.min_value);
+    }
+    return "expected " + noun + (field.positive ? " above " : " between ") + format_number(field.min_value) +
+           (field.positive ? " and at most " : " and ") + format_number(field.max_value);
+}
+
+// Range-check and store a numeric value
+template <typename Struct>
+bool set_number(const Field<Struct>& field, Struct& target, double value, std::string& error) {
+    bool in_range = std::isfinite(value) && value <= field.max_value &&
+                    (field.positive ? value > field.min_value : value >= field.min_value);
+    switch (field.kind) {
+        case FieldKind::NUMBER:
+            if (in_range) {
+                target.*field.number = value;
+                return true;
+            }
+            break;
+        case FieldKind::INTEGER:
+            if (in_range && value == std::floor(value)) {
+                target.*field.integer = static_cast<int>(value);
+                return true;
+            }
+            break;
+        case FieldKind::BOOLEAN:
+            if (value == 0.0 || value == 1.0) {
+                target.*field.flag = value != 0.0;
+                return true;
+            }
+            break;
+        default:
+            error = "expected text, not a number";
+            return false;
+    }
+    error = describe_range(field);
+    return false;
+}
+
+bool is_choice(const char* choices, const std::string& value) {
+    std::string_view rest(choices);
+    while (!rest.empty()) {
+        size_t bar = rest.find('|');
+        if (rest.substr(0, bar) == value) {
+            return true;
+        }
+        rest = bar == std::string_view::npos ? std::string_view() : rest.substr(bar + 1);
+    }
+    return false;
+}
+
+std::string located(const std::string& path, const JsonValue& value, const std::string& message) {
+    return path + " (line " + std::to_string(value.line()) + "): " + message;
+}
+
+template <typename Struct>
+bool read_field(const Field<Struct>& field, const JsonValue& value, const std::string& path, Struct& target,
+                std::string& error) {
+    std::string message;
+    switch (field.kind) {
+        case FieldKind::NUMBER:
+        case FieldKind::INTEGER:
+            if (value.is_number() && set_number(field, target, value.as_number(), message)) {
+                return true;
+            }
+            if (!value.is_number()) {
+                message = describe_range(field) + ", got " + JsonValue::type_name(value.type());
+            }
+            break;
+        case FieldKind::BOOLEAN:
+            if (value.is_bool()) {
+                target.*field.flag = value.as_bool();
+                return true;
+            }
+            message = std::string("expected true or false, got ") + JsonValue::type_name(value.type());
+            break;
+        case FieldKind::TEXT:
+        case FieldKind::DATE:
+        case FieldKind::CHOICE: {
+            if (!value.is_string()) {
+                message = std::string("expected a string, got ") + JsonValue::type_name(value.type());
+                break;
+            }
+            int64_t epoch;
+            if (field.kind == FieldKind::DATE && !value.as_string().empty() &&
+                !TimeUtils::parse_timestamp(value.as_string(), epoch)) {
+                message = "expected a date (YYYY-MM-DD), got \"" + value.as_string() + "\"";
+                break;
+            }
+            if (field.kind == FieldKind::CHOICE && !is_choice(field.choices, value.as_string())) {
+                message = "expected one of " + std::string(field.choices) + ", got \"" + value.as_string() + "\"";
+                break;
+            }
+            target.*field.text = value.as_string();
+            return true;
+        }
+    }
+    error = located(path, value, message);
+    return false;
+}
+
+// Read an object's members into 'target' through its field table. Members
+// that are not fields are offered to 'nested' (sub-objects); anything it
+// does not claim is an unknown key.
+template <typename Struct, typename Nested>
+bool read_section(const JsonValue& section, const std::string& path, const std::vector<Field<Struct>>& fields,
+                  Struct& target, std::string& error, Nested nested) {
+    if (!section.is_object()) {
+        error = located(path, section, std::string("expected an object, got ") +
+                                           JsonValue::type_name(section.type()));
+        return false;
+    }
+    for (const auto& member : section.members()) {
+        std::string member_path = path + "." + member.first;
+        const Field<Struct>* field = find_field(fields, member.first);
+        if (field) {
+            if (!read_field(*field, member.second, member_path, target, error)) {
+                return false;
+            }
+            continue;
+        }
+        bool ok = true;
+        if (!nested(member, member_path, ok)) {
+            error = located(member_path, member.second, "unknown key");
+            return false;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Struct>
+bool read_section(const JsonValue& section, const std::string& path, const std::vector<Field<Struct>>& fields,
+                  Struct& target, std::string& error) {
+    return read_section(section, path, fields, target, error,
+                        [](const JsonValue::Member&, const std::string&, bool&) { return false; });
+}
+
+bool read_strategies(const JsonValue& section, BotConfig& config, std::string& error) {
+    if (!section.is_object()) {
+        error = located("strategies", section, "expected an object");
+        return false;
+    }
+    for (const auto& strategy : section.members()) {
+        std::string path = "strategies." + strategy.first;
+        if (!strategy.second.is_object()) {
+            error = located(path, strategy.second, "expected an object of parameters");
+            return false;
+        }
+        auto& params = config.strategies[strategy.first];
+        for (const auto& parameter : strategy.second.members()) {
+            // Text members (descriptions) are documentation only
+            if (parameter.second.is_number()) {
+                params[parameter.first] = parameter.second.as_number();
+            } else if (!parameter.second.is_string()) {
+                error = located(path + "." + parameter.first, parameter.second,
+                                std::string("expected a number, got ") +
+                                    JsonValue::type_name(parameter.second.type()));
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool read_holidays(const JsonValue& list, const std::string& path, std::vector<std::string>& holidays,
+                   std::string& error) {
+    if (!list.is_array()) {
+        error = located(path, list, std::string("expected an array of dates, got ") +
+                                        JsonValue::type_name(list.type()));
+        return false;
+    }
+    for (const auto& item : list.items()) {
+        int64_t epoch;
+        if (!item.is_string() || !TimeUtils::parse_timestamp(item.as_string(), epoch)) {
+            error = located(path, item, "expected a date (YYYY-MM-DD)");
+            return false;
+        }
+        holidays.push_back(item.as_string());
+    }
+    return true;
+}
+
+uint64_t fnv1a(const std::string& bytes) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : bytes) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace
+
+bool set_backtest_parameter(BacktestConfig& config, std::string_view key, double value, std::string& error) {
+    error.clear();
+    const Field<BacktestConfig>* field = find_field(backtest_fields(), key);
+    if (!field) {
+        return false;
+    }
+    if (!set_number(*field, config, value, error)) {
+        error = "backtesting." + std::string(key) + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+bool set_risk_parameter(RiskParameters& params, std::string_view key, double value, std::string& error) {
+    error.clear();
+    const Field<RiskParameters>* field = find_field(risk_fields(), key);
+    if (!field) {
+        return false;
+    }
+    if (!set_number(*field, params, value, error)) {
+        error = "risk_management." + std::string(key) + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+ConfigLoader::ConfigLoader() : modified_(0), size_(0), hash_(0), parse_count_(0) {
+}
+
+bool ConfigLoader::parse(std::string_view text, BotConfig& config, std::string& error) {
+    JsonValue document;
+    if (!parse_json(text, document, error)) {
+        return false;
+    }
+    if (!document.is_object()) {
+        error = "line " + std::to_string(document.line()) + ": expected an object at the top level";
+        return false;
+    }
+
+    BotConfig parsed;
+    // Sections outside the typed config (trading_bot, reporting) are ignored
+    for (const auto& section : document.members()) {
+        const std::string& name = section.first;
+        const JsonValue& value = section.second;
+        bool ok = true;
+        if (name == "backtesting") {
+            ok = read_section(value, name, backtest_fields(), parsed.backtesting, error);
+        } else if (name == "risk_management") {
+            ok = read_section(value, name, risk_fields(), parsed.risk, error);
+        } else if (name == "strategies") {
+            ok = read_strategies(value, parsed, error);
+        } else if (name == "session") {
+            ok = read_section(value, name, session_fields(), parsed.session, error,
+                [&](const JsonValue::Member& member, const std::string& path, bool& result) {
+                    if (member.first != "holidays") {
+                        return false;
+                    }
+                    result = read_holidays(member.second, path, parsed.holidays, error);
+                    return true;
+                });
+        } else if (name == "portfolio_risk") {
+            ok = read_section(value, name, portfolio_risk_fields(), parsed.portfolio_risk.emplace(), error);
+        } else if (name == "logging") {
+            ok = read_section(value, name, logging_fields(), parsed.logging, error);
+        } else if (name == "api") {
+            ok = read_section(value, name, api_fields(), parsed.api, error,
+                [&](const JsonValue::Member& member, const std::string& path, bool& result) {
+                    if (member.first == "alpha_vantage") {
+                        result = read_section(member.second, path, alpha_vantage_fields(), parsed.api.alpha_vantage,
+                                              error);
+                    } else if (member.first == "yahoo_finance") {
+                        result = read_section(member.second, path, yahoo_finance_fields(), parsed.api.yahoo_finance,
+                                              error);
+                    } else {
+                        return false;
+                    }
+                    return true;
+                });
+        } else if (name == "data") {
+            ok = read_section(value, name, std::vector<Field<DataConfig>>(), parsed.data, error,
+                [&](const JsonValue::Member& member, const std::string& path, bool& result) {
+                    if (member.first == "csv_format") {
+                        result = read_section(member.second, path, csv_format_fields(), parsed.data, error);
+                    } else if (member.first == "validation") {
+                        result = read_section(member.second, path, validation_fields(), parsed.data, error);
+                    } else {
+                        return false;
+                    }
+                    return true;
+                });
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+
+    // Checks spanning fields
+    int64_t start = 0, end = 0;
+    if (!parsed.backtesting.start_date.empty() && !parsed.backtesting.end_date.empty() &&
+        TimeUtils::parse_timestamp(parsed.backtesting.start_date, start) &&
+        TimeUtils::parse_timestamp(parsed.backtesting.end_date, end) && start > end) {
+        const JsonValue* section = document.find("backtesting");
+        error = located("backtesting.end_date", *section->find("end_date"), "before backtesting.start_date");
+        return false;
+    }
+
+    config = std::move(parsed);
+    return true;
+}
+
+bool ConfigLoader::load(const std::string& filename, std::string& error) {
+    filename_ = filename;
+    return read(filename, true, error) != ReloadResult::FAILED;
+}
+
+ConfigLoader::ReloadResult ConfigLoader::reload(std::string& error) {
+    if (filename_.empty()) {
+        error = "no configuration file loaded";
+        return ReloadResult::FAILED;
+    }
+    return read(filename_, false, error);
+}
+
+ConfigLoader::ReloadResult ConfigLoader::read(const std::string& filename, bool force, std::string& error) {
+    std::error_code code;
+    uintmax_t size = std::filesystem::file_size(filename, code);
+    int64_t modified = code ? 0 : std::filesystem::last_write_time(filename, code).time_since_epoch().count();
+    if (code) {
+        error = filename + ": cannot open";
+        return ReloadResult::FAILED;
+    }
+    if (!force && size == size_ && modified == modified_) {
+        return ReloadResult::UNCHANGED;
+    }
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        error = filename + ": cannot open";
+        return ReloadResult::FAILED;
+    }
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // Touched but not edited: nothing to parse. A rejected document is also
+    // remembered, so polling a broken file reports it once.
+    uint64_t hash = fnv1a(content);
+    bool same = !force && hash == hash_;
+    modified_ = modified;
+    size_ = size;
+    hash_ = hash;
+    if (same) {
+        return ReloadResult::UNCHANGED;
+    }
+
+    BotConfig config;
+    ++parse_count_;
+    if (!parse(content, config, error)) {
+        error = filename + ": " + error;
+        return ReloadResult::FAILED;
+    }
+    config_ = std::move(config);
+    return ReloadResult::RELOADED;
+}
+
+const BotConfig& ConfigLoader::get() const {
+    return config_;
+}
+
+const std::string& ConfigLoader::get_filename() const {
+    return filename_;
+}
+
+size_t ConfigLoader::get_parse_count() const {
+    return parse_count_;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,79 @@
+#include "data/api_bar_source.h"
+#include "utils/time_utils.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+const int64_t kSecondsPerDay = 86400;
+
+int64_t parse_day(const std::string& date) {
+    int64_t epoch_seconds;
+    if (!TimeUtils::parse_timestamp(date, epoch_seconds)) {
+        throw std::invalid_argument("Invalid date: " + date);
+    }
+    return epoch_seconds / kSecondsPerDay;
+}
+
+} // namespace
+
+APIBarSource::APIBarSource(APIDataFetcher& fetcher, const std::string& symbol, DataInterval interval,
+                           const std::string& start_date, const std::string& end_date, int window_days)
+    : fetcher_(fetcher), symbol_(symbol), interval_(interval),
+      start_day_(parse_day(start_date)), end_day_(parse_day(end_date)),
+      window_days_(window_days), next_day_(0), last_emitted_(0), emitted_any_(false) {
+    rewind();
+}
+
+bool APIBarSource::next_batch(std::vector<MarketData>& batch) {
+    batch.clear();
+
+    while (batch.empty() && next_day_ <= end_day_) {
+        int64_t window_end = window_days_ > 0 ? std::min(end_day_, next_day_ + window_days_ - 1) : end_day_;
+        std::string window_start = TimeUtils::format_date(next_day_ * kSecondsPerDay);
+        APIResponse response = fetcher_.fetch_data(symbol_, interval_, window_start,
+                                                   TimeUtils::format_date(window_end * kSecondsPerDay));
+        if (!response.success) {
+            // A missing window is a gap in the history, not its end
+            last_error_ = response.error_message;
+            next_day_ = end_day_ + 1;
+            throw std::runtime_error("Fetching " + symbol_ + " from " + window_start + " failed: " + last_error_);
+        }
+
+        int64_t window_first = next_day_ * kSecondsPerDay;
+        int64_t window_last = (window_end + 1) * kSecondsPerDay - 1;
+        next_day_ = window_end + 1;
+
+        int64_t timestamp;
+        for (MarketData& bar : response.data) {
+            if (!get_epoch(bar, timestamp) || timestamp < window_first ||
+                timestamp > window_last || (emitted_any_ && timestamp <= last_emitted_)) {
+                continue;
+            }
+            last_emitted_ = timestamp;
+            emitted_any_ = true;
+            batch.push_back(std::move(bar));
+        }
+    }
+    return !batch.empty();
+}
+
+bool APIBarSource::rewind() {
+    next_day_ = start_day_;
+    last_emitted_ = 0;
+    emitted_any_ = false;
+    last_error_.clear();
+    return true;
+}
+
+std::string APIBarSource::get_name() const {
+    return "API " + symbol_;
+}
+
+const std::string& APIBarSource::get_last_error() const {
+    return last_error_;
+}
+
+} // namespace TradingBot
@@ -1,4 +1,7 @@
 #include "data/api_data_fetcher.h"
+#include "data/market_journal.h"
+#include "utils/time_utils.h"
+#include "utils/work_stealing_pool.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -160,12 +163,17 @@ std::string http_get(const std::string& url) {
     CURLcode res;
     std::string readBuffer;
     
+    // curl_easy_init would otherwise run libcurl's global setup unsynchronized
+    static std::once_flag curl_initialized;
+    std::call_once(curl_initialized, []() { curl_global_init(CURL_GLOBAL_DEFAULT); });
+    
     curl = curl_easy_init();
     if (curl) {
         curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
         curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
         curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
         curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L); // Safe from worker threads
         curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L); // For testing
         
         res = curl_easy_perform(curl);
@@ -274,6 +282,11 @@ APIResponse AlphaVantageClient::fetch_historical_data(
         response.error_message = "Invalid date format. Use YYYY-MM-DD";
         return response;
     }
+    int64_t start_epoch = 0, end_epoch = 0;
+    if (!TimeUtils::parse_timestamp(start_date, start_epoch) || !TimeUtils::parse_timestamp(end_date, end_epoch)) {
+        response.error_message = "Invalid date range " + start_date + " to " + end_date;
+        return response;
+    }
     
     // Build URL based on interval
     std::string url = base_url_ + "?apikey=" + api_key_ + "&symbol=" + symbol;
@@ -318,10 +331,10 @@ APIResponse AlphaVantageClient::fetch_historical_data(
     
     // Filter by date range
     if (response.success && !response.data.empty()) {
+        // Compare epochs: the end date includes its whole day
         std::vector<MarketData> filtered_data;
         for (const auto& data : response.data) {
-            std::string date_part = data.timestamp.substr(0, 10);
-            if (date_part >= start_date && date_part <= end_date) {
+            if (data.epoch >= start_epoch && data.epoch < end_epoch + 86400) {
                 filtered_data.push_back(data);
             }
         }
@@ -360,6 +373,9 @@ APIResponse AlphaVantageClient::parse_daily_response(const std::string& json_res
         if (date.length() >= 10 && date[4] == '-' && date[7] == '-') {
             MarketData data;
             data.timestamp = date;
+            if (!TimeUtils::parse_timestamp(date, data.epoch)) {
+                data.epoch = TimeUtils::NO_EPOCH;
+            }
             
             // Extract OHLCV values
             size_t open_pos = json_response.find("\"1. open\":", pos);
@@ -464,11 +480,13 @@ YahooFinanceClient::YahooFinanceClient()
     // Using v8 chart API which has better compatibility
 }
 
-long long YahooFinanceClient::date_to_timestamp(const std::string& date) {
-    std::tm tm = {};
-    std::istringstream ss(date);
-    ss >> std::get_time(&tm, "%Y-%m-%d");
-    return static_cast<long long>(std::mktime(&tm));
+bool YahooFinanceClient::date_to_timestamp(const std::string& date, long long& timestamp) {
+    int64_t epoch = 0;
+    if (!TimeUtils::parse_timestamp(date, epoch)) {
+        return false;
+    }
+    timestamp = static_cast<long long>(epoch);
+    return true;
 }
 
 APIResponse YahooFinanceClient::fetch_historical_data(
@@ -487,8 +505,11 @@ APIResponse YahooFinanceClient::fetch_historical_data(
     }
     
     // Convert dates to timestamps
-    long long period1 = date_to_timestamp(start_date);
-    long long period2 = date_to_timestamp(end_date);
+    long long period1 = 0, period2 = 0;
+    if (!date_to_timestamp(start_date, period1) || !date_to_timestamp(end_date, period2)) {
+        response.error_message = "Invalid date range " + start_date + " to " + end_date;
+        return response;
+    }
     
     // Calculate date range in days
     long long days_diff = (period2 - period1) / 86400; // 86400 seconds per day
@@ -509,14 +530,8 @@ APIResponse YahooFinanceClient::fetch_historical_data(
             chunk_num++;
             
             // Convert timestamps back to date strings
-            time_t t_start = static_cast<time_t>(current_start);
-            time_t t_end = static_cast<time_t>(current_end);
-            tm* tm_start = localtime(&t_start);
-            tm* tm_end = localtime(&t_end);
-            
-            char chunk_start[20], chunk_end[20];
-            strftime(chunk_start, sizeof(chunk_start), "%Y-%m-%d", tm_start);
-            strftime(chunk_end, sizeof(chunk_end), "%Y-%m-%d", tm_end);
+            std::string chunk_start = TimeUtils::format_date(current_start);
+            std::string chunk_end = TimeUtils::format_date(current_end);
             
             std::cout << "Fetching chunk " << chunk_num << ": " << chunk_start << " to " << chunk_end 
                       << " (" << ((current_end - current_start) / 86400) << " days)" << std::endl;
@@ -625,6 +640,9 @@ APIResponse YahooFinanceClient::parse_csv_response(const std::string& csv_respon
         try {
             MarketData data;
             data.timestamp = date;
+            if (!TimeUtils::parse_timestamp(date, data.epoch)) {
+                data.epoch = TimeUtils::NO_EPOCH;
+            }
             data.open = std::stod(open);
             data.high = std::stod(high);
             data.low = std::stod(low);
@@ -734,11 +752,8 @@ APIResponse YahooFinanceClient::parse_json_chart_response(const std::string& jso
             MarketData data;
             
             // Convert timestamp to date string
-            time_t t = static_cast<time_t>(timestamps[i]);
-            tm* ltm = localtime(&t);
-            char date_str[20];
-            strftime(date_str, sizeof(date_str), "%Y-%m-%d", ltm);
-            data.timestamp = date_str;
+            data.epoch = static_cast<int64_t>(timestamps[i]);
+            data.timestamp = TimeUtils::format_date(data.epoch);
             
             data.open = (i < opens.size()) ? opens[i] : closes[i];
             data.high = (i < highs.size()) ? highs[i] : closes[i];
@@ -818,16 +833,34 @@ bool APIDataFetcher::set_provider(APIProvider provider) {
     return false;
 }
 
+void APIDataFetcher::set_client(APIProvider provider, std::unique_ptr<APIClient> client) {
+    if (client) {
+        clients_[provider] = std::move(client);
+    } else {
+        clients_.erase(provider);
+    }
+}
+
+void APIDataFetcher::enable_recording(std::shared_ptr<JournalWriter> journal) {
+    for (auto& entry : clients_) {
+        entry.second = std::make_unique<RecordingAPIClient>(std::move(entry.second), journal);
+    }
+}
+
 APIResponse APIDataFetcher::fetch_data(
     const std::string& symbol,
     DataInterval interval,
     const std::string& start_date,
     const std::string& end_date) {
     
-    // Check cache first
-    if (caching_enabled_ && is_cached(symbol, interval)) {
-        std::cout << "Using cached data for " << symbol << std::endl;
-        return get_cached_data(symbol, interval);
+    // Check cache first (keyed by date range too, so windowed fetches don't collide)
+    std::string cache_key = symbol + "|" + start_date + "|" + end_date;
+    if (caching_enabled_) {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        if (is_cached(cache_key, interval)) {
+            std::cout << "Using cached data for " << symbol << std::endl;
+            return get_cached_data(cache_key, interval);
+        }
     }
     
     // Fetch from active provider
@@ -843,12 +876,27 @@ APIResponse APIDataFetcher::fetch_data(
     
     // Cache successful response
     if (response.success && caching_enabled_) {
-        cache_data(symbol, interval, response);
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        cache_data(cache_key, interval, response);
     }
     
     return response;
 }
 
+std::vector<APIResponse> APIDataFetcher::fetch_many(
+    const std::vector<std::string>& symbols,
+    DataInterval interval,
+    const std::string& start_date,
+    const std::string& end_date,
+    size_t max_concurrent) {
+    
+    std::vector<APIResponse> responses(symbols.size());
+    parallel_for(WorkStealingPool::shared(), symbols.size(), max_concurrent, [&](size_t i) {
+        responses[i] = fetch_data(symbols[i], interval, start_date, end_date);
+    });
+    return responses;
+}
+
 APIResponse APIDataFetcher::fetch_quote(const std::string& symbol) {
     auto it = clients_.find(active_provider_);
     if (it == clients_.end()) {
@@ -899,6 +947,7 @@ std::vector<std::string> APIDataFetcher::get_available_providers() const {
 }
 
 void APIDataFetcher::clear_cache() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
     cache_.clear();
 }
 
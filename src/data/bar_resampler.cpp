@@ -0,0 +1,216 @@
+#include "data/bar_resampler.h"
+#include "utils/time_utils.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+const int64_t kSecondsPerDay = 86400;
+
+int64_t floor_div(int64_t value, int64_t divisor) {
+    int64_t quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+// Fixed bucket length in seconds (0 for calendar-aligned intervals)
+int64_t fixed_length(DataInterval interval) {
+    switch (interval) {
+        case DataInterval::MINUTE_1:  return 60;
+        case DataInterval::MINUTE_5:  return 300;
+        case DataInterval::MINUTE_15: return 900;
+        case DataInterval::MINUTE_30: return 1800;
+        case DataInterval::HOUR_1:    return 3600;
+        case DataInterval::DAILY:     return kSecondsPerDay;
+        default:                      return 0;
+    }
+}
+
+bool is_intraday(DataInterval interval) {
+    return interval != DataInterval::DAILY && interval != DataInterval::WEEKLY &&
+           interval != DataInterval::MONTHLY;
+}
+
+} // namespace
+
+std::string interval_name(DataInterval interval) {
+    switch (interval) {
+        case DataInterval::MINUTE_1:  return "1m";
+        case DataInterval::MINUTE_5:  return "5m";
+        case DataInterval::MINUTE_15: return "15m";
+        case DataInterval::MINUTE_30: return "30m";
+        case DataInterval::HOUR_1:    return "1h";
+        case DataInterval::DAILY:     return "1d";
+        case DataInterval::WEEKLY:    return "1w";
+        case DataInterval::MONTHLY:   return "1mo";
+    }
+    return "?";
+}
+
+// BarAggregator
+
+BarAggregator::BarAggregator(DataInterval interval)
+    : interval_(interval), bucket_(0), active_(false) {
+}
+
+DataInterval BarAggregator::get_interval() const {
+    return interval_;
+}
+
+bool BarAggregator::add(const MarketData& bar, int64_t epoch_seconds, MarketData& completed) {
+    int64_t bucket = bucket_start(interval_, epoch_seconds);
+
+    if (!active_) {
+        start_bucket(bar, bucket);
+        return false;
+    }
+
+    if (bucket > bucket_) {
+        completed = current_;
+        start_bucket(bar, bucket);
+        return true;
+    }
+
+    current_.high = std::max(current_.high, bar.high);
+    current_.low = std::min(current_.low, bar.low);
+    current_.volume += bar.volume;
+    if (bucket == bucket_) {
+        current_.close = bar.close;
+    }
+    return false;
+}
+
+bool BarAggregator::flush(MarketData& completed) {
+    if (!active_) {
+        return false;
+    }
+    completed = current_;
+    active_ = false;
+    return true;
+}
+
+bool BarAggregator::has_partial() const {
+    return active_;
+}
+
+const MarketData& BarAggregator::get_partial() const {
+    return current_;
+}
+
+void BarAggregator::reset() {
+    active_ = false;
+    bucket_ = 0;
+}
+
+int64_t BarAggregator::bucket_start(DataInterval interval, int64_t epoch_seconds) {
+    int64_t length = fixed_length(interval);
+    if (length > 0) {
+        return floor_div(epoch_seconds, length) * length;
+    }
+
+    int64_t days = floor_div(epoch_seconds, kSecondsPerDay);
+    if (interval == DataInterval::WEEKLY) {
+        return (days - TimeUtils::weekday_from_days(days)) * kSecondsPerDay;
+    }
+
+    int year;
+    unsigned month, day;
+    TimeUtils::civil_from_days(days, year, month, day);
+    return TimeUtils::days_from_civil(year, month, 1) * kSecondsPerDay;
+}
+
+void BarAggregator::start_bucket(const MarketData& bar, int64_t bucket) {
+    bucket_ = bucket;
+    active_ = true;
+
+    current_.timestamp = is_intraday(interval_) ? TimeUtils::format_timestamp(bucket)
+                                                : TimeUtils::format_date(bucket);
+    current_.epoch = bucket;
+    current_.open = bar.open;
+    current_.high = bar.high;
+    current_.low = bar.low;
+    current_.close = bar.close;
+    current_.volume = bar.volume;
+}
+
+// BarResampler
+
+BarResampler::BarResampler() {
+}
+
+void BarResampler::subscribe(DataInterval interval, BarCallback callback) {
+    for (Subscription& subscription : subscriptions_) {
+        if (subscription.aggregator.get_interval() == interval) {
+            subscription.callbacks.push_back(callback);
+            return;
+        }
+    }
+    subscriptions_.emplace_back(interval);
+    subscriptions_.back().callbacks.push_back(callback);
+}
+
+bool BarResampler::add_bar(const MarketData& bar) {
+    int64_t epoch_seconds;
+    if (!get_epoch(bar, epoch_seconds)) {
+        return false;
+    }
+
+    for (Subscription& subscription : subscriptions_) {
+        if (subscription.aggregator.add(bar, epoch_seconds, completed_)) {
+            for (const BarCallback& callback : subscription.callbacks) {
+                callback(subscription.aggregator.get_interval(), completed_);
+            }
+        }
+    }
+    return true;
+}
+
+bool BarResampler::add_tick(const std::string& timestamp, double price, double volume) {
+    tick_bar_.timestamp = timestamp;
+    tick_bar_.epoch = TimeUtils::NO_EPOCH;
+    tick_bar_.open = tick_bar_.high = tick_bar_.low = tick_bar_.close = price;
+    tick_bar_.volume = volume;
+    return add_bar(tick_bar_);
+}
+
+void BarResampler::flush() {
+    for (Subscription& subscription : subscriptions_) {
+        if (subscription.aggregator.flush(completed_)) {
+            for (const BarCallback& callback : subscription.callbacks) {
+                callback(subscription.aggregator.get_interval(), completed_);
+            }
+        }
+    }
+}
+
+const MarketData* BarResampler::get_partial(DataInterval interval) const {
+    for (const Subscription& subscription : subscriptions_) {
+        if (subscription.aggregator.get_interval() == interval) {
+            return subscription.aggregator.has_partial() ? &subscription.aggregator.get_partial() : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<MarketData> BarResampler::resample(const std::vector<MarketData>& bars, DataInterval interval) {
+    std::vector<MarketData> result;
+    BarAggregator aggregator(interval);
+    MarketData completed;
+    int64_t epoch_seconds;
+
+    for (const MarketData& bar : bars) {
+        if (!get_epoch(bar, epoch_seconds)) {
+            throw std::invalid_argument("Unparseable timestamp: " + bar.timestamp);
+        }
+        if (aggregator.add(bar, epoch_seconds, completed)) {
+            result.push_back(completed);
+        }
+    }
+    if (aggregator.flush(completed)) {
+        result.push_back(completed);
+    }
+    return result;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,199 @@
+#include "data/bar_source.h"
+#include <stdexcept>
+
+namespace TradingBot {
+
+// CSVBarSource
+
+CSVBarSource::CSVBarSource(const std::string& filename, size_t batch_size)
+    : filename_(filename), batch_size_(batch_size > 0 ? batch_size : 1) {
+    open();
+}
+
+bool CSVBarSource::is_open() const {
+    return file_.is_open();
+}
+
+bool CSVBarSource::open() {
+    file_.close();
+    file_.clear();
+    file_.open(filename_);
+    if (!file_.is_open()) {
+        return false;
+    }
+    std::getline(file_, line_); // skip header
+    return true;
+}
+
+bool CSVBarSource::next_batch(std::vector<MarketData>& batch) {
+    if (!file_.is_open()) {
+        batch.clear();
+        return false;
+    }
+
+    // Overwrite existing elements so their timestamp buffers are reused
+    batch.resize(batch_size_);
+    size_t count = 0;
+    while (count < batch_size_ && std::getline(file_, line_)) {
+        if (!line_.empty()) {
+            MarketData& bar = batch[count++];
+            bar = MarketData();
+            CSVParser::parse_fields(line_.data(), line_.data() + line_.size(), bar);
+        }
+    }
+    batch.resize(count);
+    return count > 0;
+}
+
+bool CSVBarSource::rewind() {
+    return open();
+}
+
+std::string CSVBarSource::get_name() const {
+    return "CSV " + filename_;
+}
+
+// CompressedBarSource
+
+CompressedBarSource::CompressedBarSource(std::shared_ptr<const CompressedBarStore> store)
+    : store_(store), block_(0) {
+    if (!store_) {
+        throw std::invalid_argument("Null store provided to CompressedBarSource");
+    }
+}
+
+bool CompressedBarSource::next_batch(std::vector<MarketData>& batch) {
+    // Sealed blocks, then the unsealed tail (index block_count())
+    while (block_ <= store_->block_count()) {
+        store_->decode_block(block_++, batch);
+        if (!batch.empty()) {
+            return true;
+        }
+    }
+    batch.clear();
+    return false;
+}
+
+bool CompressedBarSource::rewind() {
+    block_ = 0;
+    return true;
+}
+
+std::string CompressedBarSource::get_name() const {
+    return "compressed store";
+}
+
+// ReadAheadBarSource
+
+ReadAheadBarSource::ReadAheadBarSource(std::shared_ptr<BarSource> inner, size_t max_batches)
+    : inner_(inner), max_batches_(max_batches > 0 ? max_batches : 1),
+      started_(false), finished_(false), stop_(false) {
+    if (!inner_) {
+        throw std::invalid_argument("Null source provided to ReadAheadBarSource");
+    }
+}
+
+ReadAheadBarSource::~ReadAheadBarSource() {
+    stop();
+}
+
+bool ReadAheadBarSource::next_batch(std::vector<MarketData>& batch) {
+    if (!started_) {
+        start();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    batch_ready_.wait(lock, [this] { return !filled_.empty() || finished_; });
+
+    if (filled_.empty()) {
+        batch.clear();
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+        return false;
+    }
+
+    // Hand over the filled batch and keep the caller's vector for reuse
+    batch.swap(filled_.front());
+    free_.push_back(std::move(filled_.front()));
+    filled_.pop_front();
+    slot_free_.notify_one();
+    return true;
+}
+
+bool ReadAheadBarSource::rewind() {
+    stop();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (!filled_.empty()) {
+            free_.push_back(std::move(filled_.front()));
+            filled_.pop_front();
+        }
+        finished_ = false;
+        error_ = nullptr;
+    }
+    return inner_->rewind();
+}
+
+std::string ReadAheadBarSource::get_name() const {
+    return inner_->get_name() + " (read-ahead)";
+}
+
+void ReadAheadBarSource::start() {
+    stop_ = false;
+    started_ = true;
+    reader_ = std::thread(&ReadAheadBarSource::read_loop, this);
+}
+
+void ReadAheadBarSource::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    slot_free_.notify_all();
+    if (reader_.joinable()) {
+        reader_.join();
+    }
+    started_ = false;
+}
+
+void ReadAheadBarSource::read_loop() {
+    std::vector<MarketData> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            slot_free_.wait(lock, [this] { return stop_ || filled_.size() < max_batches_; });
+            if (stop_) {
+                return;
+            }
+            if (!free_.empty()) {
+                batch.swap(free_.back());
+                free_.pop_back();
+            }
+        }
+
+        bool more = false;
+        std::exception_ptr error;
+        try {
+            more = inner_->next_batch(batch);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!more) {
+            free_.push_back(std::move(batch));
+            error_ = error;
+            finished_ = true;
+            batch_ready_.notify_all();
+            return;
+        }
+        filled_.push_back(std::move(batch));
+        batch = std::vector<MarketData>();
+        batch_ready_.notify_one();
+    }
+}
+
+} // namespace TradingBot
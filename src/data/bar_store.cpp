@@ -0,0 +1,477 @@
+#include "data/bar_store.h"
+#include "utils/time_utils.h"
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+const char kMagic[4] = {'T', 'B', 'C', '1'};
+
+const uint8_t kFixedPoint = 1;     // Prices and volume as scaled integers
+const uint8_t kDateOnly = 2;       // Timestamps decode as "YYYY-MM-DD"
+
+// Largest magnitude kept exact by a double
+const double kMaxExact = 9007199254740992.0;
+
+uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void put_varint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+// Reads one varint without running past 'end'; a block that ends early is corrupt
+uint64_t get_varint(const uint8_t*& in, const uint8_t* end) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64 && in < end; shift += 7) {
+        uint8_t byte = *in++;
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw std::runtime_error("Corrupt compressed block");
+}
+
+uint64_t double_bits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double bits_double(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Formats consecutive timestamps, redoing the calendar date only when the day changes
+class TimestampFormatter {
+public:
+    TimestampFormatter() : day_(INT64_MIN) {}
+
+    void format(int64_t epoch_seconds, bool date_only, std::string& out) {
+        int64_t day = epoch_seconds / 86400 - (epoch_seconds % 86400 < 0 ? 1 : 0);
+        if (day != day_) {
+            day_ = day;
+            std::memcpy(text_, TimeUtils::format_date(epoch_seconds).data(), 10);
+            text_[10] = ' ';
+            text_[13] = ':';
+            text_[16] = ':';
+        }
+        if (date_only) {
+            out.assign(text_, 10);
+            return;
+        }
+        int64_t seconds = epoch_seconds - day * 86400;
+        put_two(text_ + 11, static_cast<int>(seconds / 3600));
+        put_two(text_ + 14, static_cast<int>(seconds / 60 % 60));
+        put_two(text_ + 17, static_cast<int>(seconds % 60));
+        out.assign(text_, 19);
+    }
+
+private:
+    int64_t day_;
+    char text_[19];
+
+    static void put_two(char* out, int value) {
+        out[0] = static_cast<char>('0' + value / 10);
+        out[1] = static_cast<char>('0' + value % 10);
+    }
+};
+
+template <typename T>
+void write_pod(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool read_pod(std::ifstream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+} // namespace
+
+CompressedBarStore::CompressedBarStore(double price_scale, size_t block_size)
+    : price_scale_(price_scale), block_size_(block_size), size_(0) {
+    if (!(price_scale_ > 0.0) || block_size_ == 0) {
+        throw std::invalid_argument("CompressedBarStore requires a positive price scale and block size");
+    }
+    pending_.reserve(block_size_);
+}
+
+bool CompressedBarStore::append(const MarketData& bar) {
+    int64_t timestamp;
+    if (!get_epoch(bar, timestamp) || (size_ > 0 && timestamp < last_timestamp())) {
+        return false;
+    }
+
+    // A block decodes all its timestamps one way, so a change of format starts a new one
+    bool date_only = bar.timestamp.size() == 10;
+    if (!pending_.empty() && pending_.back().date_only != date_only) {
+        seal();
+    }
+
+    PendingBar pending;
+    pending.timestamp = timestamp;
+    pending.open = bar.open;
+    pending.high = bar.high;
+    pending.low = bar.low;
+    pending.close = bar.close;
+    pending.volume = bar.volume;
+    pending.date_only = date_only;
+    pending_.push_back(pending);
+    ++size_;
+
+    if (pending_.size() >= block_size_) {
+        seal();
+    }
+    return true;
+}
+
+bool CompressedBarStore::append_all(const std::vector<MarketData>& bars) {
+    for (const MarketData& bar : bars) {
+        if (!append(bar)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CompressedBarStore::seal() {
+    if (pending_.empty()) {
+        return;
+    }
+
+    BlockInfo block;
+    block.offset = bytes_.size();
+    block.count = static_cast<uint32_t>(pending_.size());
+    block.min_timestamp = pending_.front().timestamp;
+    block.max_timestamp = pending_.back().timestamp;
+    block.flags = pending_.front().date_only ? kDateOnly : 0;
+
+    bool fixed = true;
+    for (const PendingBar& bar : pending_) {
+        if (!fits_fixed_point(bar.open) || !fits_fixed_point(bar.high) || !fits_fixed_point(bar.low) ||
+            !fits_fixed_point(bar.close) || !(bar.volume >= 0.0 && bar.volume < kMaxExact) ||
+            bar.volume != std::floor(bar.volume)) {
+            fixed = false;
+            break;
+        }
+    }
+    if (fixed) {
+        block.flags |= kFixedPoint;
+    }
+
+    // Timestamp column
+    int64_t previous = block.min_timestamp;
+    int64_t previous_delta = 0;
+    for (const PendingBar& bar : pending_) {
+        int64_t delta = bar.timestamp - previous;
+        put_varint(bytes_, zigzag(delta - previous_delta));
+        previous = bar.timestamp;
+        previous_delta = delta;
+    }
+
+    if (fixed) {
+        // Price columns, interleaved per bar so one pass decodes a bar
+        int64_t previous_close = 0;
+        for (const PendingBar& bar : pending_) {
+            int64_t open = std::llround(bar.open * price_scale_);
+            put_varint(bytes_, zigzag(open - previous_close));
+            put_varint(bytes_, zigzag(std::llround(bar.high * price_scale_) - open));
+            put_varint(bytes_, zigzag(std::llround(bar.low * price_scale_) - open));
+            previous_close = std::llround(bar.close * price_scale_);
+            put_varint(bytes_, zigzag(previous_close - open));
+        }
+        for (const PendingBar& bar : pending_) {
+            put_varint(bytes_, static_cast<uint64_t>(bar.volume));
+        }
+    } else {
+        uint64_t last[5] = {0, 0, 0, 0, 0};
+        for (const PendingBar& bar : pending_) {
+            const double values[5] = {bar.open, bar.high, bar.low, bar.close, bar.volume};
+            for (int field = 0; field < 5; ++field) {
+                uint64_t bits = double_bits(values[field]);
+                put_varint(bytes_, bits ^ last[field]);
+                last[field] = bits;
+            }
+        }
+    }
+
+    block.length = static_cast<uint32_t>(bytes_.size() - block.offset);
+    blocks_.push_back(block);
+    pending_.clear();
+}
+
+size_t CompressedBarStore::size() const {
+    return size_;
+}
+
+size_t CompressedBarStore::block_count() const {
+    return blocks_.size();
+}
+
+size_t CompressedBarStore::compressed_bytes() const {
+    return bytes_.size() + blocks_.size() * sizeof(BlockInfo);
+}
+
+double CompressedBarStore::get_price_scale() const {
+    return price_scale_;
+}
+
+int64_t CompressedBarStore::first_timestamp() const {
+    if (!blocks_.empty()) {
+        return blocks_.front().min_timestamp;
+    }
+    return pending_.empty() ? 0 : pending_.front().timestamp;
+}
+
+int64_t CompressedBarStore::last_timestamp() const {
+    if (!pending_.empty()) {
+        return pending_.back().timestamp;
+    }
+    return blocks_.empty() ? 0 : blocks_.back().max_timestamp;
+}
+
+void CompressedBarStore::decode_block(size_t index, std::vector<MarketData>& out) const {
+    if (index == blocks_.size()) {
+        decode_pending(out);
+        return;
+    }
+    if (index > blocks_.size()) {
+        throw std::out_of_range("Block index out of range");
+    }
+
+    const BlockInfo& block = blocks_[index];
+    const uint8_t* in = bytes_.data() + block.offset;
+    const uint8_t* end = in + block.length;
+    out.resize(block.count);
+
+    bool date_only = (block.flags & kDateOnly) != 0;
+    int64_t timestamp = block.min_timestamp;
+    int64_t delta = 0;
+    TimestampFormatter formatter;
+    for (MarketData& bar : out) {
+        delta += unzigzag(get_varint(in, end));
+        timestamp += delta;
+        formatter.format(timestamp, date_only, bar.timestamp);
+        bar.epoch = timestamp;
+    }
+
+    if (block.flags & kFixedPoint) {
+        int64_t close = 0;
+        for (MarketData& bar : out) {
+            int64_t open = close + unzigzag(get_varint(in, end));
+            int64_t high = open + unzigzag(get_varint(in, end));
+            int64_t low = open + unzigzag(get_varint(in, end));
+            close = open + unzigzag(get_varint(in, end));
+            bar.open = static_cast<double>(open) / price_scale_;
+            bar.high = static_cast<double>(high) / price_scale_;
+            bar.low = static_cast<double>(low) / price_scale_;
+            bar.close = static_cast<double>(close) / price_scale_;
+        }
+        for (MarketData& bar : out) {
+            bar.volume = static_cast<double>(get_varint(in, end));
+        }
+    } else {
+        uint64_t last[5] = {0, 0, 0, 0, 0};
+        for (MarketData& bar : out) {
+            for (int field = 0; field < 5; ++field) {
+                last[field] ^= get_varint(in, end);
+            }
+            bar.open = bits_double(last[0]);
+            bar.high = bits_double(last[1]);
+            bar.low = bits_double(last[2]);
+            bar.close = bits_double(last[3]);
+            bar.volume = bits_double(last[4]);
+        }
+    }
+}
+
+std::vector<MarketData> CompressedBarStore::decode_all() const {
+    std::vector<MarketData> result;
+    result.reserve(size_);
+    std::vector<MarketData> block;
+    for (size_t i = 0; i <= blocks_.size(); ++i) {
+        decode_block(i, block);
+        result.insert(result.end(), block.begin(), block.end());
+    }
+    return result;
+}
+
+std::vector<MarketData> CompressedBarStore::decode_range(int64_t from_epoch, int64_t to_epoch) const {
+    std::vector<MarketData> result;
+    std::vector<MarketData> block;
+
+    for (size_t i = 0; i <= blocks_.size(); ++i) {
+        if (i < blocks_.size() &&
+            (blocks_[i].max_timestamp < from_epoch || blocks_[i].min_timestamp > to_epoch)) {
+            continue;
+        }
+        decode_block(i, block);
+        for (const MarketData& bar : block) {
+            if (bar.epoch >= from_epoch && bar.epoch <= to_epoch) {
+                result.push_back(bar);
+            }
+        }
+    }
+    return result;
+}
+
+bool CompressedBarStore::save(const std::string& filename) {
+    seal();
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    out.write(kMagic, sizeof(kMagic));
+    write_pod(out, price_scale_);
+    write_pod(out, static_cast<uint64_t>(block_size_));
+    write_pod(out, static_cast<uint64_t>(size_));
+    write_pod(out, static_cast<uint64_t>(blocks_.size()));
+    for (const BlockInfo& block : blocks_) {
+        write_pod(out, block.offset);
+        write_pod(out, block.length);
+        write_pod(out, block.count);
+        write_pod(out, block.min_timestamp);
+        write_pod(out, block.max_timestamp);
+        write_pod(out, block.flags);
+    }
+    write_pod(out, static_cast<uint64_t>(bytes_.size()));
+    out.write(reinterpret_cast<const char*>(bytes_.data()), static_cast<std::streamsize>(bytes_.size()));
+    return static_cast<bool>(out);
+}
+
+bool CompressedBarStore::load(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    char magic[sizeof(kMagic)];
+    if (!in.is_open() || !in.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+        return false;
+    }
+
+    double price_scale;
+    uint64_t block_size, size, block_count, byte_count;
+    if (!read_pod(in, price_scale) || !read_pod(in, block_size) || !read_pod(in, size) ||
+        !read_pod(in, block_count)) {
+        return false;
+    }
+
+    std::vector<BlockInfo> blocks(static_cast<size_t>(block_count));
+    for (BlockInfo& block : blocks) {
+        if (!read_pod(in, block.offset) || !read_pod(in, block.length) || !read_pod(in, block.count) ||
+            !read_pod(in, block.min_timestamp) || !read_pod(in, block.max_timestamp) ||
+            !read_pod(in, block.flags)) {
+            return false;
+        }
+    }
+
+    std::vector<uint8_t> bytes;
+    if (!read_pod(in, byte_count)) {
+        return false;
+    }
+    bytes.resize(static_cast<size_t>(byte_count));
+    if (!in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+        return false;
+    }
+    if (!(price_scale > 0.0) || block_size == 0) {
+        return false;
+    }
+
+    // Every bar takes at least one byte per column, and the blocks must
+    // account for exactly 'size' bars
+    uint64_t counted = 0;
+    for (const BlockInfo& block : blocks) {
+        if (block.offset > bytes.size() || block.length > bytes.size() - block.offset ||
+            block.count > block_size || block.count > block.length) {
+            return false;
+        }
+        counted += block.count;
+    }
+    if (counted != size) {
+        return false;
+    }
+
+    price_scale_ = price_scale;
+    block_size_ = static_cast<size_t>(block_size);
+    size_ = static_cast<size_t>(size);
+    blocks_.swap(blocks);
+    bytes_.swap(bytes);
+    pending_.clear();
+    return true;
+}
+
+void CompressedBarStore::clear() {
+    size_ = 0;
+    bytes_.clear();
+    blocks_.clear();
+    pending_.clear();
+}
+
+CompressedBarStore::Cursor CompressedBarStore::cursor() const {
+    return Cursor(*this);
+}
+
+bool CompressedBarStore::fits_fixed_point(double value) const {
+    double scaled = value * price_scale_;
+    if (!(std::fabs(scaled) < kMaxExact)) {
+        return false;
+    }
+    return static_cast<double>(std::llround(scaled)) / price_scale_ == value;
+}
+
+void CompressedBarStore::decode_pending(std::vector<MarketData>& out) const {
+    out.resize(pending_.size());
+    for (size_t i = 0; i < pending_.size(); ++i) {
+        const PendingBar& bar = pending_[i];
+        out[i].timestamp = bar.date_only ? TimeUtils::format_date(bar.timestamp)
+                                         : TimeUtils::format_timestamp(bar.timestamp);
+        out[i].epoch = bar.timestamp;
+        out[i].open = bar.open;
+        out[i].high = bar.high;
+        out[i].low = bar.low;
+        out[i].close = bar.close;
+        out[i].volume = bar.volume;
+    }
+}
+
+// Cursor
+
+CompressedBarStore::Cursor::Cursor(const CompressedBarStore& store)
+    : store_(&store), block_(0), position_(0) {
+}
+
+const MarketData* CompressedBarStore::Cursor::next() {
+    while (position_ >= decoded_.size()) {
+        if (block_ > store_->blocks_.size()) {
+            return nullptr;
+        }
+        store_->decode_block(block_++, decoded_);
+        position_ = 0;
+    }
+    return &decoded_[position_++];
+}
+
+void CompressedBarStore::Cursor::rewind() {
+    block_ = 0;
+    position_ = 0;
+    decoded_.clear();
+}
+
+} // namespace TradingBot
@@ -1,12 +1,97 @@
 #include "data/csv_parser.h"
+#include "utils/work_stealing_pool.h"
 #include <fstream>
-#include <sstream>
 #include <stdexcept>
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace TradingBot {
 
-CSVParser::CSVParser() {
+namespace {
+
+// Rows below this are validated on the calling thread
+const size_t kParallelValidateRows = 1 << 16;
+
+// Smallest chunk worth handing to a thread
+const size_t kMinChunkBytes = 1 << 20;
+
+// Process-wide, so no two loads ever share a generation
+std::atomic<uint64_t> next_generation(1);
+
+// Read-only view of a whole file: memory-mapped where available
+class MappedFile {
+public:
+    MappedFile() : data_(nullptr), size_(0), mapped_(false) {}
+
+    ~MappedFile() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mapped_) {
+            munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& filename) {
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            ::close(fd);
+            return false;
+        }
+        size_ = static_cast<size_t>(info.st_size);
+        if (size_ > 0) {
+            void* address = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                madvise(address, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char*>(address);
+                mapped_ = true;
+            }
+        }
+        ::close(fd);
+        if (mapped_ || size_ == 0) {
+            return true;
+        }
+#endif
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        return true;
+    }
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_;
+    size_t size_;
+    bool mapped_;
+    std::string buffer_;
+};
+
+} // namespace
+
+CSVParser::CSVParser() : generation_(next_generation.fetch_add(1)) {
 }
 
 CSVParser::~CSVParser() {
@@ -22,6 +107,8 @@ bool CSVParser::load_data(const std::string& filename){
     }
 
     data_.clear();
+    source_ = filename;
+    generation_ = next_generation.fetch_add(1);
     std::string line;
 
     std::getline(file,line); //skip header
@@ -39,6 +126,77 @@ bool CSVParser::load_data(const std::string& filename){
     return !data_.empty();
 }
 
+bool CSVParser::load_data_parallel(const std::string& filename, size_t num_threads) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+
+    data_.clear();
+    source_ = filename;
+    generation_ = next_generation.fetch_add(1);
+
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+
+    // Skip header
+    const char* header_end = begin == end ? nullptr : static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    if (header_end == nullptr) {
+        return false;
+    }
+    const char* body = header_end + 1;
+    size_t body_size = static_cast<size_t>(end - body);
+
+    if (num_threads == 0) {
+        num_threads = WorkStealingPool::shared().get_thread_count();
+    }
+    num_threads = std::max<size_t>(1, std::min(num_threads, body_size / kMinChunkBytes));
+
+    // A few chunks per thread so an uneven chunk does not hold up the rest
+    size_t chunk_count = num_threads == 1 ? 1 : num_threads * 4;
+    std::vector<const char*> bounds(chunk_count + 1, end);
+    bounds[0] = body;
+    for (size_t i = 1; i < chunk_count; ++i) {
+        const char* bound = std::max(bounds[i - 1], body + body_size / chunk_count * i);
+        if (bound > body && bound < end && bound[-1] != '\n') {
+            const char* newline = static_cast<const char*>(std::memchr(bound, '\n', end - bound));
+            bound = newline ? newline + 1 : end;
+        }
+        bounds[i] = bound;
+    }
+
+    std::vector<std::vector<MarketData>> chunks(chunk_count);
+    parallel_for(WorkStealingPool::shared(), chunk_count, num_threads, [&](size_t c) {
+        const char* line = bounds[c];
+        const char* chunk_end = bounds[c + 1];
+        std::vector<MarketData>& rows = chunks[c];
+        rows.reserve(static_cast<size_t>(chunk_end - line) / 48);
+
+        while (line < chunk_end) {
+            const char* newline = static_cast<const char*>(std::memchr(line, '\n', chunk_end - line));
+            const char* line_end = newline ? newline : chunk_end;
+            if (line_end > line) {
+                rows.emplace_back();
+                parse_fields(line, line_end, rows.back());
+            }
+            line = line_end + 1;
+        }
+    });
+
+    // Stitch in file order
+    std::vector<size_t> offsets(chunk_count + 1, 0);
+    for (size_t c = 0; c < chunk_count; ++c) {
+        offsets[c + 1] = offsets[c] + chunks[c].size();
+    }
+    data_.resize(offsets[chunk_count]);
+    parallel_for(WorkStealingPool::shared(), chunk_count, num_threads, [&](size_t c) {
+        std::move(chunks[c].begin(), chunks[c].end(), data_.begin() + offsets[c]);
+        std::vector<MarketData>().swap(chunks[c]);
+    });
+
+    return !data_.empty();
+}
+
     // Get data at specific index
     const MarketData& CSVParser::get_data(size_t index) const {
 
@@ -65,10 +223,49 @@ bool CSVParser::load_data(const std::string& filename){
         return std::vector<MarketData>(data_.begin() + start, data_.begin() + end + 1);
     }
         
+    const std::vector<MarketData>& CSVParser::get_all_data() const {
+
+        return data_;
+    }
+
+    const std::string& CSVParser::get_source() const {
+
+        return source_;
+    }
+
+    uint64_t CSVParser::get_generation() const {
+
+        return generation_;
+    }
+        
     // Validate data integrity
     bool CSVParser::validate_data() const{
 
-        for(const auto& data : data_){
+        if (data_.size() < kParallelValidateRows) {
+            return validate_range(0, data_.size());
+        }
+
+        size_t threads = WorkStealingPool::shared().get_thread_count();
+        size_t chunk_count = threads * 4;
+        size_t chunk_size = (data_.size() + chunk_count - 1) / chunk_count;
+        std::atomic<bool> valid(true);
+
+        parallel_for(WorkStealingPool::shared(), chunk_count, threads, [&](size_t c) {
+            size_t begin = std::min(data_.size(), c * chunk_size);
+            size_t end = std::min(data_.size(), begin + chunk_size);
+            if (valid.load(std::memory_order_relaxed) && !validate_range(begin, end)) {
+                valid.store(false, std::memory_order_relaxed);
+            }
+        });
+
+        return valid.load();
+    }
+
+    bool CSVParser::validate_range(size_t begin, size_t end) const{
+
+        for(size_t i = begin; i < end; ++i){
+
+            const MarketData& data = data_[i];
 
             if(data.open <= 0 || data.high <= 0 || data.low <= 0 || data.close <= 0 || data.volume <= 0){
 
@@ -91,6 +288,8 @@ bool CSVParser::load_data(const std::string& filename){
     void CSVParser::clear(){
 
         data_.clear();
+        source_.clear();
+        generation_ = next_generation.fetch_add(1);
 
     }
 
@@ -98,49 +297,83 @@ bool CSVParser::load_data(const std::string& filename){
     // Helper function to parse a single line of CSV
     MarketData CSVParser::parse_line(const std::string&line){
 
-        std::stringstream ss(line);
-        std::string token;
         MarketData data;
-        size_t field_count = 0;
-
-        while(std::getline(ss,token,',')){
-
-            switch(field_count){
-                case 0:
-                    data.timestamp = token;
-                    break;
-                case 1:
-                    data.open = parse_double(token);
-                    break;
-                case 2:
-                    data.high = parse_double(token);
-                    break;
-                case 3:
-                    data.low = parse_double(token);
-                    break;
-                case 4:
-                    data.close = parse_double(token);
-                    break;
-                case 5:
-                    data.volume = parse_double(token);
-        }
+        parse_fields(line.data(), line.data() + line.size(), data);
+        return data;
 
-        field_count++;
+}
 
+bool get_epoch(const MarketData& bar, int64_t& epoch_seconds) {
+    if (bar.epoch != TimeUtils::NO_EPOCH) {
+        epoch_seconds = bar.epoch;
+        return true;
     }
+    return TimeUtils::parse_timestamp(bar.timestamp, epoch_seconds);
+}
 
-    return data;
+void CSVParser::parse_fields(const char* begin, const char* end, MarketData& data) {
+    size_t field_count = 0;
+    const char* token = begin;
+
+    while (token < end && field_count < 6) {
+        const char* comma = static_cast<const char*>(std::memchr(token, ',', end - token));
+        const char* token_end = comma ? comma : end;
+
+        switch (field_count) {
+            case 0:
+                data.timestamp.assign(token, token_end);
+                if (!TimeUtils::parse_timestamp(std::string_view(token, token_end - token), data.epoch)) {
+                    data.epoch = TimeUtils::NO_EPOCH;
+                }
+                break;
+            case 1:
+                data.open = parse_double(token, token_end);
+                break;
+            case 2:
+                data.high = parse_double(token, token_end);
+                break;
+            case 3:
+                data.low = parse_double(token, token_end);
+                break;
+            case 4:
+                data.close = parse_double(token, token_end);
+                break;
+            case 5:
+                data.volume = parse_double(token, token_end);
+                break;
+        }
 
+        field_count++;
+        token = token_end + 1;
+    }
 }
 
 double CSVParser::parse_double(const std::string&str){
-    try{
-        return std::stod(str);
-    }catch(const std::invalid_argument&e){
-        return 0.0;
-    }catch(const std::out_of_range&e){
+    return parse_double(str.data(), str.data() + str.size());
+}
+
+// Same result as std::stod, with 0.0 for text that is not a number or is out of range
+double CSVParser::parse_double(const char* begin, const char* end) {
+    char buffer[64];
+    std::string long_field;
+    const char* text = buffer;
+
+    size_t length = static_cast<size_t>(end - begin);
+    if (length < sizeof(buffer)) {
+        std::memcpy(buffer, begin, length);
+        buffer[length] = '\0';
+    } else {
+        long_field.assign(begin, end);
+        text = long_field.c_str();
+    }
+
+    char* parsed_end = nullptr;
+    errno = 0;
+    double value = std::strtod(text, &parsed_end);
+    if (parsed_end == text || errno == ERANGE) {
         return 0.0;
     }
+    return value;
 }
 
 }
@@ -0,0 +1,428 @@
+#include "data/market_journal.h"
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+// Version 2 stores each bar's epoch alongside its display timestamp
+const char kMagic[4] = {'T', 'B', 'J', '2'};
+
+// Largest record accepted by the reader; anything bigger is corruption
+const uint32_t kMaxRecordSize = 1u << 30;
+
+// Size of the fixed record prefix: u32 length, u8 type, i64 captured_ns
+const size_t kRecordPrefix = 4 + 1 + 8;
+
+int64_t wall_clock_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void put_fixed(std::string& out, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+void put_varint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void put_double(std::string& out, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    put_fixed(out, bits, 8);
+}
+
+void put_string(std::string& out, const std::string& value) {
+    put_varint(out, value.size());
+    out.append(value);
+}
+
+void put_bar(std::string& out, const MarketData& bar) {
+    put_string(out, bar.timestamp);
+    put_fixed(out, static_cast<uint64_t>(bar.epoch), 8);
+    put_double(out, bar.open);
+    put_double(out, bar.high);
+    put_double(out, bar.low);
+    put_double(out, bar.close);
+    put_double(out, bar.volume);
+}
+
+// Bounds-checked decoder over one record; any overrun clears 'ok'
+struct Cursor {
+    const char* p;
+    const char* end;
+    bool ok;
+
+    Cursor(const char* begin, const char* finish) : p(begin), end(finish), ok(true) {}
+
+    uint64_t fixed(int bytes) {
+        if (end - p < bytes) {
+            ok = false;
+            return 0;
+        }
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+        }
+        p += bytes;
+        return value;
+    }
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (p >= end) {
+                break;
+            }
+            unsigned char byte = static_cast<unsigned char>(*p++);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+
+    double real() {
+        uint64_t bits = fixed(8);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string text() {
+        uint64_t size = varint();
+        if (!ok || static_cast<uint64_t>(end - p) < size) {
+            ok = false;
+            return std::string();
+        }
+        std::string value(p, static_cast<size_t>(size));
+        p += size;
+        return value;
+    }
+
+    MarketData bar() {
+        MarketData data;
+        data.timestamp = text();
+        data.epoch = static_cast<int64_t>(fixed(8));
+        data.open = real();
+        data.high = real();
+        data.low = real();
+        data.close = real();
+        data.volume = real();
+        return data;
+    }
+};
+
+} // namespace
+
+// JournalWriter
+
+JournalWriter::JournalWriter() : records_written_(0) {
+}
+
+JournalWriter::~JournalWriter() {
+    close();
+}
+
+bool JournalWriter::open(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_.is_open()) {
+        file_.close();
+    }
+
+    // Appending to an existing journal requires a matching header
+    bool has_header = false;
+    {
+        std::ifstream existing(filename, std::ios::binary);
+        if (existing.is_open()) {
+            char magic[sizeof(kMagic)];
+            if (existing.read(magic, sizeof(magic))) {
+                if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+                    return false;
+                }
+                has_header = true;
+            }
+        }
+    }
+
+    file_.open(filename, std::ios::binary | std::ios::app);
+    if (!file_.is_open()) {
+        return false;
+    }
+    if (!has_header) {
+        file_.write(kMagic, sizeof(kMagic));
+    }
+
+    records_written_ = 0;
+    return file_.good();
+}
+
+void JournalWriter::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+bool JournalWriter::is_open() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return file_.is_open();
+}
+
+bool JournalWriter::record_response(JournalRecordType type, const std::string& symbol,
+                                    const APIResponse& response, int64_t captured_ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_.assign(kRecordPrefix, '\0');
+
+    put_string(buffer_, symbol);
+    buffer_.push_back(response.success ? 1 : 0);
+    put_string(buffer_, response.error_message);
+
+    put_varint(buffer_, response.metadata.size());
+    for (const auto& entry : response.metadata) {
+        put_string(buffer_, entry.first);
+        put_string(buffer_, entry.second);
+    }
+
+    put_varint(buffer_, response.data.size());
+    for (const MarketData& bar : response.data) {
+        put_bar(buffer_, bar);
+    }
+
+    return append(type, captured_ns);
+}
+
+bool JournalWriter::record_quote(const std::string& symbol, const MarketData& quote, int64_t captured_ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer_.assign(kRecordPrefix, '\0');
+    put_string(buffer_, symbol);
+    put_bar(buffer_, quote);
+    return append(JournalRecordType::QUOTE, captured_ns);
+}
+
+void JournalWriter::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_.is_open()) {
+        file_.flush();
+    }
+}
+
+size_t JournalWriter::get_records_written() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return records_written_;
+}
+
+// Fill in the prefix of the encoded record in buffer_ and write it out
+bool JournalWriter::append(JournalRecordType type, int64_t captured_ns) {
+    if (!file_.is_open()) {
+        return false;
+    }
+
+    std::string prefix;
+    put_fixed(prefix, buffer_.size() - 4, 4);
+    prefix.push_back(static_cast<char>(type));
+    put_fixed(prefix, static_cast<uint64_t>(captured_ns != 0 ? captured_ns : wall_clock_ns()), 8);
+    buffer_.replace(0, kRecordPrefix, prefix);
+
+    file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    if (!file_.good()) {
+        return false;
+    }
+    ++records_written_;
+    return true;
+}
+
+// JournalReader
+
+JournalReader::JournalReader() : truncated_(false) {
+}
+
+JournalReader::~JournalReader() {
+}
+
+bool JournalReader::open(const std::string& filename) {
+    close();
+    file_.open(filename, std::ios::binary);
+    if (!file_.is_open()) {
+        return false;
+    }
+
+    char magic[sizeof(kMagic)];
+    if (!file_.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+        file_.close();
+        return false;
+    }
+    return true;
+}
+
+void JournalReader::close() {
+    if (file_.is_open()) {
+        file_.close();
+    }
+    file_.clear();
+    truncated_ = false;
+}
+
+bool JournalReader::next(JournalRecord& record) {
+    if (!file_.is_open() || truncated_) {
+        return false;
+    }
+
+    char length_bytes[4];
+    file_.read(length_bytes, sizeof(length_bytes));
+    if (file_.gcount() == 0) {
+        return false;
+    }
+
+    Cursor length_cursor(length_bytes, length_bytes + file_.gcount());
+    uint32_t length = static_cast<uint32_t>(length_cursor.fixed(4));
+    if (!length_cursor.ok || length < 9 || length > kMaxRecordSize) {
+        truncated_ = true;
+        return false;
+    }
+
+    buffer_.resize(length);
+    file_.read(&buffer_[0], length);
+    if (static_cast<uint32_t>(file_.gcount()) != length) {
+        truncated_ = true;
+        return false;
+    }
+
+    Cursor in(buffer_.data(), buffer_.data() + buffer_.size());
+    uint8_t type = static_cast<uint8_t>(in.fixed(1));
+    record.type = static_cast<JournalRecordType>(type);
+    record.captured_ns = static_cast<int64_t>(in.fixed(8));
+    record.symbol = in.text();
+
+    if (record.type == JournalRecordType::QUOTE) {
+        record.quote = in.bar();
+    } else if (record.type == JournalRecordType::HISTORICAL_RESPONSE ||
+               record.type == JournalRecordType::QUOTE_RESPONSE) {
+        APIResponse& response = record.response;
+        response.success = in.fixed(1) != 0;
+        response.error_message = in.text();
+
+        response.metadata.clear();
+        uint64_t entries = in.varint();
+        for (uint64_t i = 0; i < entries && in.ok; ++i) {
+            std::string key = in.text();
+            response.metadata[key] = in.text();
+        }
+
+        response.data.clear();
+        uint64_t bars = in.varint();
+        for (uint64_t i = 0; i < bars && in.ok; ++i) {
+            response.data.push_back(in.bar());
+        }
+    } else {
+        in.ok = false;
+    }
+
+    if (!in.ok) {
+        truncated_ = true;
+        return false;
+    }
+    return true;
+}
+
+bool JournalReader::is_truncated() const {
+    return truncated_;
+}
+
+// RecordingAPIClient
+
+RecordingAPIClient::RecordingAPIClient(std::unique_ptr<APIClient> client,
+                                       std::shared_ptr<JournalWriter> journal)
+    : client_(std::move(client)), journal_(journal) {
+    if (!client_ || !journal_) {
+        throw std::invalid_argument("Null client or journal provided to RecordingAPIClient");
+    }
+}
+
+APIResponse RecordingAPIClient::fetch_historical_data(
+    const std::string& symbol,
+    DataInterval interval,
+    const std::string& start_date,
+    const std::string& end_date) {
+
+    APIResponse response = client_->fetch_historical_data(symbol, interval, start_date, end_date);
+    journal_->record_response(JournalRecordType::HISTORICAL_RESPONSE, symbol, response);
+    return response;
+}
+
+APIResponse RecordingAPIClient::fetch_latest_quote(const std::string& symbol) {
+    APIResponse response = client_->fetch_latest_quote(symbol);
+    journal_->record_response(JournalRecordType::QUOTE_RESPONSE, symbol, response);
+    return response;
+}
+
+std::string RecordingAPIClient::get_provider_name() const {
+    return client_->get_provider_name();
+}
+
+bool RecordingAPIClient::validate_api_key() {
+    return client_->validate_api_key();
+}
+
+// JournalAPIClient
+
+JournalAPIClient::JournalAPIClient() {
+}
+
+bool JournalAPIClient::load(const std::string& filename) {
+    JournalReader reader;
+    if (!reader.open(filename)) {
+        return false;
+    }
+
+    historical_.clear();
+    quotes_.clear();
+
+    JournalRecord record;
+    while (reader.next(record)) {
+        if (record.type == JournalRecordType::HISTORICAL_RESPONSE) {
+            historical_[record.symbol].responses.push_back(record.response);
+        } else if (record.type == JournalRecordType::QUOTE_RESPONSE) {
+            quotes_[record.symbol].responses.push_back(record.response);
+        }
+    }
+    return true;
+}
+
+APIResponse JournalAPIClient::fetch_historical_data(
+    const std::string& symbol,
+    DataInterval /*interval*/,
+    const std::string& /*start_date*/,
+    const std::string& /*end_date*/) {
+
+    return take(historical_, symbol);
+}
+
+APIResponse JournalAPIClient::fetch_latest_quote(const std::string& symbol) {
+    return take(quotes_, symbol);
+}
+
+APIResponse JournalAPIClient::take(std::map<std::string, ResponseQueue>& queues, const std::string& symbol) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = queues.find(symbol);
+    if (it == queues.end() || it->second.next >= it->second.responses.size()) {
+        APIResponse response;
+        response.success = false;
+        response.error_message = "No recorded response left for " + symbol;
+        return response;
+    }
+    return it->second.responses[it->second.next++];
+}
+
+} // namespace TradingBot
@@ -0,0 +1,100 @@
+#include "data/tick_data_parser.h"
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+
+namespace TradingBot {
+
+TickDataParser::TickDataParser() {
+}
+
+TickDataParser::~TickDataParser() {
+}
+
+bool TickDataParser::load_data(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    events_.clear();
+    std::string line;
+
+    std::getline(file, line); // skip header
+
+    BookEvent event;
+    while (std::getline(file, line)) {
+        if (!line.empty() && parse_line(line.data(), line.data() + line.size(), event)) {
+            events_.push_back(event);
+        }
+    }
+
+    return !events_.empty();
+}
+
+const BookEvent& TickDataParser::get_event(size_t index) const {
+    if (index >= events_.size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return events_[index];
+}
+
+size_t TickDataParser::get_event_count() const {
+    return events_.size();
+}
+
+const std::vector<BookEvent>& TickDataParser::get_all_events() const {
+    return events_;
+}
+
+void TickDataParser::add_event(const BookEvent& event) {
+    events_.push_back(event);
+}
+
+void TickDataParser::clear() {
+    events_.clear();
+}
+
+// Helper function to parse a single event line without allocating
+bool TickDataParser::parse_line(const char* begin, const char* end, BookEvent& event) const {
+    if (end > begin && end[-1] == '\r') {
+        --end;
+    }
+
+    auto result = std::from_chars(begin, end, event.timestamp);
+    if (result.ec != std::errc() || result.ptr + 4 >= end || result.ptr[0] != ',') {
+        return false;
+    }
+    const char* p = result.ptr + 1;
+
+    if (p[0] == 'Q') {
+        event.type = BookEventType::QUOTE;
+    } else if (p[0] == 'T') {
+        event.type = BookEventType::TRADE;
+    } else {
+        return false;
+    }
+
+    if (p[1] != ',' || p[3] != ',') {
+        return false;
+    }
+
+    if (p[2] == 'B') {
+        event.side = BookSide::BID;
+    } else if (p[2] == 'A') {
+        event.side = BookSide::ASK;
+    } else {
+        return false;
+    }
+    p += 4;
+
+    result = std::from_chars(p, end, event.price);
+    if (result.ec != std::errc() || result.ptr >= end || result.ptr[0] != ',') {
+        return false;
+    }
+
+    result = std::from_chars(result.ptr + 1, end, event.quantity);
+    return result.ec == std::errc() && event.price > 0.0 && event.quantity >= 0.0;
+}
+
+} // namespace TradingBot
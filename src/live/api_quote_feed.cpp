@@ -0,0 +1,25 @@
+#include "live/api_quote_feed.h"
+
+namespace TradingBot {
+
+APIQuoteFeed::APIQuoteFeed(APIDataFetcher& fetcher)
+    : fetcher_(fetcher) {
+}
+
+bool APIQuoteFeed::poll(const std::string& symbol, MarketData& quote) {
+    APIResponse response = fetcher_.fetch_quote(symbol);
+    if (!response.success || response.data.empty()) {
+        last_error_ = response.error_message;
+        return false;
+    }
+
+    // Providers may return a short history; the last row is the latest quote
+    quote = response.data.back();
+    return true;
+}
+
+const std::string& APIQuoteFeed::get_last_error() const {
+    return last_error_;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,92 @@
+#include "live/journal_replayer.h"
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace TradingBot {
+
+JournalReplayer::JournalReplayer()
+    : speed_(0.0), quotes_replayed_(0), truncated_(false) {
+}
+
+JournalReplayer::~JournalReplayer() {
+}
+
+void JournalReplayer::set_speed(double speed) {
+    speed_ = speed > 0.0 ? speed : 0.0;
+}
+
+double JournalReplayer::get_speed() const {
+    return speed_;
+}
+
+void JournalReplayer::set_symbol(const std::string& symbol) {
+    symbol_ = symbol;
+}
+
+BacktestResults JournalReplayer::replay(const std::string& journal_file,
+                                        std::shared_ptr<Strategy> strategy,
+                                        std::shared_ptr<RiskManager> risk_manager) {
+    if (!strategy || !risk_manager) {
+        throw std::invalid_argument("Null pointer provided to replay");
+    }
+
+    JournalReader reader;
+    if (!reader.open(journal_file)) {
+        throw std::runtime_error("Cannot open journal: " + journal_file);
+    }
+
+    BacktestState state;
+    begin_run(state);
+    strategy->reset();
+    risk_manager->reset();
+    latency_.reset();
+    quotes_replayed_ = 0;
+
+    auto replay_start = std::chrono::steady_clock::now();
+    int64_t first_capture = 0;
+
+    JournalRecord record;
+    while (reader.next(record)) {
+        if (record.type != JournalRecordType::QUOTE ||
+            (!symbol_.empty() && record.symbol != symbol_)) {
+            continue;
+        }
+
+        // Hold each quote until its recorded offset, scaled by the speed
+        if (speed_ > 0.0) {
+            if (quotes_replayed_ == 0) {
+                first_capture = record.captured_ns;
+            }
+            auto offset = std::chrono::nanoseconds(
+                static_cast<int64_t>((record.captured_ns - first_capture) / speed_));
+            std::this_thread::sleep_until(replay_start + offset);
+        }
+
+        auto decision_start = std::chrono::steady_clock::now();
+        process_bar(record.quote, *strategy, *risk_manager, state);
+        latency_.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - decision_start).count()));
+
+        ++quotes_replayed_;
+    }
+
+    truncated_ = reader.is_truncated();
+    end_run();
+
+    return results_;
+}
+
+size_t JournalReplayer::get_quotes_replayed() const {
+    return quotes_replayed_;
+}
+
+bool JournalReplayer::was_truncated() const {
+    return truncated_;
+}
+
+const LatencyHistogram& JournalReplayer::get_latency_histogram() const {
+    return latency_;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,200 @@
+#include "live/paper_trader.h"
+#include "utils/thread_utils.h"
+#include <chrono>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+int64_t steady_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t wall_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+PaperTrader::PaperTrader()
+    : running_(false), stop_requested_(false), ingest_done_(false),
+      quotes_received_(0), quotes_dropped_(0), decisions_(0), pinned_(false) {
+}
+
+PaperTrader::~PaperTrader() {
+    stop();
+    if (ingest_thread_.joinable()) {
+        ingest_thread_.join();
+    }
+    if (decision_thread_.joinable()) {
+        decision_thread_.join();
+    }
+}
+
+void PaperTrader::set_paper_config(const PaperTradingConfig& config) {
+    paper_config_ = config;
+}
+
+const PaperTradingConfig& PaperTrader::get_paper_config() const {
+    return paper_config_;
+}
+
+void PaperTrader::set_journal(std::shared_ptr<JournalWriter> journal) {
+    journal_ = journal;
+}
+
+bool PaperTrader::start(std::shared_ptr<Strategy> strategy,
+                        std::shared_ptr<QuoteFeed> feed,
+                        std::shared_ptr<RiskManager> risk_manager) {
+    if (!strategy || !feed || !risk_manager || running_ ||
+        ingest_thread_.joinable() || decision_thread_.joinable()) {
+        return false;
+    }
+
+    strategy_ = strategy;
+    feed_ = feed;
+    risk_manager_ = risk_manager;
+
+    begin_run(state_);
+    strategy_->reset();
+    risk_manager_->reset();
+    latency_.reset();
+    queue_.reset(new SPSCQueue<QuoteEvent>(paper_config_.queue_capacity));
+    stop_requested_ = false;
+    ingest_done_ = false;
+    quotes_received_ = 0;
+    quotes_dropped_ = 0;
+    decisions_ = 0;
+    pinned_ = false;
+    running_ = true;
+
+    decision_thread_ = std::thread(&PaperTrader::decision_loop, this);
+    ingest_thread_ = std::thread(&PaperTrader::ingest_loop, this);
+    return true;
+}
+
+void PaperTrader::stop() {
+    stop_requested_ = true;
+}
+
+const BacktestResults& PaperTrader::wait() {
+    if (ingest_thread_.joinable()) {
+        ingest_thread_.join();
+    }
+    if (decision_thread_.joinable()) {
+        decision_thread_.join();
+        end_run();
+    }
+    return results_;
+}
+
+bool PaperTrader::is_running() const {
+    return running_;
+}
+
+size_t PaperTrader::get_quotes_received() const {
+    return quotes_received_;
+}
+
+size_t PaperTrader::get_quotes_dropped() const {
+    return quotes_dropped_;
+}
+
+size_t PaperTrader::get_decisions() const {
+    return decisions_;
+}
+
+bool PaperTrader::is_decision_thread_pinned() const {
+    return pinned_;
+}
+
+const LatencyHistogram& PaperTrader::get_latency_histogram() const {
+    return latency_;
+}
+
+// Private helper methods
+
+void PaperTrader::ingest_loop() {
+    set_current_thread_name("paper-ingest");
+
+    const auto interval = std::chrono::milliseconds(paper_config_.poll_interval_ms);
+    auto next_poll = std::chrono::steady_clock::now();
+    QuoteEvent event;
+    MarketData last_quote;
+    bool have_last = false;
+
+    while (!stop_requested_) {
+        if (feed_->poll(paper_config_.symbol, event.quote)) {
+            bool unchanged = paper_config_.skip_unchanged_quotes && have_last &&
+                             event.quote.timestamp == last_quote.timestamp &&
+                             event.quote.close == last_quote.close;
+
+            if (!unchanged) {
+                last_quote = event.quote;
+                have_last = true;
+                event.received_ns = steady_now_ns();
+                event.received_wall_ns = wall_now_ns();
+
+                // Never wait on the decision thread: a full queue drops the quote
+                if (!queue_->try_push(std::move(event))) {
+                    ++quotes_dropped_;
+                }
+
+                size_t received = ++quotes_received_;
+                if (paper_config_.max_quotes > 0 && received >= paper_config_.max_quotes) {
+                    break;
+                }
+            }
+        }
+
+        if (feed_->exhausted()) {
+            break;
+        }
+
+        if (paper_config_.poll_interval_ms > 0) {
+            next_poll += interval;
+            std::this_thread::sleep_until(next_poll);
+        }
+    }
+
+    ingest_done_.store(true, std::memory_order_release);
+}
+
+void PaperTrader::decision_loop() {
+    set_current_thread_name("paper-decide");
+    if (paper_config_.decision_cpu >= 0) {
+        pinned_ = pin_current_thread(paper_config_.decision_cpu);
+    }
+
+    QuoteEvent event;
+    while (true) {
+        if (!queue_->try_pop(event)) {
+            // Everything ingestion published is visible once it reports done
+            if (ingest_done_.load(std::memory_order_acquire) && queue_->empty()) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        process_bar(event.quote, *strategy_, *risk_manager_, state_);
+        latency_.record(static_cast<uint64_t>(steady_now_ns() - event.received_ns));
+        ++decisions_;
+
+        // Journal after the decision so recording never counts toward latency
+        if (journal_) {
+            journal_->record_quote(paper_config_.symbol, event.quote, event.received_wall_ns);
+        }
+    }
+
+    if (journal_) {
+        journal_->flush();
+    }
+
+    running_ = false;
+}
+
+} // namespace TradingBot
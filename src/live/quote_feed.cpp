@@ -0,0 +1,25 @@
+#include "live/quote_feed.h"
+#include <stdexcept>
+
+namespace TradingBot {
+
+ReplayQuoteFeed::ReplayQuoteFeed(std::shared_ptr<CSVParser> data)
+    : data_(data), next_index_(0) {
+    if (!data_) {
+        throw std::invalid_argument("Null data provided to ReplayQuoteFeed");
+    }
+}
+
+bool ReplayQuoteFeed::poll(const std::string& /*symbol*/, MarketData& quote) {
+    if (exhausted()) {
+        return false;
+    }
+    quote = data_->get_data(next_index_++);
+    return true;
+}
+
+bool ReplayQuoteFeed::exhausted() const {
+    return next_index_ >= data_->get_data_count();
+}
+
+} // namespace TradingBot
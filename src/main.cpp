@@ -27,9 +27,16 @@ int main(int argc, char* argv[]) {
 
         LOG_INFO("Trading Bot initialized successfully");
 
+        // Batch mode: every job of a manifest, one consolidated results file
+        if (argc == 3 && std::string(argv[1]) == "--batch") {
+            LOG_INFO("Running batch manifest: " + std::string(argv[2]));
+            return trading_bot->run_batch(argv[2]) ? 0 : 1;
+        }
+
         // Check command line arguments
         if (argc < 3) {
             std::cout << "Usage: " << argv[0] << " <data_file> <strategy_name>" << std::endl;
+            std::cout << "       " << argv[0] << " --batch <manifest_file>" << std::endl;
             std::cout << "Example: " << argv[0] << " data/SPY.csv SMA_CROSSOVER" << std::endl;
             return 1;
         }
@@ -0,0 +1,381 @@
+#include "optimizer/parameter_optimizer.h"
+#include "config/bot_config.h"
+#include "utils/work_stealing_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+// Offspring that keep violating constraints are replaced by fresh samples
+const int MAX_REPAIR_ATTEMPTS = 50;
+
+} // namespace
+
+ParameterOptimizer::ParameterOptimizer() : rng_(config_.seed) {
+}
+
+ParameterOptimizer::~ParameterOptimizer() {
+}
+
+bool ParameterOptimizer::initialize(const OptimizerConfig& config) {
+    if (config.population_size < 2 || config.tournament_size == 0) {
+        return false;
+    }
+
+    if (config.elite_count >= config.population_size) {
+        return false;
+    }
+
+    if (config.crossover_rate < 0.0 || config.crossover_rate > 1.0 ||
+        config.mutation_rate < 0.0 || config.mutation_rate > 1.0) {
+        return false;
+    }
+
+    config_ = config;
+    rng_.seed(config.seed);
+    evaluated_.clear();
+    return true;
+}
+
+void ParameterOptimizer::add_parameter(const ParameterRange& range) {
+    if (range.max_value < range.min_value) {
+        throw std::invalid_argument("Invalid range for parameter: " + range.name);
+    }
+    ranges_.push_back(range);
+}
+
+const std::vector<ParameterRange>& ParameterOptimizer::get_parameters() const {
+    return ranges_;
+}
+
+void ParameterOptimizer::set_indicator_cache(std::shared_ptr<IndicatorCache> cache) {
+    indicator_cache_ = cache;
+}
+
+void ParameterOptimizer::set_session_calendar(const SessionCalendar& calendar) {
+    calendar_ = calendar;
+}
+
+OptimizationResult ParameterOptimizer::optimize(const StrategyFactory& factory,
+                                                std::shared_ptr<CSVParser> data,
+                                                const BacktestConfig& backtest_config,
+                                                const RiskParameters& base_risk_params) {
+    if (!factory || !data) {
+        throw std::invalid_argument("Null factory or data provided to optimize");
+    }
+
+    if (ranges_.empty()) {
+        throw std::invalid_argument("No parameters to optimize");
+    }
+
+    OptimizationResult result;
+    result.best_score = -std::numeric_limits<double>::infinity();
+    evaluated_.clear();
+
+    // Candidates sharing a period reuse the same indicator series
+    if (!indicator_cache_) {
+        indicator_cache_ = std::make_shared<IndicatorCache>();
+    }
+
+    // Only summary metrics are needed per candidate
+    BacktestConfig run_config = backtest_config;
+    run_config.record_trades = false;
+    run_config.record_equity_curve = false;
+
+    auto deadline = std::chrono::steady_clock::time_point::max();
+    if (config_.time_budget_seconds > 0.0) {
+        deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(config_.time_budget_seconds));
+    }
+
+    // Initial population: random points that satisfy the constraints
+    std::vector<Genome> population;
+    for (size_t i = 0; i < config_.population_size; ++i) {
+        Genome genome;
+        int attempts = 0;
+        do {
+            genome = random_genome();
+        } while (!is_valid(genome, factory, base_risk_params) && ++attempts < MAX_REPAIR_ATTEMPTS);
+
+        if (attempts < MAX_REPAIR_ATTEMPTS) {
+            population.push_back(genome);
+        }
+    }
+
+    if (population.empty()) {
+        throw std::runtime_error("Could not sample any valid parameter set");
+    }
+
+    auto fitness = [this](const Genome& genome) {
+        auto it = evaluated_.find(genome);
+        return (it != evaluated_.end() && it->second.valid) ?
+            it->second.score : -std::numeric_limits<double>::infinity();
+    };
+
+    while (true) {
+        evaluate_batch(population, factory, data, run_config, base_risk_params, deadline, result);
+        ++result.generations;
+
+        if (result.evaluations >= config_.max_evaluations ||
+            result.generations >= config_.max_generations ||
+            std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+
+        // Keep only evaluated individuals (the budget can cut a batch short)
+        population.erase(std::remove_if(population.begin(), population.end(),
+                                        [this](const Genome& g) { return evaluated_.count(g) == 0; }),
+                         population.end());
+        if (population.empty()) {
+            break;
+        }
+
+        std::sort(population.begin(), population.end(),
+                  [&fitness](const Genome& a, const Genome& b) { return fitness(a) > fitness(b); });
+
+        std::vector<Genome> next_generation(population.begin(),
+            population.begin() + std::min(config_.elite_count, population.size()));
+
+        while (next_generation.size() < config_.population_size) {
+            next_generation.push_back(valid_offspring(population, factory, base_risk_params));
+        }
+
+        population.swap(next_generation);
+    }
+
+    for (const auto& entry : evaluated_) {
+        if (entry.second.valid && entry.second.score > result.best_score) {
+            result.best_score = entry.second.score;
+            result.best_parameters = to_map(entry.first);
+            result.best_results = entry.second.results;
+        }
+    }
+
+    return result;
+}
+
+// Private helper methods
+
+ParameterOptimizer::Genome ParameterOptimizer::random_genome() {
+    Genome genome(ranges_.size());
+    for (size_t i = 0; i < ranges_.size(); ++i) {
+        std::uniform_real_distribution<double> dist(ranges_[i].min_value, ranges_[i].max_value);
+        genome[i] = dist(rng_);
+    }
+    snap(genome);
+    return genome;
+}
+
+ParameterOptimizer::Genome ParameterOptimizer::crossover(const Genome& a, const Genome& b) {
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+
+    if (coin(rng_) >= config_.crossover_rate) {
+        return a;
+    }
+
+    // Uniform crossover
+    Genome child(a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        child[i] = coin(rng_) < 0.5 ? a[i] : b[i];
+    }
+    return child;
+}
+
+void ParameterOptimizer::mutate(Genome& genome) {
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+
+    for (size_t i = 0; i < genome.size(); ++i) {
+        // Gaussian step of 10% of the range, at least one grid step; a fixed
+        // parameter (min == max, no step) has nowhere to move
+        double sigma = std::max(0.1 * (ranges_[i].max_value - ranges_[i].min_value), ranges_[i].step);
+        if (sigma > 0.0 && coin(rng_) < config_.mutation_rate) {
+            std::normal_distribution<double> step(0.0, sigma);
+            genome[i] += step(rng_);
+        }
+    }
+    snap(genome);
+}
+
+const ParameterOptimizer::Genome& ParameterOptimizer::tournament_select(const std::vector<Genome>& population) {
+    // Population is sorted best-first, so the lowest sampled index wins
+    std::uniform_int_distribution<size_t> pick(0, population.size() - 1);
+    size_t best = pick(rng_);
+    for (size_t i = 1; i < config_.tournament_size; ++i) {
+        best = std::min(best, pick(rng_));
+    }
+    return population[best];
+}
+
+void ParameterOptimizer::snap(Genome& genome) const {
+    for (size_t i = 0; i < genome.size(); ++i) {
+        const ParameterRange& range = ranges_[i];
+        double value = std::min(std::max(genome[i], range.min_value), range.max_value);
+        if (range.step > 0.0) {
+            value = range.min_value + std::round((value - range.min_value) / range.step) * range.step;
+            value = std::min(value, range.max_value);
+        }
+        genome[i] = value;
+    }
+}
+
+bool ParameterOptimizer::is_valid(const Genome& genome, const StrategyFactory& factory,
+                                  const RiskParameters& base_risk_params) const {
+    std::map<std::string, double> strategy_params;
+    RiskParameters risk_params = base_risk_params;
+    if (!split_parameters(genome, strategy_params, risk_params)) {
+        return false;
+    }
+
+    std::unique_ptr<Strategy> strategy = factory();
+    if (!strategy || !strategy->validate_parameters(strategy_params)) {
+        return false;
+    }
+
+    RiskManager risk_manager;
+    return risk_manager.initialize(risk_params);
+}
+
+ParameterOptimizer::Genome ParameterOptimizer::valid_offspring(const std::vector<Genome>& population,
+                                                               const StrategyFactory& factory,
+                                                               const RiskParameters& base_risk_params) {
+    for (int attempt = 0; attempt < MAX_REPAIR_ATTEMPTS; ++attempt) {
+        Genome child = crossover(tournament_select(population), tournament_select(population));
+        mutate(child);
+        if (is_valid(child, factory, base_risk_params)) {
+            return child;
+        }
+    }
+
+    for (int attempt = 0; attempt < MAX_REPAIR_ATTEMPTS; ++attempt) {
+        Genome genome = random_genome();
+        if (is_valid(genome, factory, base_risk_params)) {
+            return genome;
+        }
+    }
+
+    // Constraints are too tight to satisfy by sampling; reuse a known-valid parent
+    return population.front();
+}
+
+bool ParameterOptimizer::split_parameters(const Genome& genome, std::map<std::string, double>& strategy_params,
+                                          RiskParameters& risk_params) const {
+    for (size_t i = 0; i < ranges_.size(); ++i) {
+        std::string error;
+        if (set_risk_parameter(risk_params, ranges_[i].name, genome[i], error)) {
+            continue;
+        }
+        if (!error.empty()) {
+            // A risk value out of range: the genome cannot be run as given
+            return false;
+        }
+        strategy_params[ranges_[i].name] = genome[i];
+    }
+    return true;
+}
+
+std::map<std::string, double> ParameterOptimizer::to_map(const Genome& genome) const {
+    std::map<std::string, double> params;
+    for (size_t i = 0; i < ranges_.size(); ++i) {
+        params[ranges_[i].name] = genome[i];
+    }
+    return params;
+}
+
+void ParameterOptimizer::evaluate_batch(const std::vector<Genome>& genomes, const StrategyFactory& factory,
+                                        std::shared_ptr<CSVParser> data, const BacktestConfig& backtest_config,
+                                        const RiskParameters& base_risk_params,
+                                        std::chrono::steady_clock::time_point deadline,
+                                        OptimizationResult& result) {
+    // Collect unseen points within the remaining evaluation budget
+    std::vector<Genome> pending;
+    std::set<Genome> queued;
+    for (const auto& genome : genomes) {
+        if (evaluated_.count(genome) || queued.count(genome)) {
+            ++result.cache_hits;
+            continue;
+        }
+        if (result.evaluations + pending.size() >= config_.max_evaluations) {
+            break;
+        }
+        queued.insert(genome);
+        pending.push_back(genome);
+    }
+
+    if (pending.empty()) {
+        return;
+    }
+
+    std::vector<Evaluation> evaluations(pending.size());
+    std::vector<char> completed(pending.size(), 0);
+    // Evaluations share the process-wide scheduler; num_threads caps how many run at once
+    parallel_for(WorkStealingPool::shared(), pending.size(), config_.num_threads, [&](size_t index) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return;
+        }
+        evaluations[index] = evaluate(pending[index], factory, data, backtest_config, base_risk_params);
+        completed[index] = 1;
+    });
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        if (completed[i]) {
+            evaluated_[pending[i]] = evaluations[i];
+            ++result.evaluations;
+        }
+    }
+}
+
+ParameterOptimizer::Evaluation ParameterOptimizer::evaluate(const Genome& genome, const StrategyFactory& factory,
+                                                            std::shared_ptr<CSVParser> data,
+                                                            const BacktestConfig& backtest_config,
+                                                            const RiskParameters& base_risk_params) const {
+    Evaluation evaluation;
+
+    std::map<std::string, double> strategy_params;
+    RiskParameters risk_params = base_risk_params;
+    if (!split_parameters(genome, strategy_params, risk_params)) {
+        return evaluation;
+    }
+
+    try {
+        std::shared_ptr<Strategy> strategy(factory());
+        auto risk_manager = std::make_shared<RiskManager>();
+        if (!strategy || !strategy->initialize(strategy_params) || !risk_manager->initialize(risk_params)) {
+            return evaluation;
+        }
+        risk_manager->set_session_calendar(calendar_);
+
+        Backtester backtester;
+        if (!backtester.initialize(backtest_config)) {
+            return evaluation;
+        }
+        backtester.set_indicator_cache(indicator_cache_);
+
+        evaluation.results = backtester.run_backtest(strategy, data, risk_manager);
+        evaluation.score = score(evaluation.results);
+        evaluation.valid = std::isfinite(evaluation.score);
+    } catch (const std::exception&) {
+        evaluation.valid = false;
+    }
+
+    return evaluation;
+}
+
+double ParameterOptimizer::score(const BacktestResults& results) const {
+    switch (config_.objective) {
+        case OptimizationObjective::TOTAL_RETURN:
+            return results.total_return;
+        case OptimizationObjective::PROFIT_FACTOR:
+            return results.profit_factor;
+        case OptimizationObjective::SHARPE_RATIO:
+        default:
+            return results.sharpe_ratio;
+    }
+}
+
+} // namespace TradingBot
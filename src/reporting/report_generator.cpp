@@ -1,5 +1,7 @@
 #include "reporting/report_generator.h"
 #include "utils/logger.h"
+#include "utils/work_stealing_pool.h"
+#include <atomic>
 #include <fstream>
 #include <sstream>
 
@@ -74,6 +76,27 @@ namespace TradingBot {
         }
     }
     
+    size_t ReportGenerator::generate_reports(const std::map<std::string, BacktestResults>& results,
+                                             const std::string& output_prefix) {
+        std::vector<const std::pair<const std::string, BacktestResults>*> entries;
+        for (const auto& entry : results) {
+            entries.push_back(&entry);
+        }
+        
+        // Two files per result, each its own task
+        std::atomic<size_t> written(0);
+        parallel_for(WorkStealingPool::shared(), entries.size() * 2, 0, [&](size_t i) {
+            const auto& entry = *entries[i / 2];
+            bool ok = i % 2 == 0 ?
+                generate_html_report(entry.second, output_prefix + entry.first + ".html") :
+                generate_csv_report(entry.second, output_prefix + entry.first + ".csv");
+            if (ok) {
+                written.fetch_add(1);
+            }
+        });
+        return written.load();
+    }
+    
     std::string ReportGenerator::generate_summary(const BacktestResults& results) {
         std::stringstream ss;
         ss << "=== Backtest Summary ===\n";
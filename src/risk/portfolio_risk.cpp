@@ -0,0 +1,264 @@
+#include "risk/portfolio_risk.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+// Standard normal quantile for p in (0.5, 1) (Acklam's rational approximation)
+double normal_quantile(double p) {
+    static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                               1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                               6.680131188771972e+01, -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                               -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                               3.754408661907416e+00};
+
+    if (p <= 0.97575) {
+        double q = p - 0.5;
+        double r = q * q;
+        return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+               (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+    }
+    double q = std::sqrt(-2.0 * std::log(1.0 - p));
+    return -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+           ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+}
+
+} // namespace
+
+std::string risk_check_name(RiskCheckResult result) {
+    switch (result) {
+        case RiskCheckResult::ACCEPTED: return "ACCEPTED";
+        case RiskCheckResult::GROSS_EXPOSURE: return "GROSS_EXPOSURE";
+        case RiskCheckResult::NET_EXPOSURE: return "NET_EXPOSURE";
+        case RiskCheckResult::CONCENTRATION: return "CONCENTRATION";
+        case RiskCheckResult::DAILY_LOSS: return "DAILY_LOSS";
+        case RiskCheckResult::VALUE_AT_RISK: return "VALUE_AT_RISK";
+        case RiskCheckResult::NO_PRICE: return "NO_PRICE";
+    }
+    return "UNKNOWN";
+}
+
+PortfolioRiskEngine::PortfolioRiskEngine() {
+    initialize(PortfolioRiskLimits(), 100000.0);
+}
+
+PortfolioRiskEngine::~PortfolioRiskEngine() {
+}
+
+bool PortfolioRiskEngine::initialize(const PortfolioRiskLimits& limits, double cash) {
+    if (limits.max_gross_exposure <= 0.0 || limits.max_net_exposure <= 0.0 ||
+        limits.max_concentration <= 0.0 || limits.max_daily_loss <= 0.0 || limits.max_var <= 0.0 ||
+        limits.var_confidence <= 0.5 || limits.var_confidence >= 1.0 ||
+        limits.covariance_decay <= 0.0 || limits.covariance_decay >= 1.0 || cash <= 0.0) {
+        return false;
+    }
+
+    limits_ = limits;
+    z_score_ = normal_quantile(limits.var_confidence);
+    cash_ = cash;
+    day_start_equity_ = cash;
+    bars_ = 0;
+
+    index_.clear();
+    positions_.clear();
+    prices_.clear();
+    exposures_.clear();
+    returns_.clear();
+    covariance_.clear();
+    sigma_exposure_.clear();
+    gross_ = 0.0;
+    net_ = 0.0;
+    variance_ = 0.0;
+    return true;
+}
+
+size_t PortfolioRiskEngine::add_symbol(const std::string& symbol) {
+    auto it = index_.find(symbol);
+    if (it != index_.end()) {
+        return it->second;
+    }
+
+    // Grow the matrix by a zero row and column
+    size_t n = positions_.size();
+    std::vector<double> covariance((n + 1) * (n + 1), 0.0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            covariance[i * (n + 1) + j] = covariance_[i * n + j];
+        }
+    }
+    covariance_.swap(covariance);
+
+    positions_.push_back(0.0);
+    prices_.push_back(0.0);
+    exposures_.push_back(0.0);
+    returns_.push_back(0.0);
+    sigma_exposure_.push_back(0.0);
+    index_[symbol] = n;
+    return n;
+}
+
+size_t PortfolioRiskEngine::find_symbol(const std::string& symbol) const {
+    auto it = index_.find(symbol);
+    return it != index_.end() ? it->second : npos;
+}
+
+size_t PortfolioRiskEngine::symbol_count() const {
+    return positions_.size();
+}
+
+void PortfolioRiskEngine::update_prices(const std::vector<double>& closes) {
+    size_t n = positions_.size();
+    if (closes.size() != n) {
+        throw std::invalid_argument("update_prices needs one close per registered symbol");
+    }
+
+    // Returns, marks and exposure totals
+    gross_ = 0.0;
+    net_ = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double close = closes[i];
+        returns_[i] = close > 0.0 && prices_[i] > 0.0 ? close / prices_[i] - 1.0 : 0.0;
+        if (close > 0.0) {
+            prices_[i] = close;
+        }
+        exposures_[i] = positions_[i] * prices_[i];
+        gross_ += std::fabs(exposures_[i]);
+        net_ += exposures_[i];
+    }
+
+    // Rank-1 EWMA update, fused with Sigma * exposure so each row is read once
+    double decay = limits_.covariance_decay;
+    double weight = 1.0 - decay;
+    variance_ = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        double* row = &covariance_[i * n];
+        double scaled = weight * returns_[i];
+        double sum = 0.0;
+        for (size_t j = 0; j < n; ++j) {
+            row[j] = decay * row[j] + scaled * returns_[j];
+            sum += row[j] * exposures_[j];
+        }
+        sigma_exposure_[i] = sum;
+        variance_ += exposures_[i] * sum;
+    }
+    ++bars_;
+}
+
+RiskCheckResult PortfolioRiskEngine::check_order(size_t symbol, double quantity) const {
+    if (symbol >= positions_.size()) {
+        throw std::out_of_range("Unknown symbol index in check_order");
+    }
+
+    double before = positions_[symbol];
+    double after = before + quantity;
+    if (before * after >= 0.0 && std::fabs(after) <= std::fabs(before)) {
+        return RiskCheckResult::ACCEPTED;
+    }
+
+    // Without a mark the order's exposure would count as zero
+    if (!(prices_[symbol] > 0.0)) {
+        return RiskCheckResult::NO_PRICE;
+    }
+
+    // Trading at the mark swaps cash for position, so equity is unchanged
+    double equity = get_equity();
+    if (equity <= day_start_equity_ * (1.0 - limits_.max_daily_loss)) {
+        return RiskCheckResult::DAILY_LOSS;
+    }
+
+    double delta = quantity * prices_[symbol];
+    double exposure = exposures_[symbol] + delta;
+    if (gross_ - std::fabs(exposures_[symbol]) + std::fabs(exposure) > limits_.max_gross_exposure * equity) {
+        return RiskCheckResult::GROSS_EXPOSURE;
+    }
+    if (std::fabs(net_ + delta) > limits_.max_net_exposure * equity) {
+        return RiskCheckResult::NET_EXPOSURE;
+    }
+    if (std::fabs(exposure) > limits_.max_concentration * equity) {
+        return RiskCheckResult::CONCENTRATION;
+    }
+
+    if (bars_ >= limits_.var_warmup_bars) {
+        size_t n = positions_.size();
+        double variance = variance_ + 2.0 * delta * sigma_exposure_[symbol] +
+                          delta * delta * covariance_[symbol * n + symbol];
+        if (z_score_ * std::sqrt(std::max(variance, 0.0)) > limits_.max_var * equity) {
+            return RiskCheckResult::VALUE_AT_RISK;
+        }
+    }
+    return RiskCheckResult::ACCEPTED;
+}
+
+void PortfolioRiskEngine::apply_fill(size_t symbol, double quantity, double price) {
+    if (symbol >= positions_.size()) {
+        throw std::out_of_range("Unknown symbol index in apply_fill");
+    }
+
+    size_t n = positions_.size();
+    if (prices_[symbol] <= 0.0) {
+        prices_[symbol] = price;
+    }
+    cash_ -= quantity * price;
+    positions_[symbol] += quantity;
+
+    double delta = quantity * prices_[symbol];
+    double before = exposures_[symbol];
+    exposures_[symbol] = before + delta;
+    gross_ += std::fabs(exposures_[symbol]) - std::fabs(before);
+    net_ += delta;
+
+    // Covariance is symmetric, so the symbol's row is also its column
+    const double* row = &covariance_[symbol * n];
+    variance_ += 2.0 * delta * sigma_exposure_[symbol] + delta * delta * row[symbol];
+    for (size_t i = 0; i < n; ++i) {
+        sigma_exposure_[i] += delta * row[i];
+    }
+}
+
+void PortfolioRiskEngine::start_day() {
+    day_start_equity_ = get_equity();
+}
+
+double PortfolioRiskEngine::get_equity() const {
+    return cash_ + net_;
+}
+
+double PortfolioRiskEngine::get_gross_exposure() const {
+    return gross_;
+}
+
+double PortfolioRiskEngine::get_net_exposure() const {
+    return net_;
+}
+
+double PortfolioRiskEngine::get_position(size_t symbol) const {
+    return positions_.at(symbol);
+}
+
+double PortfolioRiskEngine::get_price(size_t symbol) const {
+    return prices_.at(symbol);
+}
+
+double PortfolioRiskEngine::get_value_at_risk() const {
+    return z_score_ * std::sqrt(std::max(variance_, 0.0));
+}
+
+double PortfolioRiskEngine::get_covariance(size_t a, size_t b) const {
+    size_t n = positions_.size();
+    if (a >= n || b >= n) {
+        throw std::out_of_range("Unknown symbol index in get_covariance");
+    }
+    return covariance_[a * n + b];
+}
+
+const PortfolioRiskLimits& PortfolioRiskEngine::get_limits() const {
+    return limits_;
+}
+
+} // namespace TradingBot
@@ -1,11 +1,67 @@
 #include "risk/risk_manager.h"
+#include "strategy/indicator_kernels.h"
+#include "utils/time_utils.h"
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <stdexcept>
 
 namespace TradingBot {
 
-RiskManager::RiskManager() {
+namespace {
+
+// Session index before any bar has been seen
+const int64_t kNoSession = INT64_MIN;
+
+// Days of calendar table built ahead when a bar falls outside it
+const int64_t kCalendarSpanDays = 366;
+
+double true_range(const MarketData& bar, double prev_close) {
+    return std::max({bar.high - bar.low, std::abs(bar.high - prev_close), std::abs(bar.low - prev_close)});
+}
+
+} // namespace
+
+VolatilityTracker::VolatilityTracker(int period) {
+    reset(period);
+}
+
+void VolatilityTracker::reset(int period) {
+    true_ranges_.reset(period);
+    returns_.reset(period);
+    prev_close_ = 0.0;
+    has_prev_ = false;
+}
+
+void VolatilityTracker::update(const MarketData& bar) {
+    if (!has_prev_) {
+        prev_close_ = bar.close;
+        has_prev_ = true;
+        return;
+    }
+    
+    true_ranges_.push(true_range(bar, prev_close_));
+    returns_.push(prev_close_ != 0.0 ? bar.close / prev_close_ - 1.0 : 0.0);
+    prev_close_ = bar.close;
+}
+
+bool VolatilityTracker::is_ready() const {
+    return true_ranges_.is_ready();
+}
+
+double VolatilityTracker::get_atr() const {
+    return true_ranges_.get_mean();
+}
+
+double VolatilityTracker::get_return_stdev() const {
+    return returns_.get_stdev();
+}
+
+int VolatilityTracker::get_period() const {
+    return true_ranges_.get_window();
+}
+
+RiskManager::RiskManager() : peak_value_(0.0), day_begin_(0), day_end_(0), session_(kNoSession) {
     // risk_params_ is automatically initialized with default values from RiskParameters constructor
 }
 
@@ -33,6 +89,11 @@ bool RiskManager::initialize(const RiskParameters& params) {
         return false;
     }
     
+    if (params.position_sizing_atr < 0.0 || params.atr_period < 1) {
+        return false;
+    }
+    
+    volatility_.reset(params.atr_period);
     return true;
 }
 
@@ -43,8 +104,8 @@ bool RiskManager::validate_trade(const TradingSignal& signal, const PortfolioSta
     }
     
     
-    if (!check_daily_loss_limit(portfolio)) {
-    
+    // Exits stay open once the day's loss limit is hit
+    if (signal.type == SignalType::BUY && !check_daily_loss_limit(portfolio)) {
         return false;
     }
     
@@ -73,9 +134,14 @@ double RiskManager::calculate_position_size(const TradingSignal& signal,
     
     double max_risk_amount = portfolio.total_value * risk_params_.max_position_size;
     
-    // Simple position sizing without ATR (since we only have current_data)
-    // TODO: Modify function signature to accept historical data for ATR calculation
-    double position_size = max_risk_amount / signal.price;
+    // Volatility-targeted: the risk amount buys a move of position_sizing_atr x ATR
+    double position_size;
+    double stop_distance = risk_params_.position_sizing_atr * volatility_.get_atr();
+    if (volatility_.is_ready() && stop_distance > 0.0) {
+        position_size = max_risk_amount / stop_distance;
+    } else {
+        position_size = max_risk_amount / signal.price;
+    }
     
     // Max 10% of portfolio in one stock
     double max_shares_by_portfolio = portfolio.total_value * 0.1 / signal.price;
@@ -84,6 +150,31 @@ double RiskManager::calculate_position_size(const TradingSignal& signal,
     return position_size;
 }
 
+void RiskManager::update_market_data(const MarketData& bar, PortfolioState& portfolio) {
+    volatility_.update(bar);
+    
+    // Within the current day this is two compares; bars without a readable
+    // timestamp never roll the day
+    int64_t epoch;
+    if (!get_epoch(bar, epoch) ||
+        (epoch >= day_begin_ && epoch < day_end_ && portfolio.day_start_value > 0.0)) {
+        return;
+    }
+    
+    // A new calendar day starts a new trading day only if it is in a new
+    // session: weekend and holiday bars belong to the session that follows
+    int64_t day = calendar_.trading_day(epoch);
+    if (!calendar_.covers(day)) {
+        calendar_.build(epoch, epoch + kCalendarSpanDays * 86400);
+    }
+    calendar_.day_bounds(epoch, day_begin_, day_end_);
+    int64_t session = calendar_.session_index(day);
+    if (session != session_ || portfolio.day_start_value <= 0.0) {
+        session_ = session;
+        portfolio.day_start_value = portfolio.total_value;
+    }
+}
+
 void RiskManager::update_portfolio_state(PortfolioState& portfolio, 
                                         const TradingSignal& signal,
                                         const MarketData& data) {
@@ -119,13 +210,15 @@ void RiskManager::update_portfolio_state(PortfolioState& portfolio,
     portfolio.total_value = portfolio.cash;
     
 
-    static double peak_value = portfolio.total_value;
+    if (peak_value_ <= 0.0) {
+        peak_value_ = previous_total_value;
+    }
     
-    if (portfolio.total_value > peak_value) {
-        peak_value = portfolio.total_value;
+    if (portfolio.total_value > peak_value_) {
+        peak_value_ = portfolio.total_value;
         portfolio.current_drawdown = 0.0; // New high, reset drawdown
     } else {
-        portfolio.current_drawdown = calculate_drawdown(peak_value, portfolio.total_value);
+        portfolio.current_drawdown = calculate_drawdown(peak_value_, portfolio.total_value);
         
         // Update max drawdown if current is worse
         if (portfolio.current_drawdown > portfolio.max_drawdown) {
@@ -181,45 +274,63 @@ bool RiskManager::should_close_position(const Position& position,
     return false;
 }
 
+void RiskManager::reset() {
+    peak_value_ = 0.0;
+    volatility_.reset(risk_params_.atr_period);
+    day_begin_ = 0;
+    day_end_ = 0;
+    session_ = kNoSession;
+}
+
+std::unique_ptr<RiskManager> RiskManager::clone() const {
+    return std::make_unique<RiskManager>(*this);
+}
+
 const RiskParameters& RiskManager::get_risk_parameters() const {
     return risk_params_;
 }
 
 void RiskManager::set_risk_parameters(const RiskParameters& params) {
+    if (params.atr_period != volatility_.get_period()) {
+        volatility_.reset(params.atr_period);
+    }
     risk_params_ = params;
 }
 
+void RiskManager::set_session_calendar(const SessionCalendar& calendar) {
+    calendar_ = calendar;
+    day_begin_ = 0;
+    day_end_ = 0;
+    session_ = kNoSession;
+}
+
+const SessionCalendar& RiskManager::get_session_calendar() const {
+    return calendar_;
+}
+
+const VolatilityTracker& RiskManager::get_volatility() const {
+    return volatility_;
+}
+
 double RiskManager::calculate_atr(const std::vector<MarketData>& data, int period) {
     // Calculate Average True Range for volatility measurement
     
-    if (data.size() < static_cast<size_t>(period + 1)) {
+    if (period <= 0 || data.size() < static_cast<size_t>(period + 1)) {
         throw std::invalid_argument("Not enough data to calculate ATR");
     }
     
-    // Calculate True Range for each period and average them
-    
-    std::vector<double> true_ranges;
-    
-    for (size_t i = 1; i < data.size(); ++i) {
-        double high_low = data[i].high - data[i].low;
-        double high_close_prev = std::abs(data[i].high - data[i-1].close);
-        double low_close_prev = std::abs(data[i].low - data[i-1].close);
-        
-        double true_range = std::max({high_low, high_close_prev, low_close_prev});
-        true_ranges.push_back(true_range);
-    }
-    
-    // Calculate average of last 'period' true ranges
-    if (true_ranges.size() < static_cast<size_t>(period)) {
-        throw std::invalid_argument("Not enough true range data");
-    }
-    
-    double sum = 0.0;
-    for (int i = true_ranges.size() - period; i < static_cast<int>(true_ranges.size()); ++i) {
-        sum += true_ranges[i];
+    // Only the last 'period' true ranges count
+    size_t first = data.size() - period - 1;
+    atr_high_.resize(period + 1);
+    atr_low_.resize(period + 1);
+    atr_close_.resize(period + 1);
+    for (size_t i = 0; i <= static_cast<size_t>(period); ++i) {
+        atr_high_[i] = data[first + i].high;
+        atr_low_[i] = data[first + i].low;
+        atr_close_[i] = data[first + i].close;
     }
     
-    return sum / period;
+    return IndicatorKernels::atr_value(atr_high_.data(), atr_low_.data(), atr_close_.data(), period);
 }
 
 double RiskManager::calculate_drawdown(double peak_value, double current_value) {
@@ -247,9 +358,12 @@ bool RiskManager::check_drawdown_limit(const PortfolioState& portfolio) {
 
 bool RiskManager::check_daily_loss_limit(const PortfolioState& portfolio) {
     // Check if daily loss exceeds maximum allowed
+    if (portfolio.day_start_value <= 0.0) {
+        return true;
+    }
     
-
-    return true;
+    double daily_loss = (portfolio.day_start_value - portfolio.total_value) / portfolio.day_start_value;
+    return daily_loss < risk_params_.max_daily_loss;
 }
 
 double RiskManager::calculate_kelly_criterion(double win_rate, double avg_win, double avg_loss) {
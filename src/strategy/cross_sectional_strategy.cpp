@@ -0,0 +1,350 @@
+#include "strategy/cross_sectional_strategy.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+namespace TradingBot {
+
+namespace {
+
+const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+// Higher score first; ties go to the lower index so runs are reproducible
+bool better(const ScoredSymbol& a, const ScoredSymbol& b) {
+    return a.score > b.score || (a.score == b.score && a.symbol < b.symbol);
+}
+
+bool read_period(const std::map<std::string, double>& params, const char* key, size_t& value) {
+    auto it = params.find(key);
+    if (it == params.end()) {
+        throw std::invalid_argument(std::string("Missing required parameter ") + key);
+    }
+    if (!(it->second >= 1.0) || it->second > 100000.0 || it->second != std::floor(it->second)) {
+        return false;
+    }
+    value = static_cast<size_t>(it->second);
+    return true;
+}
+
+} // namespace
+
+CrossSectionalStrategy::CrossSectionalStrategy(const std::string& name)
+    : name_(name), top_k_(50), symbol_count_(0) {
+}
+
+CrossSectionalStrategy::~CrossSectionalStrategy() {
+}
+
+const std::string& CrossSectionalStrategy::get_name() const {
+    return name_;
+}
+
+bool CrossSectionalStrategy::read_top_k(const std::map<std::string, double>& params) {
+    size_t top_k;
+    if (!read_period(params, "top_k", top_k)) {
+        return false;
+    }
+    top_k_ = top_k;
+    return true;
+}
+
+void CrossSectionalStrategy::reset(size_t symbol_count) {
+    symbol_count_ = symbol_count;
+    scores_.assign(symbol_count, NaN);
+    ranked_.clear();
+    ranked_.reserve(symbol_count);
+    picks_.clear();
+    reset_state(symbol_count);
+}
+
+const std::vector<uint32_t>& CrossSectionalStrategy::rank(const double* closes) {
+    score(closes, scores_.data());
+
+    ranked_.clear();
+    for (size_t i = 0; i < symbol_count_; ++i) {
+        if (!std::isnan(scores_[i])) {
+            ranked_.push_back({scores_[i], static_cast<uint32_t>(i)});
+        }
+    }
+
+    // Partition the best top_k to the front, then order just those
+    size_t keep = std::min(top_k_, ranked_.size());
+    if (keep < ranked_.size()) {
+        std::nth_element(ranked_.begin(), ranked_.begin() + keep, ranked_.end(), better);
+    }
+    std::sort(ranked_.begin(), ranked_.begin() + keep, better);
+
+    picks_.clear();
+    for (size_t i = 0; i < keep; ++i) {
+        picks_.push_back(ranked_[i].symbol);
+    }
+    return picks_;
+}
+
+const std::vector<double>& CrossSectionalStrategy::get_scores() const {
+    return scores_;
+}
+
+size_t CrossSectionalStrategy::get_top_k() const {
+    return top_k_;
+}
+
+size_t CrossSectionalStrategy::get_symbol_count() const {
+    return symbol_count_;
+}
+
+MomentumRankStrategy::MomentumRankStrategy()
+    : CrossSectionalStrategy("CS_MOMENTUM"), lookback_period_(126), symbol_count_(0), slot_(0) {
+}
+
+bool MomentumRankStrategy::initialize(const std::map<std::string, double>& params) {
+    size_t lookback;
+    if (!read_top_k(params) || !read_period(params, "lookback_period", lookback)) {
+        return false;
+    }
+    lookback_period_ = lookback;
+    return true;
+}
+
+std::map<std::string, double> MomentumRankStrategy::get_parameters() const {
+    return std::map<std::string, double>{
+        {"lookback_period", static_cast<double>(lookback_period_)},
+        {"top_k", static_cast<double>(top_k_)}
+    };
+}
+
+std::unique_ptr<CrossSectionalStrategy> MomentumRankStrategy::clone() const {
+    return std::make_unique<MomentumRankStrategy>(*this);
+}
+
+void MomentumRankStrategy::reset_state(size_t symbol_count) {
+    symbol_count_ = symbol_count;
+    slot_ = 0;
+    history_.assign((lookback_period_ + 1) * symbol_count, NaN);
+    last_close_.assign(symbol_count, NaN);
+    bars_seen_.assign(symbol_count, 0);
+}
+
+void MomentumRankStrategy::score(const double* closes, double* scores) {
+    // Ring rows: the current bar goes to slot_, the bar lookback_period ago
+    // is the oldest row, which is the next one round
+    size_t rows = lookback_period_ + 1;
+    double* current = &history_[slot_ * symbol_count_];
+    const double* past = &history_[((slot_ + 1) % rows) * symbol_count_];
+
+    for (size_t i = 0; i < symbol_count_; ++i) {
+        double close = closes[i];
+        bool quoted = close > 0.0;
+        if (quoted) {
+            last_close_[i] = close;
+        }
+        if (quoted || bars_seen_[i] > 0) {
+            ++bars_seen_[i];
+        }
+        current[i] = last_close_[i];
+        scores[i] = quoted && bars_seen_[i] > lookback_period_ ? close / past[i] - 1.0 : NaN;
+    }
+
+    slot_ = (slot_ + 1) % rows;
+}
+
+RSIRankStrategy::RSIRankStrategy()
+    : CrossSectionalStrategy("CS_RSI"), period_(14), hold_lowest_(false), symbol_count_(0), slot_(0) {
+}
+
+bool RSIRankStrategy::initialize(const std::map<std::string, double>& params) {
+    size_t period;
+    if (!read_top_k(params) || !read_period(params, "period", period)) {
+        return false;
+    }
+    auto lowest_it = params.find("hold_lowest");
+    if (lowest_it != params.end() && lowest_it->second != 0.0 && lowest_it->second != 1.0) {
+        return false;
+    }
+    period_ = period;
+    hold_lowest_ = lowest_it != params.end() && lowest_it->second == 1.0;
+    return true;
+}
+
+std::map<std::string, double> RSIRankStrategy::get_parameters() const {
+    return std::map<std::string, double>{
+        {"period", static_cast<double>(period_)},
+        {"top_k", static_cast<double>(top_k_)},
+        {"hold_lowest", hold_lowest_ ? 1.0 : 0.0}
+    };
+}
+
+std::unique_ptr<CrossSectionalStrategy> RSIRankStrategy::clone() const {
+    return std::make_unique<RSIRankStrategy>(*this);
+}
+
+void RSIRankStrategy::reset_state(size_t symbol_count) {
+    symbol_count_ = symbol_count;
+    slot_ = 0;
+    gains_.assign(period_ * symbol_count, 0.0);
+    losses_.assign(period_ * symbol_count, 0.0);
+    gain_sum_.assign(symbol_count, 0.0);
+    loss_sum_.assign(symbol_count, 0.0);
+    last_close_.assign(symbol_count, NaN);
+    bars_seen_.assign(symbol_count, 0);
+}
+
+void RSIRankStrategy::score(const double* closes, double* scores) {
+    double* gains = &gains_[slot_ * symbol_count_];
+    double* losses = &losses_[slot_ * symbol_count_];
+    double period = static_cast<double>(period_);
+
+    for (size_t i = 0; i < symbol_count_; ++i) {
+        double close = closes[i];
+        bool quoted = close > 0.0;
+
+        // Without a quote the last price stands: a zero change
+        double change = 0.0;
+        if (quoted) {
+            change = bars_seen_[i] > 0 ? close - last_close_[i] : 0.0;
+            last_close_[i] = close;
+        }
+        if (quoted || bars_seen_[i] > 0) {
+            ++bars_seen_[i];
+        }
+
+        double gain = change > 0 ? change : 0.0;
+        double loss = change > 0 ? 0.0 : -change;
+        gain_sum_[i] += gain - gains[i];
+        loss_sum_[i] += loss - losses[i];
+        gains[i] = gain;
+        losses[i] = loss;
+
+        // 'period' changes need period + 1 bars
+        if (!quoted || bars_seen_[i] <= period_) {
+            scores[i] = NaN;
+            continue;
+        }
+        double avg_gain = gain_sum_[i] / period;
+        double avg_loss = loss_sum_[i] / period;
+        double rsi = avg_loss <= 0.0 ? 100.0 : 100.0 - (100.0 / (1.0 + avg_gain / avg_loss));
+        scores[i] = hold_lowest_ ? -rsi : rsi;
+    }
+
+    // Once per lap, resum the windows so rounding cannot build up
+    if (++slot_ == period_) {
+        slot_ = 0;
+        resum();
+    }
+}
+
+void RSIRankStrategy::resum() {
+    std::fill(gain_sum_.begin(), gain_sum_.end(), 0.0);
+    std::fill(loss_sum_.begin(), loss_sum_.end(), 0.0);
+    for (size_t row = 0; row < period_; ++row) {
+        const double* gains = &gains_[row * symbol_count_];
+        const double* losses = &losses_[row * symbol_count_];
+        for (size_t i = 0; i < symbol_count_; ++i) {
+            gain_sum_[i] += gains[i];
+            loss_sum_[i] += losses[i];
+        }
+    }
+}
+
+CrossSectionalRegistry& CrossSectionalRegistry::instance() {
+    static CrossSectionalRegistry registry;
+    static std::once_flag builtins;
+    std::call_once(builtins, [] { registry.register_builtins(); });
+    return registry;
+}
+
+CrossSectionalRegistry::CrossSectionalRegistry() {
+}
+
+void CrossSectionalRegistry::register_builtins() {
+    std::string error;
+
+    CrossSectionalInfo momentum;
+    momentum.name = "CS_MOMENTUM";
+    momentum.description = "Hold the symbols with the largest trailing return";
+    momentum.parameters = {
+        ParameterSpec("lookback_period", ParameterType::INTEGER, 2.0, 504.0, 126.0, 1.0, "Return window in bars"),
+        ParameterSpec("top_k", ParameterType::INTEGER, 1.0, 1000.0, 50.0, 1.0, "Symbols held"),
+    };
+    momentum.create = [] { return std::make_unique<MomentumRankStrategy>(); };
+    register_strategy(momentum, error);
+
+    CrossSectionalInfo rsi;
+    rsi.name = "CS_RSI";
+    rsi.description = "Hold the symbols with the highest (or lowest) RSI";
+    rsi.parameters = {
+        ParameterSpec("period", ParameterType::INTEGER, 2.0, 100.0, 14.0, 1.0, "RSI length"),
+        ParameterSpec("top_k", ParameterType::INTEGER, 1.0, 1000.0, 50.0, 1.0, "Symbols held"),
+        ParameterSpec("hold_lowest", ParameterType::INTEGER, 0.0, 1.0, 0.0, 1.0, "1 = hold the lowest RSI instead"),
+    };
+    rsi.create = [] { return std::make_unique<RSIRankStrategy>(); };
+    register_strategy(rsi, error);
+}
+
+bool CrossSectionalRegistry::register_strategy(const CrossSectionalInfo& info, std::string& error) {
+    if (info.name.empty() || !info.create) {
+        error = "strategy '" + info.name + "' needs a name and a factory";
+        return false;
+    }
+    for (const auto& spec : info.parameters) {
+        std::string problem = check_parameter(spec, spec.default_value);
+        if (!problem.empty()) {
+            error = info.name + ": default " + problem;
+            return false;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (by_name_.count(info.name)) {
+        error = "strategy name '" + info.name + "' is already registered";
+        return false;
+    }
+    strategies_.push_back(info);
+    by_name_[info.name] = &strategies_.back();
+    return true;
+}
+
+const CrossSectionalInfo* CrossSectionalRegistry::find(const std::string& name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = by_name_.find(name);
+    return it == by_name_.end() ? nullptr : it->second;
+}
+
+std::vector<std::string> CrossSectionalRegistry::get_names() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> names;
+    for (const auto& info : strategies_) {
+        names.push_back(info.name);
+    }
+    return names;
+}
+
+std::unique_ptr<CrossSectionalStrategy> CrossSectionalRegistry::create(const std::string& name) const {
+    const CrossSectionalInfo* info = find(name);
+    return info ? info->create() : nullptr;
+}
+
+std::map<std::string, double> CrossSectionalRegistry::get_default_parameters(const std::string& name) const {
+    std::map<std::string, double> params;
+    if (const CrossSectionalInfo* info = find(name)) {
+        for (const auto& spec : info->parameters) {
+            params[spec.name] = spec.default_value;
+        }
+    }
+    return params;
+}
+
+bool CrossSectionalRegistry::resolve_parameters(const std::string& name,
+                                                const std::map<std::string, double>& overrides,
+                                                std::map<std::string, double>& params, std::string& error) const {
+    const CrossSectionalInfo* info = find(name);
+    if (!info) {
+        error = "unknown cross-sectional strategy " + name;
+        return false;
+    }
+    return resolve_parameter_schema(info->name, info->parameters, overrides, params, error);
+}
+
+} // namespace TradingBot
@@ -34,37 +34,50 @@ TradingBot::TradingSignal TradingBot::EMAStrategy::generate_signal(const MarketD
     signal.timestamp = data.timestamp;
     signal.reason = "EMA strategy not implemented yet";
 
-    price_history_.push_back(data);
+    double short_ema, long_ema, prev_short_ema, prev_long_ema;
 
-    if (price_history_.size() < static_cast<size_t>(long_period_)) {
-        return signal;
+    if(indicator_cache_){
+        size_t index = next_cached_bar(data);
+
+        if(index < static_cast<size_t>(long_period_)){
+            return signal;
+        }
+
+        short_ema = cached_indicator(IndicatorType::EMA, short_period_, index);
+        long_ema = cached_indicator(IndicatorType::EMA, long_period_, index);
+        prev_short_ema = cached_indicator(IndicatorType::EMA, short_period_, index - 1);
+        prev_long_ema = cached_indicator(IndicatorType::EMA, long_period_, index - 1);
     }
+    else{
+        price_history_.push_back(data);
 
-    double short_ema = calculate_ema(price_history_, short_period_);
-    double long_ema = calculate_ema(price_history_, long_period_);
+        if (price_history_.size() <= static_cast<size_t>(long_period_)) {
+            return signal;
+        }
 
-    if(price_history_.size() > static_cast<size_t>(long_period_)){
+        short_ema = calculate_ema(price_history_, short_period_);
+        long_ema = calculate_ema(price_history_, long_period_);
 
         std::vector<MarketData> prev_data(price_history_.begin(), price_history_.end() - 1);
 
-        double prev_short_ema = calculate_ema(prev_data, short_period_);
-        double prev_long_ema = calculate_ema(prev_data, long_period_);
+        prev_short_ema = calculate_ema(prev_data, short_period_);
+        prev_long_ema = calculate_ema(prev_data, long_period_);
+    }
 
-        if(prev_short_ema <= prev_long_ema && short_ema > long_ema){
-            signal.type = SignalType::BUY;
-            signal.price = data.close;
-            signal.quantity = 100.0;
-            signal.reason = "Short EMA crossed above long EMA";
-        }
-        else if(prev_short_ema >= prev_long_ema && short_ema < long_ema){
-            signal.type = SignalType::SELL;
-            signal.price = data.close;
-            signal.quantity = current_position.quantity;
-            signal.reason = "Short EMA crossed below long EMA";
-        }
-        else{
-            signal.reason = "No crossover detected";
-        }
+    if(prev_short_ema <= prev_long_ema && short_ema > long_ema){
+        signal.type = SignalType::BUY;
+        signal.price = data.close;
+        signal.quantity = 100.0;
+        signal.reason = "Short EMA crossed above long EMA";
+    }
+    else if(prev_short_ema >= prev_long_ema && short_ema < long_ema){
+        signal.type = SignalType::SELL;
+        signal.price = data.close;
+        signal.quantity = current_position.quantity;
+        signal.reason = "Short EMA crossed below long EMA";
+    }
+    else{
+        signal.reason = "No crossover detected";
     }
     
     return signal;
@@ -101,4 +114,13 @@ bool TradingBot::EMAStrategy::validate_parameters(const std::map<std::string, do
     }
     
     return true;
-}
\ No newline at end of file
+}
+
+void TradingBot::EMAStrategy::reset() {
+    Strategy::reset();
+    price_history_.clear();
+}
+
+std::unique_ptr<TradingBot::Strategy> TradingBot::EMAStrategy::clone() const {
+    return std::make_unique<EMAStrategy>(*this);
+}
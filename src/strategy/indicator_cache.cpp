@@ -0,0 +1,162 @@
+#include "strategy/indicator_cache.h"
+#include "strategy/indicator_kernels.h"
+#include <stdexcept>
+#include <tuple>
+
+namespace TradingBot {
+
+bool IndicatorCache::Key::operator<(const Key& other) const {
+    return std::tie(series_id, type, period) < std::tie(other.series_id, other.type, other.period);
+}
+
+IndicatorCache::IndicatorCache(size_t memory_budget_bytes)
+    : memory_budget_(memory_budget_bytes), memory_usage_(0), hits_(0), misses_(0) {
+}
+
+IndicatorCache::~IndicatorCache() {
+}
+
+IndicatorCache::Series IndicatorCache::get(const std::string& series_id, const std::vector<MarketData>& data,
+                                           IndicatorType type, int period) {
+    if (period <= 0) {
+        throw std::invalid_argument("Indicator period must be positive");
+    }
+
+    Key key{series_id, type, period};
+    std::promise<Series> promise;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        ++hits_;
+        lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+        std::shared_future<Series> pending = it->second.series;
+
+        // Wait outside the lock if another thread is still computing it
+        lock.unlock();
+        return pending.get();
+    }
+
+    ++misses_;
+    lru_.push_front(key);
+    entries_[key] = Entry{promise.get_future().share(), lru_.begin(), 0};
+    lock.unlock();
+
+    Series series;
+    try {
+        series = std::make_shared<const std::vector<double>>(compute(data, type, period));
+    } catch (...) {
+        lock.lock();
+        it = entries_.find(key);
+        if (it != entries_.end()) {
+            lru_.erase(it->second.lru_position);
+            entries_.erase(it);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    promise.set_value(series);
+
+    lock.lock();
+    it = entries_.find(key);
+    if (it != entries_.end() && it->second.bytes == 0) {
+        it->second.bytes = series->size() * sizeof(double) + sizeof(Entry) + key.series_id.size();
+        memory_usage_ += it->second.bytes;
+        evict_to_budget();
+    }
+
+    return series;
+}
+
+void IndicatorCache::set_memory_budget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    memory_budget_ = bytes;
+    evict_to_budget();
+}
+
+size_t IndicatorCache::get_memory_budget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_budget_;
+}
+
+size_t IndicatorCache::get_memory_usage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memory_usage_;
+}
+
+size_t IndicatorCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+size_t IndicatorCache::get_hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+size_t IndicatorCache::get_misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+void IndicatorCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Entries still being computed are owned by their computing thread
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.bytes > 0) {
+            lru_.erase(it->second.lru_position);
+            memory_usage_ -= it->second.bytes;
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void IndicatorCache::evict_to_budget() {
+    // Caller holds mutex_. Walk from least recently used, skipping in-flight entries
+    auto it = lru_.end();
+    while (memory_usage_ > memory_budget_ && it != lru_.begin()) {
+        --it;
+        auto entry = entries_.find(*it);
+        if (entry->second.bytes == 0) {
+            continue;
+        }
+        memory_usage_ -= entry->second.bytes;
+        entries_.erase(entry);
+        it = lru_.erase(it);
+    }
+}
+
+std::vector<double> IndicatorCache::compute(const std::vector<MarketData>& data, IndicatorType type, int period) {
+    if (period <= 0) {
+        throw std::invalid_argument("Indicator period must be positive");
+    }
+
+    std::vector<double> closes(data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        closes[i] = data[i].close;
+    }
+
+    // The kernels give the same values as Strategy::calculate_sma/ema/rsi
+    // evaluated on the bars up to each index
+    std::vector<double> values(data.size());
+    switch (type) {
+        case IndicatorType::SMA:
+            IndicatorKernels::sma(closes.data(), closes.size(), period, values.data());
+            break;
+        case IndicatorType::EMA:
+            IndicatorKernels::ema(closes.data(), closes.size(), period, values.data());
+            break;
+        case IndicatorType::RSI:
+            IndicatorKernels::rsi(closes.data(), closes.size(), period, values.data());
+            break;
+    }
+
+    return values;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,667 @@
+#include "strategy/indicator_kernels.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+// The SIMD versions are compiled per function with target attributes, so the
+// rest of the build keeps its baseline instruction set
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TRADINGBOT_X86_SIMD 1
+#include <immintrin.h>
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace TradingBot {
+namespace IndicatorKernels {
+
+namespace {
+
+const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+std::atomic<int>& active_level() {
+    static std::atomic<int> level(static_cast<int>(detect_simd_level()));
+    return level;
+}
+
+SimdLevel current_level() {
+    return static_cast<SimdLevel>(active_level().load(std::memory_order_relaxed));
+}
+
+size_t checked_period(int period) {
+    if (period <= 0) {
+        throw std::invalid_argument("Indicator period must be positive");
+    }
+    return static_cast<size_t>(period);
+}
+
+void fill_nan(double* out, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        out[i] = NaN;
+    }
+}
+
+// ---- Scalar reference versions; each SIMD loop hands its tail to these ----
+
+// Sum of p values, oldest first
+double sum_at(const double* window, size_t p) {
+    double sum = 0.0;
+    for (size_t k = 0; k < p; ++k) {
+        sum += window[k];
+    }
+    return sum;
+}
+
+// out[i] = values[i + 1 - p] + ... + values[i] (divided by p for a mean)
+void sums_scalar(const double* values, size_t p, size_t begin, size_t end, bool mean, double* out) {
+    for (size_t i = begin; i < end; ++i) {
+        double sum = sum_at(values + i + 1 - p, p);
+        out[i] = mean ? sum / static_cast<double>(p) : sum;
+    }
+}
+
+// RSI over the p changes ending at window[p - 1]; window[-1] must exist
+double rsi_at(const double* window, size_t p) {
+    const double* previous = window - 1;
+    double avg_gain = 0.0, avg_loss = 0.0;
+    for (size_t k = 0; k < p; ++k) {
+        double change = window[k] - previous[k];
+        if (change > 0) {
+            avg_gain += change;
+        } else {
+            avg_loss += -change;
+        }
+    }
+    avg_gain /= static_cast<double>(p);
+    avg_loss /= static_cast<double>(p);
+    return avg_loss == 0.0 ? 100.0 : 100.0 - (100.0 / (1.0 + avg_gain / avg_loss));
+}
+
+// Needs begin >= p
+void rsi_scalar(const double* closes, size_t p, size_t begin, size_t end, double* out) {
+    for (size_t i = begin; i < end; ++i) {
+        out[i] = rsi_at(closes + i + 1 - p, p);
+    }
+}
+
+double true_range_at(const double* high, const double* low, const double* close, size_t i) {
+    return std::max({high[i] - low[i], std::abs(high[i] - close[i - 1]), std::abs(low[i] - close[i - 1])});
+}
+
+// Needs begin >= 1
+void true_range_scalar(const double* high, const double* low, const double* close, size_t begin, size_t end,
+                       double* out) {
+    for (size_t i = begin; i < end; ++i) {
+        out[i] = true_range_at(high, low, close, i);
+    }
+}
+
+// Mean true range of the p bars ending at i; needs i >= p
+double atr_at(const double* high, const double* low, const double* close, size_t p, size_t i) {
+    double sum = 0.0;
+    for (size_t j = i + 1 - p; j <= i; ++j) {
+        sum += true_range_at(high, low, close, j);
+    }
+    return sum / static_cast<double>(p);
+}
+
+void atr_scalar(const double* high, const double* low, const double* close, size_t p, size_t begin, size_t end,
+                double* out) {
+    for (size_t i = begin; i < end; ++i) {
+        out[i] = atr_at(high, low, close, p, i);
+    }
+}
+
+void zscore_scalar(const double* values, size_t p, size_t begin, size_t end, double* out) {
+    for (size_t i = begin; i < end; ++i) {
+        const double* window = values + i + 1 - p;
+        double mean = sum_at(window, p) / static_cast<double>(p);
+        double m2 = 0.0;
+        for (size_t k = 0; k < p; ++k) {
+            double deviation = window[k] - mean;
+            m2 += deviation * deviation;
+        }
+        double stdev = std::sqrt(m2 / static_cast<double>(p));
+        out[i] = stdev > 0.0 ? (values[i] - mean) / stdev : 0.0;
+    }
+}
+
+// SMA of the first p values, the EMA seed
+double ema_seed(const double* values, size_t p) {
+    return sum_at(values, p) / static_cast<double>(p);
+}
+
+// Plain recurrence from index p on; 'ema' is the value at p - 1
+double ema_scalar(const double* values, size_t count, size_t p, double ema, double* out) {
+    double multiplier = 2.0 / (static_cast<double>(p) + 1.0);
+    for (size_t i = p; i < count; ++i) {
+        ema = (values[i] * multiplier) + (ema * (1 - multiplier));
+        if (out) {
+            out[i] = ema;
+        }
+    }
+    return ema;
+}
+
+template <bool Maximum>
+void rolling_extreme(const double* values, size_t count, size_t p, double* out) {
+    // Ring of indices whose values are monotonic from front to back; the
+    // front is the extreme of the window
+    std::vector<size_t> ring(p);
+    size_t head = 0, size = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (size > 0 && ring[head] + p <= i) {
+            head = head + 1 == p ? 0 : head + 1;
+            --size;
+        }
+        while (size > 0) {
+            size_t back = ring[(head + size - 1) % p];
+            if (Maximum ? values[back] > values[i] : values[back] < values[i]) {
+                break;
+            }
+            --size;
+        }
+        ring[(head + size) % p] = i;
+        ++size;
+        out[i] = i + 1 >= p ? values[ring[head]] : NaN;
+    }
+}
+
+#ifdef TRADINGBOT_X86_SIMD
+
+// ---- AVX2: four outputs per step ----
+
+TARGET_AVX2 void sums_avx2(const double* values, size_t p, size_t begin, size_t end, bool mean, double* out) {
+    const __m256d divisor = _mm256_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const double* window = values + i + 1 - p;
+        __m256d sum = _mm256_setzero_pd();
+        for (size_t k = 0; k < p; ++k) {
+            sum = _mm256_add_pd(sum, _mm256_loadu_pd(window + k));
+        }
+        _mm256_storeu_pd(out + i, mean ? _mm256_div_pd(sum, divisor) : sum);
+    }
+    sums_scalar(values, p, i, end, mean, out);
+}
+
+TARGET_AVX2 void rsi_avx2(const double* closes, size_t p, size_t begin, size_t end, double* out) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d hundred = _mm256_set1_pd(100.0);
+    const __m256d divisor = _mm256_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const double* window = closes + i + 1 - p;
+        __m256d gains = zero, losses = zero;
+        for (size_t k = 0; k < p; ++k) {
+            __m256d change = _mm256_sub_pd(_mm256_loadu_pd(window + k), _mm256_loadu_pd(window + k - 1));
+            gains = _mm256_add_pd(gains, _mm256_max_pd(change, zero));
+            losses = _mm256_add_pd(losses, _mm256_max_pd(_mm256_sub_pd(zero, change), zero));
+        }
+        __m256d avg_gain = _mm256_div_pd(gains, divisor);
+        __m256d avg_loss = _mm256_div_pd(losses, divisor);
+        __m256d value = _mm256_sub_pd(hundred,
+                                      _mm256_div_pd(hundred, _mm256_add_pd(one, _mm256_div_pd(avg_gain, avg_loss))));
+        __m256d no_loss = _mm256_cmp_pd(avg_loss, zero, _CMP_EQ_OQ);
+        _mm256_storeu_pd(out + i, _mm256_blendv_pd(value, hundred, no_loss));
+    }
+    rsi_scalar(closes, p, i, end, out);
+}
+
+TARGET_AVX2 __m256d true_range_avx2_at(const double* high, const double* low, const double* close, size_t j) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    __m256d h = _mm256_loadu_pd(high + j);
+    __m256d l = _mm256_loadu_pd(low + j);
+    __m256d previous = _mm256_loadu_pd(close + j - 1);
+    __m256d range = _mm256_sub_pd(h, l);
+    __m256d up = _mm256_andnot_pd(sign, _mm256_sub_pd(h, previous));
+    __m256d down = _mm256_andnot_pd(sign, _mm256_sub_pd(l, previous));
+    return _mm256_max_pd(_mm256_max_pd(range, up), down);
+}
+
+TARGET_AVX2 void true_range_avx2(const double* high, const double* low, const double* close, size_t begin,
+                                 size_t end, double* out) {
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        _mm256_storeu_pd(out + i, true_range_avx2_at(high, low, close, i));
+    }
+    true_range_scalar(high, low, close, i, end, out);
+}
+
+TARGET_AVX2 void atr_avx2(const double* high, const double* low, const double* close, size_t p, size_t begin,
+                          size_t end, double* out) {
+    const __m256d divisor = _mm256_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m256d sum = _mm256_setzero_pd();
+        for (size_t j = i + 1 - p; j <= i; ++j) {
+            sum = _mm256_add_pd(sum, true_range_avx2_at(high, low, close, j));
+        }
+        _mm256_storeu_pd(out + i, _mm256_div_pd(sum, divisor));
+    }
+    atr_scalar(high, low, close, p, i, end, out);
+}
+
+TARGET_AVX2 void zscore_avx2(const double* values, size_t p, size_t begin, size_t end, double* out) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d divisor = _mm256_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const double* window = values + i + 1 - p;
+        __m256d sum = zero;
+        for (size_t k = 0; k < p; ++k) {
+            sum = _mm256_add_pd(sum, _mm256_loadu_pd(window + k));
+        }
+        __m256d mean = _mm256_div_pd(sum, divisor);
+        __m256d m2 = zero;
+        for (size_t k = 0; k < p; ++k) {
+            __m256d deviation = _mm256_sub_pd(_mm256_loadu_pd(window + k), mean);
+            m2 = _mm256_add_pd(m2, _mm256_mul_pd(deviation, deviation));
+        }
+        __m256d stdev = _mm256_sqrt_pd(_mm256_div_pd(m2, divisor));
+        __m256d z = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(values + i), mean), stdev);
+        _mm256_storeu_pd(out + i, _mm256_and_pd(z, _mm256_cmp_pd(stdev, zero, _CMP_GT_OQ)));
+    }
+    zscore_scalar(values, p, i, end, out);
+}
+
+// Blocked scan: within a block of four, e[k] = sum_j a c^(k-j) x[j] +
+// c^(k+1) e[-1], built with two shift-and-add steps; the block's last
+// value carries into the next. The partial last block is padded so every
+// value goes through the same arithmetic whatever 'count' is.
+TARGET_AVX2 double ema_avx2(const double* values, size_t count, size_t p, double seed, double* out) {
+    const double a = 2.0 / (static_cast<double>(p) + 1.0);
+    const double c = 1 - a;
+    const double c2 = c * c, c3 = c2 * c, c4 = c3 * c;
+    const __m256d weight = _mm256_set1_pd(a);
+    const __m256d step1 = _mm256_set1_pd(c);
+    const __m256d step2 = _mm256_set1_pd(c2);
+    const __m256d carry_weights = _mm256_setr_pd(c, c2, c3, c4);
+    __m256d carry = _mm256_set1_pd(seed);
+
+    for (size_t i = p; i < count; i += 4) {
+        double padded[4] = {0.0, 0.0, 0.0, 0.0};
+        size_t valid = std::min<size_t>(4, count - i);
+        const double* block = values + i;
+        if (valid < 4) {
+            std::memcpy(padded, block, valid * sizeof(double));
+            block = padded;
+        }
+        __m256d v = _mm256_mul_pd(weight, _mm256_loadu_pd(block));
+        __m256d shifted = _mm256_blend_pd(_mm256_permute4x64_pd(v, _MM_SHUFFLE(2, 1, 0, 0)), _mm256_setzero_pd(), 0x1);
+        v = _mm256_add_pd(v, _mm256_mul_pd(step1, shifted));
+        shifted = _mm256_blend_pd(_mm256_permute4x64_pd(v, _MM_SHUFFLE(1, 0, 0, 0)), _mm256_setzero_pd(), 0x3);
+        v = _mm256_add_pd(v, _mm256_mul_pd(step2, shifted));
+        __m256d e = _mm256_add_pd(v, _mm256_mul_pd(carry_weights, carry));
+        if (valid < 4) {
+            _mm256_storeu_pd(padded, e);
+            if (out) {
+                std::memcpy(out + i, padded, valid * sizeof(double));
+            }
+            return padded[valid - 1];
+        }
+        if (out) {
+            _mm256_storeu_pd(out + i, e);
+        }
+        carry = _mm256_permute4x64_pd(e, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    return _mm256_cvtsd_f64(carry);
+}
+
+// ---- AVX-512: eight outputs per step ----
+
+// GCC 12's own AVX-512 headers trip -Wmaybe-uninitialized (_mm512_undefined_pd)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+TARGET_AVX512 void sums_avx512(const double* values, size_t p, size_t begin, size_t end, bool mean, double* out) {
+    const __m512d divisor = _mm512_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const double* window = values + i + 1 - p;
+        __m512d sum = _mm512_setzero_pd();
+        for (size_t k = 0; k < p; ++k) {
+            sum = _mm512_add_pd(sum, _mm512_loadu_pd(window + k));
+        }
+        _mm512_storeu_pd(out + i, mean ? _mm512_div_pd(sum, divisor) : sum);
+    }
+    sums_scalar(values, p, i, end, mean, out);
+}
+
+TARGET_AVX512 void rsi_avx512(const double* closes, size_t p, size_t begin, size_t end, double* out) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d hundred = _mm512_set1_pd(100.0);
+    const __m512d divisor = _mm512_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const double* window = closes + i + 1 - p;
+        __m512d gains = zero, losses = zero;
+        for (size_t k = 0; k < p; ++k) {
+            __m512d change = _mm512_sub_pd(_mm512_loadu_pd(window + k), _mm512_loadu_pd(window + k - 1));
+            gains = _mm512_add_pd(gains, _mm512_max_pd(change, zero));
+            losses = _mm512_add_pd(losses, _mm512_max_pd(_mm512_sub_pd(zero, change), zero));
+        }
+        __m512d avg_gain = _mm512_div_pd(gains, divisor);
+        __m512d avg_loss = _mm512_div_pd(losses, divisor);
+        __m512d value = _mm512_sub_pd(hundred,
+                                      _mm512_div_pd(hundred, _mm512_add_pd(one, _mm512_div_pd(avg_gain, avg_loss))));
+        __mmask8 no_loss = _mm512_cmp_pd_mask(avg_loss, zero, _CMP_EQ_OQ);
+        _mm512_storeu_pd(out + i, _mm512_mask_blend_pd(no_loss, value, hundred));
+    }
+    rsi_scalar(closes, p, i, end, out);
+}
+
+TARGET_AVX512 __m512d true_range_avx512_at(const double* high, const double* low, const double* close, size_t j) {
+    __m512d h = _mm512_loadu_pd(high + j);
+    __m512d l = _mm512_loadu_pd(low + j);
+    __m512d previous = _mm512_loadu_pd(close + j - 1);
+    __m512d range = _mm512_sub_pd(h, l);
+    __m512d up = _mm512_abs_pd(_mm512_sub_pd(h, previous));
+    __m512d down = _mm512_abs_pd(_mm512_sub_pd(l, previous));
+    return _mm512_max_pd(_mm512_max_pd(range, up), down);
+}
+
+TARGET_AVX512 void true_range_avx512(const double* high, const double* low, const double* close, size_t begin,
+                                     size_t end, double* out) {
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        _mm512_storeu_pd(out + i, true_range_avx512_at(high, low, close, i));
+    }
+    true_range_scalar(high, low, close, i, end, out);
+}
+
+TARGET_AVX512 void atr_avx512(const double* high, const double* low, const double* close, size_t p, size_t begin,
+                              size_t end, double* out) {
+    const __m512d divisor = _mm512_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m512d sum = _mm512_setzero_pd();
+        for (size_t j = i + 1 - p; j <= i; ++j) {
+            sum = _mm512_add_pd(sum, true_range_avx512_at(high, low, close, j));
+        }
+        _mm512_storeu_pd(out + i, _mm512_div_pd(sum, divisor));
+    }
+    atr_scalar(high, low, close, p, i, end, out);
+}
+
+TARGET_AVX512 void zscore_avx512(const double* values, size_t p, size_t begin, size_t end, double* out) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d divisor = _mm512_set1_pd(static_cast<double>(p));
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const double* window = values + i + 1 - p;
+        __m512d sum = zero;
+        for (size_t k = 0; k < p; ++k) {
+            sum = _mm512_add_pd(sum, _mm512_loadu_pd(window + k));
+        }
+        __m512d mean = _mm512_div_pd(sum, divisor);
+        __m512d m2 = zero;
+        for (size_t k = 0; k < p; ++k) {
+            __m512d deviation = _mm512_sub_pd(_mm512_loadu_pd(window + k), mean);
+            m2 = _mm512_add_pd(m2, _mm512_mul_pd(deviation, deviation));
+        }
+        __m512d stdev = _mm512_sqrt_pd(_mm512_div_pd(m2, divisor));
+        __m512d z = _mm512_div_pd(_mm512_sub_pd(_mm512_loadu_pd(values + i), mean), stdev);
+        __mmask8 spread = _mm512_cmp_pd_mask(stdev, zero, _CMP_GT_OQ);
+        _mm512_storeu_pd(out + i, _mm512_maskz_mov_pd(spread, z));
+    }
+    zscore_scalar(values, p, i, end, out);
+}
+
+// As ema_avx2 with blocks of eight and three shift-and-add steps
+TARGET_AVX512 double ema_avx512(const double* values, size_t count, size_t p, double seed, double* out) {
+    const double a = 2.0 / (static_cast<double>(p) + 1.0);
+    const double c = 1 - a;
+    double powers[8];
+    powers[0] = c;
+    for (int k = 1; k < 8; ++k) {
+        powers[k] = powers[k - 1] * c;
+    }
+    const __m512d weight = _mm512_set1_pd(a);
+    const __m512d step1 = _mm512_set1_pd(powers[0]);
+    const __m512d step2 = _mm512_set1_pd(powers[1]);
+    const __m512d step4 = _mm512_set1_pd(powers[3]);
+    const __m512d carry_weights = _mm512_loadu_pd(powers);
+    const __m512i shift1 = _mm512_set_epi64(6, 5, 4, 3, 2, 1, 0, 0);
+    const __m512i shift2 = _mm512_set_epi64(5, 4, 3, 2, 1, 0, 0, 0);
+    const __m512i shift4 = _mm512_set_epi64(3, 2, 1, 0, 0, 0, 0, 0);
+    const __m512i last = _mm512_set1_epi64(7);
+    __m512d carry = _mm512_set1_pd(seed);
+
+    for (size_t i = p; i < count; i += 8) {
+        double padded[8] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+        size_t valid = std::min<size_t>(8, count - i);
+        const double* block = values + i;
+        if (valid < 8) {
+            std::memcpy(padded, block, valid * sizeof(double));
+            block = padded;
+        }
+        __m512d v = _mm512_mul_pd(weight, _mm512_loadu_pd(block));
+        v = _mm512_add_pd(v, _mm512_mul_pd(step1, _mm512_maskz_permutexvar_pd(0xFE, shift1, v)));
+        v = _mm512_add_pd(v, _mm512_mul_pd(step2, _mm512_maskz_permutexvar_pd(0xFC, shift2, v)));
+        v = _mm512_add_pd(v, _mm512_mul_pd(step4, _mm512_maskz_permutexvar_pd(0xF0, shift4, v)));
+        __m512d e = _mm512_add_pd(v, _mm512_mul_pd(carry_weights, carry));
+        if (valid < 8) {
+            _mm512_storeu_pd(padded, e);
+            if (out) {
+                std::memcpy(out + i, padded, valid * sizeof(double));
+            }
+            return padded[valid - 1];
+        }
+        if (out) {
+            _mm512_storeu_pd(out + i, e);
+        }
+        carry = _mm512_permutexvar_pd(last, e);
+    }
+    return _mm512_cvtsd_f64(carry);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // TRADINGBOT_X86_SIMD
+
+void sums(const double* values, size_t count, int period, bool mean, double* out) {
+    size_t p = checked_period(period);
+    size_t first = std::min(p - 1, count);
+    fill_nan(out, 0, first);
+    if (count < p) {
+        return;
+    }
+    switch (current_level()) {
+#ifdef TRADINGBOT_X86_SIMD
+        case SimdLevel::AVX512:
+            sums_avx512(values, p, first, count, mean, out);
+            return;
+        case SimdLevel::AVX2:
+            sums_avx2(values, p, first, count, mean, out);
+            return;
+#endif
+        default:
+            sums_scalar(values, p, first, count, mean, out);
+    }
+}
+
+} // namespace
+
+SimdLevel detect_simd_level() {
+#ifdef TRADINGBOT_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+SimdLevel get_simd_level() {
+    return current_level();
+}
+
+SimdLevel set_simd_level(SimdLevel level) {
+    SimdLevel supported = detect_simd_level();
+    if (static_cast<int>(level) > static_cast<int>(supported)) {
+        level = supported;
+    }
+    active_level().store(static_cast<int>(level), std::memory_order_relaxed);
+    return level;
+}
+
+const char* simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512:
+            return "AVX-512";
+        case SimdLevel::AVX2:
+            return "AVX2";
+        default:
+            return "scalar";
+    }
+}
+
+void rolling_sum(const double* values, size_t count, int period, double* out) {
+    sums(values, count, period, false, out);
+}
+
+void sma(const double* values, size_t count, int period, double* out) {
+    sums(values, count, period, true, out);
+}
+
+double ema(const double* values, size_t count, int period, double* out) {
+    size_t p = checked_period(period);
+    if (out) {
+        fill_nan(out, 0, std::min(p - 1, count));
+    }
+    if (count < p) {
+        return NaN;
+    }
+    double seed = ema_seed(values, p);
+    if (out) {
+        out[p - 1] = seed;
+    }
+    switch (current_level()) {
+#ifdef TRADINGBOT_X86_SIMD
+        case SimdLevel::AVX512:
+            return ema_avx512(values, count, p, seed, out);
+        case SimdLevel::AVX2:
+            return ema_avx2(values, count, p, seed, out);
+#endif
+        default:
+            return ema_scalar(values, count, p, seed, out);
+    }
+}
+
+void rsi(const double* closes, size_t count, int period, double* out) {
+    size_t p = checked_period(period);
+    fill_nan(out, 0, std::min(p, count));
+    if (count <= p) {
+        return;
+    }
+    switch (current_level()) {
+#ifdef TRADINGBOT_X86_SIMD
+        case SimdLevel::AVX512:
+            rsi_avx512(closes, p, p, count, out);
+            return;
+        case SimdLevel::AVX2:
+            rsi_avx2(closes, p, p, count, out);
+            return;
+#endif
+        default:
+            rsi_scalar(closes, p, p, count, out);
+    }
+}
+
+void true_range(const double* high, const double* low, const double* close, size_t count, double* out) {
+    if (count == 0) {
+        return;
+    }
+    out[0] = high[0] - low[0];
+    switch (current_level()) {
+#ifdef TRADINGBOT_X86_SIMD
+        case SimdLevel::AVX512:
+            true_range_avx512(high, low, close, 1, count, out);
+            return;
+        case SimdLevel::AVX2:
+            true_range_avx2(high, low, close, 1, count, out);
+            return;
+#endif
+        default:
+            true_range_scalar(high, low, close, 1, count, out);
+    }
+}
+
+void atr(const double* high, const double* low, const double* close, size_t count, int period, double* out) {
+    size_t p = checked_period(period);
+    fill_nan(out, 0, std::min(p, count));
+    if (count <= p) {
+        return;
+    }
+    switch (current_level()) {
+#ifdef TRADINGBOT_X86_SIMD
+        case SimdLevel::AVX512:
+            atr_avx512(high, low, close, p, p, count, out);
+            return;
+        case SimdLevel::AVX2:
+            atr_avx2(high, low, close, p, p, count, out);
+            return;
+#endif
+        default:
+            atr_scalar(high, low, close, p, p, count, out);
+    }
+}
+
+void rolling_min(const double* values, size_t count, int period, double* out) {
+    rolling_extreme<false>(values, count, checked_period(period), out);
+}
+
+void rolling_max(const double* values, size_t count, int period, double* out) {
+    rolling_extreme<true>(values, count, checked_period(period), out);
+}
+
+void zscore(const double* values, size_t count, int period, double* out) {
+    size_t p = checked_period(period);
+    size_t first = std::min(p - 1, count);
+    fill_nan(out, 0, first);
+    if (count < p) {
+        return;
+    }
+    switch (current_level()) {
+#ifdef TRADINGBOT_X86_SIMD
+        case SimdLevel::AVX512:
+            zscore_avx512(values, p, first, count, out);
+            return;
+        case SimdLevel::AVX2:
+            zscore_avx2(values, p, first, count, out);
+            return;
+#endif
+        default:
+            zscore_scalar(values, p, first, count, out);
+    }
+}
+
+double window_sum(const double* values, int period) {
+    return sum_at(values, checked_period(period));
+}
+
+double rsi_value(const double* closes, int period) {
+    return rsi_at(closes + 1, checked_period(period));
+}
+
+double atr_value(const double* high, const double* low, const double* close, int period) {
+    size_t p = checked_period(period);
+    return atr_at(high, low, close, p, p);
+}
+
+} // namespace IndicatorKernels
+} // namespace TradingBot
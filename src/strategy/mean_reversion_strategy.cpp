@@ -0,0 +1,92 @@
+#include "strategy/strategy.h"
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace TradingBot {
+
+MeanReversionStrategy::MeanReversionStrategy()
+    : Strategy("MEAN_REVERSION"), lookback_period_(20), std_dev_threshold_(2.0), closes_(20) {
+}
+
+bool MeanReversionStrategy::initialize(const std::map<std::string, double>& params) {
+    auto lookback_it = params.find("lookback_period");
+    auto threshold_it = params.find("std_dev_threshold");
+
+    if (lookback_it == params.end() || threshold_it == params.end()) {
+        throw std::invalid_argument("Missing required parameters");
+    }
+    if (!validate_parameters(params)) {
+        return false;
+    }
+
+    lookback_period_ = static_cast<int>(lookback_it->second);
+    std_dev_threshold_ = threshold_it->second;
+    closes_.reset(lookback_period_);
+
+    return true;
+}
+
+TradingSignal MeanReversionStrategy::generate_signal(const MarketData& data, const Position& current_position) {
+    TradingSignal signal;
+    signal.type = SignalType::HOLD;
+    signal.price = data.close;
+    signal.timestamp = data.timestamp;
+
+    closes_.push(data.close);
+    if (!closes_.is_ready()) {
+        return signal;
+    }
+
+    double zscore = closes_.get_zscore(data.close);
+    if (zscore < -std_dev_threshold_) {
+        signal.type = SignalType::BUY;
+        signal.quantity = 100.0; // Will be adjusted by risk management
+        signal.reason = "Close below lower band";
+    } else if (zscore > std_dev_threshold_) {
+        signal.type = SignalType::SELL;
+        signal.quantity = current_position.quantity;
+        signal.reason = "Close above upper band";
+    } else if (current_position.quantity > 0 && data.close >= closes_.get_mean()) {
+        signal.type = SignalType::SELL;
+        signal.quantity = current_position.quantity;
+        signal.reason = "Close reverted to the mean";
+    }
+
+    return signal;
+}
+
+std::map<std::string, double> MeanReversionStrategy::get_parameters() const {
+    return std::map<std::string, double>{
+        {"lookback_period", static_cast<double>(lookback_period_)},
+        {"std_dev_threshold", std_dev_threshold_}
+    };
+}
+
+bool MeanReversionStrategy::validate_parameters(const std::map<std::string, double>& params) const {
+    auto lookback_it = params.find("lookback_period");
+    auto threshold_it = params.find("std_dev_threshold");
+
+    if (lookback_it == params.end() || threshold_it == params.end()) {
+        return false;
+    }
+
+    // The window needs two closes for a spread
+    if (lookback_it->second < 2 || !std::isfinite(threshold_it->second) || threshold_it->second <= 0) {
+        return false;
+    }
+
+    return true;
+}
+
+void MeanReversionStrategy::reset() {
+    Strategy::reset();
+    closes_.reset();
+}
+
+std::unique_ptr<Strategy> MeanReversionStrategy::clone() const {
+    return std::make_unique<MeanReversionStrategy>(*this);
+}
+
+} // namespace TradingBot
@@ -0,0 +1,68 @@
+#include "strategy/resampled_strategy.h"
+#include "utils/time_utils.h"
+#include <stdexcept>
+
+namespace TradingBot {
+
+ResampledStrategy::ResampledStrategy(std::shared_ptr<Strategy> inner, DataInterval interval)
+    : Strategy(inner ? inner->get_name() + " @" + interval_name(interval) : std::string()),
+      inner_(inner), aggregator_(interval) {
+    if (!inner_) {
+        throw std::invalid_argument("ResampledStrategy requires a strategy");
+    }
+}
+
+bool ResampledStrategy::initialize(const std::map<std::string, double>& params) {
+    aggregator_.reset();
+    return inner_->initialize(params);
+}
+
+TradingSignal ResampledStrategy::generate_signal(const MarketData& data, const Position& current_position) {
+    TradingSignal signal;
+    signal.type = SignalType::HOLD;
+    signal.price = data.close;
+    signal.timestamp = data.timestamp;
+
+    int64_t epoch_seconds;
+    if (!get_epoch(data, epoch_seconds)) {
+        throw std::invalid_argument("Unparseable timestamp: " + data.timestamp);
+    }
+
+    if (aggregator_.add(data, epoch_seconds, completed_)) {
+        TradingSignal coarse = inner_->generate_signal(completed_, current_position);
+        signal.type = coarse.type;
+        signal.quantity = coarse.quantity;
+        signal.reason = coarse.reason;
+    }
+    return signal;
+}
+
+std::map<std::string, double> ResampledStrategy::get_parameters() const {
+    return inner_->get_parameters();
+}
+
+bool ResampledStrategy::validate_parameters(const std::map<std::string, double>& params) const {
+    return inner_->validate_parameters(params);
+}
+
+void ResampledStrategy::reset() {
+    Strategy::reset();
+    aggregator_.reset();
+    inner_->reset();
+}
+
+std::unique_ptr<Strategy> ResampledStrategy::clone() const {
+    auto copy = std::make_unique<ResampledStrategy>(*this);
+    copy->inner_ = inner_->clone();
+    return copy;
+}
+
+DataInterval ResampledStrategy::get_interval() const {
+    return aggregator_.get_interval();
+}
+
+const std::shared_ptr<Strategy>& ResampledStrategy::get_inner() const {
+    return inner_;
+}
+
+} // namespace TradingBot
@@ -34,13 +34,32 @@ TradingBot::TradingSignal TradingBot::RSIStrategy::generate_signal(const MarketD
     signal.price = data.close;
     signal.timestamp = data.timestamp;
     
-    price_history_.push_back(data);
+    double rsi;
 
-    if(price_history_.size() > static_cast<size_t>(rsi_period_ + 1)){
-        price_history_.erase(price_history_.begin());
+    if(indicator_cache_){
+        size_t index = next_cached_bar(data);
+
+        if(index < static_cast<size_t>(rsi_period_)){
+            signal.reason = "Not enough data for RSI";
+            return signal;
+        }
+
+        rsi = cached_indicator(IndicatorType::RSI, rsi_period_, index);
     }
+    else{
+        price_history_.push_back(data);
+
+        if(price_history_.size() > static_cast<size_t>(rsi_period_ + 1)){
+            price_history_.erase(price_history_.begin());
+        }
+
+        if(price_history_.size() < static_cast<size_t>(rsi_period_ + 1)){
+            signal.reason = "Not enough data for RSI";
+            return signal;
+        }
 
-    double rsi = calculate_rsi(price_history_, rsi_period_);
+        rsi = calculate_rsi(price_history_, rsi_period_);
+    }
 
     if(rsi < oversold_threshold_){
         signal.type = SignalType::BUY;
@@ -102,3 +121,12 @@ bool TradingBot::RSIStrategy::validate_parameters(const std::map<std::string, do
     
     return true;
 }
+
+void TradingBot::RSIStrategy::reset() {
+    Strategy::reset();
+    price_history_.clear();
+}
+
+std::unique_ptr<TradingBot::Strategy> TradingBot::RSIStrategy::clone() const {
+    return std::make_unique<RSIStrategy>(*this);
+}
@@ -27,45 +27,57 @@ TradingSignal SMACrossoverStrategy::generate_signal(const MarketData& data, cons
     signal.timestamp = data.timestamp;
     signal.type = SignalType::HOLD;
     
-    // Add current data to price history
-    price_history_.push_back(data);
+    double short_sma, long_sma, prev_short_sma, prev_long_sma;
     
-    // Keep only what we need to avoid memory bloat
-    if (price_history_.size() > static_cast<size_t>(long_period_ + 1)) {
-        price_history_.erase(price_history_.begin());
-    }
-    
-    // Need enough data for both SMAs
-    if (price_history_.size() < static_cast<size_t>(long_period_)) {
-        return signal; // Not enough data, return HOLD
-    }
-    
-    
-    double short_sma = calculate_sma(price_history_, short_period_);
-    double long_sma = calculate_sma(price_history_, long_period_);
-    
-    // Calculate previous SMAs for crossover detection
-    if (price_history_.size() > static_cast<size_t>(long_period_)) {
-        // Previous data (without the last element)
-        std::vector<MarketData> prev_data(price_history_.begin(), price_history_.end() - 1);
+    if (indicator_cache_) {
+        size_t index = next_cached_bar(data);
+        
+        // Crossover detection needs both SMAs on the previous bar too
+        if (index < static_cast<size_t>(long_period_)) {
+            return signal;
+        }
+        
+        short_sma = cached_indicator(IndicatorType::SMA, short_period_, index);
+        long_sma = cached_indicator(IndicatorType::SMA, long_period_, index);
+        prev_short_sma = cached_indicator(IndicatorType::SMA, short_period_, index - 1);
+        prev_long_sma = cached_indicator(IndicatorType::SMA, long_period_, index - 1);
+    } else {
+        // Add current data to price history
+        price_history_.push_back(data);
         
-        double prev_short_sma = calculate_sma(prev_data, short_period_);
-        double prev_long_sma = calculate_sma(prev_data, long_period_);
+        // Keep only what we need to avoid memory bloat
+        if (price_history_.size() > static_cast<size_t>(long_period_ + 1)) {
+            price_history_.erase(price_history_.begin());
+        }
         
-        // Detect crossovers
-        if (prev_short_sma <= prev_long_sma && short_sma > long_sma) {
-            // Short SMA crossed ABOVE long SMA → BUY
-            signal.type = SignalType::BUY;
-            signal.price = data.close;
-            signal.quantity = 100.0; // Will be adjusted by risk management
-            signal.reason = "Short SMA crossed above long SMA";
-        } else if (prev_short_sma >= prev_long_sma && short_sma < long_sma) {
-            // Short SMA crossed BELOW long SMA → SELL
-            signal.type = SignalType::SELL;
-            signal.price = data.close;
-            signal.quantity = current_position.quantity;
-            signal.reason = "Short SMA crossed below long SMA";
+        // Need enough data for both SMAs on this and the previous bar
+        if (price_history_.size() <= static_cast<size_t>(long_period_)) {
+            return signal; // Not enough data, return HOLD
         }
+        
+        short_sma = calculate_sma(price_history_, short_period_);
+        long_sma = calculate_sma(price_history_, long_period_);
+        
+        // Previous data (without the last element)
+        std::vector<MarketData> prev_data(price_history_.begin(), price_history_.end() - 1);
+        
+        prev_short_sma = calculate_sma(prev_data, short_period_);
+        prev_long_sma = calculate_sma(prev_data, long_period_);
+    }
+    
+    // Detect crossovers
+    if (prev_short_sma <= prev_long_sma && short_sma > long_sma) {
+        // Short SMA crossed ABOVE long SMA → BUY
+        signal.type = SignalType::BUY;
+        signal.price = data.close;
+        signal.quantity = 100.0; // Will be adjusted by risk management
+        signal.reason = "Short SMA crossed above long SMA";
+    } else if (prev_short_sma >= prev_long_sma && short_sma < long_sma) {
+        // Short SMA crossed BELOW long SMA → SELL
+        signal.type = SignalType::SELL;
+        signal.price = data.close;
+        signal.quantity = current_position.quantity;
+        signal.reason = "Short SMA crossed below long SMA";
     }
     
     return signal;
@@ -102,4 +114,13 @@ bool SMACrossoverStrategy::validate_parameters(const std::map<std::string, doubl
     return true;
 }
 
+void SMACrossoverStrategy::reset() {
+    Strategy::reset();
+    price_history_.clear();
+}
+
+std::unique_ptr<Strategy> SMACrossoverStrategy::clone() const {
+    return std::make_unique<SMACrossoverStrategy>(*this);
+}
+
 } // namespace TradingBot
@@ -1,10 +1,13 @@
 #include "strategy/strategy.h"
+#include "strategy/indicator_kernels.h"
 #include <cmath>
 #include <algorithm>
+#include <stdexcept>
 
 namespace TradingBot {
 
-Strategy::Strategy(const std::string& name) : name_(name) {
+Strategy::Strategy(const std::string& name)
+    : name_(name), series_data_(nullptr), bar_index_(0) {
 }
 
 Strategy::~Strategy() {
@@ -14,85 +17,92 @@ void Strategy::update(const MarketData& data) {
     
 }
 
+void Strategy::reset() {
+    // An attached cache stays attached; the run restarts at its first bar
+    bar_index_ = 0;
+}
+
 const std::string& Strategy::get_name() const {
     return name_;
 }
 
+void Strategy::attach_indicator_cache(std::shared_ptr<IndicatorCache> cache,
+                                      const std::string& series_id,
+                                      const std::vector<MarketData>& data) {
+    indicator_cache_ = cache;
+    series_id_ = series_id;
+    series_data_ = &data;
+    bar_index_ = 0;
+    cached_series_.clear();
+}
+
+void Strategy::detach_indicator_cache() {
+    indicator_cache_.reset();
+    series_id_.clear();
+    series_data_ = nullptr;
+    bar_index_ = 0;
+    cached_series_.clear();
+}
+
+size_t Strategy::next_cached_bar(const MarketData& data) {
+    size_t index = bar_index_++;
+    
+    if (!series_data_ || index >= series_data_->size() || (*series_data_)[index].close != data.close) {
+        throw std::logic_error("Indicator cache out of sync with market data");
+    }
+    
+    return index;
+}
+
+double Strategy::cached_indicator(IndicatorType type, int period, size_t index) {
+    for (const auto& series : cached_series_) {
+        if (series.type == type && series.period == period) {
+            return (*series.values)[index];
+        }
+    }
+    
+    cached_series_.push_back({type, period, indicator_cache_->get(series_id_, *series_data_, type, period)});
+    return (*cached_series_.back().values)[index];
+}
+
+const double* Strategy::gather_closes(const std::vector<MarketData>& data, size_t begin) {
+    closes_.resize(data.size() - begin);
+    for (size_t i = begin; i < data.size(); ++i) {
+        closes_[i - begin] = data[i].close;
+    }
+    return closes_.data();
+}
+
 double Strategy::calculate_sma(const std::vector<MarketData>& data, int period) {
 
-    if(data.size() < period){
+    if(period <= 0 || data.size() < static_cast<size_t>(period)){
         throw std::invalid_argument("Data size is less than period");
     }
 
-    double SMA = 0.0;
-   
     // Use the last 'period' elements
-    for(size_t i = data.size() - period; i < data.size(); i++){
-        SMA += data[i].close;
-    }
-    SMA /= period;  // Divide by period, not data.size()
-    return SMA;
+    return IndicatorKernels::window_sum(gather_closes(data, data.size() - period), period) / period;
 
 }
 
 double Strategy::calculate_ema(const std::vector<MarketData>& data, int period) {
    
-    if(data.size() < period){
+    if(period <= 0 || data.size() < static_cast<size_t>(period)){
         throw std::invalid_argument("Data size is less than period");
     }
 
-    double multiplier = 2.0 / (period + 1);
-    
-    //SMA of first 'period' elements
-    double EMA = 0.0;
-    for(int i = 0; i < period; i++){
-        EMA += data[i].close;
-    }
-    EMA /= period;
-
-    //EMA for remaining elements
-    for(size_t i = period; i < data.size(); i++){
-        EMA = (data[i].close * multiplier) + (EMA * (1 - multiplier));
-    }
-    return EMA;
+    // Seeded with the SMA of the first 'period' elements
+    return IndicatorKernels::ema(gather_closes(data, 0), data.size(), period, nullptr);
 
 }
 
 double Strategy::calculate_rsi(const std::vector<MarketData>& data, int period) {
     
-    if(data.size() < period + 1){
+    if(period <= 0 || data.size() < static_cast<size_t>(period) + 1){
         throw std::invalid_argument("Data size is less than period + 1");
     }
 
-    // Calculate price changes (gains and losses)
-    std::vector<double> gains, losses;
-    for (size_t i = 1; i < data.size(); i++) {
-        double change = data[i].close - data[i-1].close;
-        if (change > 0) {
-            gains.push_back(change);
-            losses.push_back(0.0);
-        } else {
-            gains.push_back(0.0);
-            losses.push_back(-change);  // Make loss positive
-        }
-    }
-    
-    // Calculate average gains and losses
-    double avg_gain = 0.0, avg_loss = 0.0;
-    for (size_t i = gains.size() - period; i < gains.size(); i++) {
-        avg_gain += gains[i];
-        avg_loss += losses[i];
-    }
-    avg_gain /= period;
-    avg_loss /= period;
-    
-    // Calculate RSI
-    if (avg_loss == 0.0) {
-        return 100.0;  // All gains, no losses
-    } else {
-        double RS = avg_gain / avg_loss;
-        return 100.0 - (100.0 / (1.0 + RS));
-    }
+    // Simple average of the gains and losses over the last 'period' changes
+    return IndicatorKernels::rsi_value(gather_closes(data, data.size() - period - 1), period);
 }
 
 } // namespace TradingBot
@@ -0,0 +1,245 @@
+#include "strategy/strategy_registry.h"
+#include <cmath>
+#include <mutex>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace TradingBot {
+
+namespace {
+
+using PluginVersionFunction = int (*)();
+using PluginRegisterFunction = bool (*)(StrategyRegistry&);
+
+std::string format_number(double value) {
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+} // namespace
+
+std::string check_parameter(const ParameterSpec& spec, double value) {
+    if (!std::isfinite(value) || value < spec.min_value || value > spec.max_value) {
+        return spec.name + " = " + format_number(value) + " is outside [" + format_number(spec.min_value) + ", " +
+               format_number(spec.max_value) + "]";
+    }
+    if (spec.type == ParameterType::INTEGER && value != std::floor(value)) {
+        return spec.name + " = " + format_number(value) + " is not a whole number";
+    }
+    return "";
+}
+
+bool resolve_parameter_schema(const std::string& strategy_name, const std::vector<ParameterSpec>& schema,
+                              const std::map<std::string, double>& overrides,
+                              std::map<std::string, double>& params, std::string& error) {
+    params.clear();
+    for (const auto& spec : schema) {
+        params[spec.name] = spec.default_value;
+    }
+    for (const auto& value : overrides) {
+        const ParameterSpec* spec = nullptr;
+        for (const auto& candidate : schema) {
+            if (candidate.name == value.first) {
+                spec = &candidate;
+                break;
+            }
+        }
+        if (!spec) {
+            error = strategy_name + " has no parameter " + value.first;
+            return false;
+        }
+        std::string problem = check_parameter(*spec, value.second);
+        if (!problem.empty()) {
+            error = strategy_name + ": " + problem;
+            return false;
+        }
+        params[value.first] = value.second;
+    }
+    return true;
+}
+
+StrategyRegistry& StrategyRegistry::instance() {
+    static StrategyRegistry registry;
+    static std::once_flag builtins;
+    std::call_once(builtins, [] { registry.register_builtins(); });
+    return registry;
+}
+
+StrategyRegistry::StrategyRegistry() {
+}
+
+void StrategyRegistry::register_builtins() {
+    std::string error;
+
+    StrategyInfo sma;
+    sma.name = "SMA_CROSSOVER";
+    sma.aliases = {"SMA"};
+    sma.description = "Simple moving average crossover";
+    sma.parameters = {
+        ParameterSpec("short_period", ParameterType::INTEGER, 2.0, 50.0, 10.0, 1.0, "Fast average length"),
+        ParameterSpec("long_period", ParameterType::INTEGER, 10.0, 200.0, 30.0, 1.0, "Slow average length"),
+    };
+    sma.create = [] { return std::make_unique<SMACrossoverStrategy>(); };
+    register_strategy(sma, error);
+
+    StrategyInfo ema;
+    ema.name = "EMA_CROSSOVER";
+    ema.aliases = {"EMA"};
+    ema.description = "Exponential moving average crossover";
+    ema.parameters = {
+        ParameterSpec("short_period", ParameterType::INTEGER, 2.0, 50.0, 12.0, 1.0, "Fast average length"),
+        ParameterSpec("long_period", ParameterType::INTEGER, 10.0, 200.0, 26.0, 1.0, "Slow average length"),
+    };
+    ema.create = [] { return std::make_unique<EMAStrategy>(); };
+    register_strategy(ema, error);
+
+    StrategyInfo rsi;
+    rsi.name = "RSI";
+    rsi.aliases = {"RSI_STRATEGY"};
+    rsi.description = "RSI overbought/oversold";
+    rsi.parameters = {
+        ParameterSpec("period", ParameterType::INTEGER, 2.0, 50.0, 14.0, 1.0, "RSI length"),
+        ParameterSpec("overbought_threshold", ParameterType::REAL, 50.0, 95.0, 70.0, 1.0, "Sell above this RSI"),
+        ParameterSpec("oversold_threshold", ParameterType::REAL, 5.0, 50.0, 30.0, 1.0, "Buy below this RSI"),
+    };
+    rsi.create = [] { return std::make_unique<RSIStrategy>(); };
+    register_strategy(rsi, error);
+
+    StrategyInfo mean_reversion;
+    mean_reversion.name = "MEAN_REVERSION";
+    mean_reversion.aliases = {"BOLLINGER"};
+    mean_reversion.description = "Mean reversion on rolling standard deviation bands";
+    mean_reversion.parameters = {
+        ParameterSpec("lookback_period", ParameterType::INTEGER, 5.0, 200.0, 20.0, 1.0, "Rolling window length"),
+        ParameterSpec("std_dev_threshold", ParameterType::REAL, 0.5, 4.0, 2.0, 0.25, "Band width in standard deviations"),
+    };
+    mean_reversion.create = [] { return std::make_unique<MeanReversionStrategy>(); };
+    register_strategy(mean_reversion, error);
+}
+
+bool StrategyRegistry::register_strategy(const StrategyInfo& info, std::string& error) {
+    if (info.name.empty() || !info.create) {
+        error = "strategy '" + info.name + "' needs a name and a factory";
+        return false;
+    }
+    for (const auto& spec : info.parameters) {
+        std::string problem = check_parameter(spec, spec.default_value);
+        if (!problem.empty()) {
+            error = info.name + ": default " + problem;
+            return false;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> names = info.aliases;
+    names.push_back(info.name);
+    for (const auto& name : names) {
+        if (by_name_.count(name)) {
+            error = "strategy name '" + name + "' is already registered";
+            return false;
+        }
+    }
+
+    strategies_.push_back(info);
+    for (const auto& name : names) {
+        by_name_[name] = &strategies_.back();
+    }
+    return true;
+}
+
+bool StrategyRegistry::load_plugin(const std::string& path, std::string& error) {
+#ifdef _WIN32
+    HMODULE library = LoadLibraryA(path.c_str());
+    if (!library) {
+        error = "cannot load " + path + " (error " + std::to_string(GetLastError()) + ")";
+        return false;
+    }
+    auto version = reinterpret_cast<PluginVersionFunction>(GetProcAddress(library, TRADINGBOT_PLUGIN_VERSION_SYMBOL));
+    auto registration =
+        reinterpret_cast<PluginRegisterFunction>(GetProcAddress(library, TRADINGBOT_PLUGIN_REGISTER_SYMBOL));
+    auto close = [library] { FreeLibrary(library); };
+#else
+    void* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!library) {
+        const char* reason = dlerror();
+        error = "cannot load " + path + ": " + (reason ? reason : "unknown error");
+        return false;
+    }
+    auto version = reinterpret_cast<PluginVersionFunction>(dlsym(library, TRADINGBOT_PLUGIN_VERSION_SYMBOL));
+    auto registration = reinterpret_cast<PluginRegisterFunction>(dlsym(library, TRADINGBOT_PLUGIN_REGISTER_SYMBOL));
+    auto close = [library] { dlclose(library); };
+#endif
+
+    if (!version || !registration) {
+        close();
+        error = path + " is not a strategy plugin";
+        return false;
+    }
+    if (version() != STRATEGY_PLUGIN_API_VERSION) {
+        close();
+        error = path + " was built for plugin API " + std::to_string(version()) + ", expected " +
+                std::to_string(STRATEGY_PLUGIN_API_VERSION);
+        return false;
+    }
+
+    // Factories registered so far point into the library, so it stays
+    // loaded even if registration fails part way
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        plugins_.push_back(reinterpret_cast<void*>(library));
+    }
+    if (!registration(*this)) {
+        error = path + ": plugin registration failed";
+        return false;
+    }
+    return true;
+}
+
+const StrategyInfo* StrategyRegistry::find(const std::string& name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = by_name_.find(name);
+    return it == by_name_.end() ? nullptr : it->second;
+}
+
+std::vector<std::string> StrategyRegistry::get_names() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> names;
+    for (const auto& info : strategies_) {
+        names.push_back(info.name);
+    }
+    return names;
+}
+
+std::unique_ptr<Strategy> StrategyRegistry::create(const std::string& name) const {
+    const StrategyInfo* info = find(name);
+    return info ? info->create() : nullptr;
+}
+
+std::map<std::string, double> StrategyRegistry::get_default_parameters(const std::string& name) const {
+    std::map<std::string, double> params;
+    if (const StrategyInfo* info = find(name)) {
+        for (const auto& spec : info->parameters) {
+            params[spec.name] = spec.default_value;
+        }
+    }
+    return params;
+}
+
+bool StrategyRegistry::resolve_parameters(const std::string& name, const std::map<std::string, double>& overrides,
+                                          std::map<std::string, double>& params, std::string& error) const {
+    const StrategyInfo* info = find(name);
+    if (!info) {
+        error = "unknown strategy " + name;
+        return false;
+    }
+
+    return resolve_parameter_schema(info->name, info->parameters, overrides, params, error);
+}
+
+} // namespace TradingBot
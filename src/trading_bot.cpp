@@ -1,7 +1,10 @@
 #include "trading_bot.h"
 #include "utils/logger.h"
+#include "live/api_quote_feed.h"
+#include "batch/batch_runner.h"
+#include "utils/time_utils.h"
+#include <filesystem>
 #include <fstream>
-#include <sstream>
 #include <stdexcept>
 #include <iostream>
 
@@ -11,7 +14,7 @@
 
 namespace TradingBot {
 
-TradingBot::TradingBot() : api_enabled_(false) {
+TradingBot::TradingBot() : data_modified_(0), data_size_(0), api_enabled_(false) {
     // Initialize all component pointers to nullptr
     // They will be created during initialization
 }
@@ -28,23 +31,23 @@ bool TradingBot::initialize(const std::string& config_file) {
         }
         
         // Initialize CSV Parser
-        csv_parser_ = std::make_unique<CSVParser>();
+        csv_parser_ = std::make_shared<CSVParser>();
         
         // Initialize API Data Fetcher
         api_fetcher_ = std::make_unique<APIDataFetcher>();
         std::map<std::string, std::string> api_config;
         
-        // Try to get API key from config
-        if (config_data_.find("api") != config_data_.end()) {
-            auto& api_settings = config_data_["api"];
-            if (api_settings.find("alpha_vantage_key") != api_settings.end()) {
-                api_config["alpha_vantage_key"] = api_settings["alpha_vantage_key"];
-            }
+        // API key from api.alpha_vantage.api_key
+        const ApiConfig& api_settings = config_.get().api;
+        if (api_settings.alpha_vantage.enabled && !api_settings.alpha_vantage.api_key.empty()) {
+            api_config["alpha_vantage_key"] = api_settings.alpha_vantage.api_key;
         }
         
         if (api_fetcher_->initialize(api_config)) {
-            // Default to Yahoo Finance if no API key provided
-            api_fetcher_->set_provider(APIProvider::YAHOO_FINANCE);
+            // Yahoo Finance unless Alpha Vantage is configured as the default and has a key
+            bool alpha_vantage = api_settings.default_provider == "alpha_vantage" &&
+                                 api_config.count("alpha_vantage_key") > 0;
+            api_fetcher_->set_provider(alpha_vantage ? APIProvider::ALPHA_VANTAGE : APIProvider::YAHOO_FINANCE);
             api_enabled_ = true;
             LOG_INFO("API data fetcher initialized successfully");
         } else {
@@ -53,12 +56,13 @@ bool TradingBot::initialize(const std::string& config_file) {
         }
         
         // Initialize Risk Manager with loaded or default parameters
-        risk_manager_ = std::make_unique<RiskManager>();
+        risk_manager_ = std::make_shared<RiskManager>();
         RiskParameters risk_params = load_risk_parameters();
         if (!risk_manager_->initialize(risk_params)) {
             LOG_ERROR("Failed to initialize Risk Manager");
             return false;
         }
+        risk_manager_->set_session_calendar(load_session_calendar());
         
         // Initialize Backtester with loaded or default configuration
         backtester_ = std::make_unique<Backtester>();
@@ -82,24 +86,38 @@ bool TradingBot::initialize(const std::string& config_file) {
 
 bool TradingBot::run_backtest(const std::string& data_file, const std::string& strategy_name) {
     try {
-        
-        if (!csv_parser_->load_data(data_file)) {
-            LOG_ERROR("Failed to load data from: " + data_file);
-            return false;
-        }
-        
-        if (!csv_parser_->validate_data()) {
-            LOG_ERROR("Data validation failed for: " + data_file);
-            return false;
+        // The parser, strategy and risk manager stay owned by the bot and are
+        // reused by the next run; the backtester resets them. The data is
+        // read again when the file changed on disk since it was loaded.
+        std::error_code code;
+        uintmax_t size = std::filesystem::file_size(data_file, code);
+        int64_t modified = code ? 0 : std::filesystem::last_write_time(data_file, code).time_since_epoch().count();
+        if (csv_parser_->get_source() != data_file || csv_parser_->get_data_count() == 0 ||
+            size != data_size_ || modified != data_modified_) {
+            if (!csv_parser_->load_data(data_file)) {
+                LOG_ERROR("Failed to load data from: " + data_file);
+                csv_parser_->clear();
+                return false;
+            }
+            
+            if (!csv_parser_->validate_data()) {
+                LOG_ERROR("Data validation failed for: " + data_file);
+                csv_parser_->clear();
+                return false;
+            }
+            
+            data_size_ = size;
+            data_modified_ = modified;
+            LOG_INFO("Loaded " + std::to_string(csv_parser_->get_data_count()) + " rows of market data");
         }
         
-        LOG_INFO("Loaded " + std::to_string(csv_parser_->get_data_count()) + " rows of market data");
-        
-        
-        strategy_ = create_strategy(strategy_name);
-        if (!strategy_) {
-            LOG_ERROR("Failed to create strategy: " + strategy_name);
-            return false;
+        if (!strategy_ || strategy_name_ != strategy_name) {
+            strategy_ = create_strategy(strategy_name);
+            strategy_name_ = strategy_ ? strategy_name : std::string();
+            if (!strategy_) {
+                LOG_ERROR("Failed to create strategy: " + strategy_name);
+                return false;
+            }
         }
         
         // Initialize strategy with default parameters
@@ -112,11 +130,7 @@ bool TradingBot::run_backtest(const std::string& data_file, const std::string& s
         LOG_INFO("Initialized strategy: " + strategy_name);
         
         
-        results_ = backtester_->run_backtest(
-            std::shared_ptr<Strategy>(strategy_.release()),
-            std::shared_ptr<CSVParser>(csv_parser_.release()),
-            std::shared_ptr<RiskManager>(risk_manager_.release())
-        );
+        results_ = backtester_->run_backtest(strategy_, csv_parser_, risk_manager_);
         
         LOG_INFO("Backtest completed successfully");
         LOG_INFO("Total trades: " + std::to_string(results_.total_trades));
@@ -130,6 +144,177 @@ bool TradingBot::run_backtest(const std::string& data_file, const std::string& s
     }
 }
 
+bool TradingBot::run_backtests(const std::string& data_file, const std::vector<std::string>& strategy_names) {
+    try {
+        auto data = std::make_shared<CSVParser>();
+        if (!data->load_data(data_file)) {
+            LOG_ERROR("Failed to load data from: " + data_file);
+            return false;
+        }
+        
+        if (!data->validate_data()) {
+            LOG_ERROR("Data validation failed for: " + data_file);
+            return false;
+        }
+        
+        LOG_INFO("Loaded " + std::to_string(data->get_data_count()) + " rows of market data");
+        
+        RiskParameters risk_params = load_risk_parameters();
+        SessionCalendar calendar = load_session_calendar();
+        std::vector<StrategyRun> runs;
+        for (const auto& strategy_name : strategy_names) {
+            std::shared_ptr<Strategy> strategy = create_strategy(strategy_name);
+            if (!strategy || !strategy->initialize(get_strategy_parameters(strategy_name))) {
+                LOG_ERROR("Failed to create strategy: " + strategy_name);
+                return false;
+            }
+            
+            auto risk_manager = std::make_shared<RiskManager>();
+            if (!risk_manager->initialize(risk_params)) {
+                LOG_ERROR("Failed to initialize Risk Manager");
+                return false;
+            }
+            risk_manager->set_session_calendar(calendar);
+            
+            runs.emplace_back(strategy, risk_manager, backtester_->get_config());
+        }
+        
+        std::vector<BacktestResults> results = backtester_->run_backtests(runs, data);
+        
+        comparison_results_.clear();
+        for (size_t i = 0; i < strategy_names.size(); ++i) {
+            comparison_results_[strategy_names[i]] = results[i];
+            LOG_INFO(strategy_names[i] + ": " + std::to_string(results[i].total_trades) + " trades, " +
+                     std::to_string(results[i].total_return * 100) + "% return");
+        }
+        
+        return true;
+        
+    } catch (const std::exception& e) {
+        LOG_ERROR("Backtest failed: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool TradingBot::run_universe_backtest(const std::map<std::string, std::string>& data_files,
+                                       const std::string& strategy_name, size_t rebalance_period) {
+    try {
+        const CrossSectionalRegistry& registry = CrossSectionalRegistry::instance();
+        std::shared_ptr<CrossSectionalStrategy> strategy = registry.create(strategy_name);
+        if (!strategy) {
+            std::string names;
+            for (const auto& name : registry.get_names()) {
+                names += (names.empty() ? "" : ", ") + name;
+            }
+            LOG_ERROR("Unknown cross-sectional strategy: " + strategy_name + " (available: " + names + ")");
+            return false;
+        }
+        
+        // Schema defaults, overridden by the config's "strategies" section
+        std::map<std::string, double> configured;
+        const auto& sections = config_.get().strategies;
+        auto entry = sections.find(strategy_name);
+        if (entry != sections.end()) {
+            configured = entry->second;
+        }
+        std::map<std::string, double> params;
+        std::string error;
+        if (!registry.resolve_parameters(strategy_name, configured, params, error)) {
+            LOG_ERROR("Invalid parameters for strategy: " + error);
+            return false;
+        }
+        if (!strategy->initialize(params)) {
+            LOG_ERROR("Invalid parameters for strategy: " + strategy_name);
+            return false;
+        }
+        
+        std::vector<std::string> symbols;
+        std::vector<CSVParser> parsers(data_files.size());
+        std::vector<const std::vector<MarketData>*> series;
+        for (const auto& file : data_files) {
+            CSVParser& parser = parsers[symbols.size()];
+            if (!parser.load_data(file.second) || !parser.validate_data()) {
+                LOG_ERROR("Failed to load data for " + file.first + " from: " + file.second);
+                return false;
+            }
+            symbols.push_back(file.first);
+            series.push_back(&parser.get_all_data());
+        }
+        UniverseData universe = UniverseData::align(symbols, series);
+        LOG_INFO("Loaded " + std::to_string(universe.symbol_count()) + " symbols over " +
+                 std::to_string(universe.bar_count()) + " bars");
+        
+        CrossSectionalBacktester backtester;
+        if (!backtester.initialize(backtester_->get_config())) {
+            LOG_ERROR("Failed to initialize backtester");
+            return false;
+        }
+        backtester.set_rebalance_period(rebalance_period);
+        if (config_.get().portfolio_risk && !backtester.set_portfolio_risk(*config_.get().portfolio_risk)) {
+            LOG_ERROR("Invalid portfolio risk limits");
+            return false;
+        }
+        results_ = backtester.run_universe_backtest(strategy, universe);
+        if (backtester.get_rejected_orders() > 0) {
+            LOG_INFO("Portfolio risk limits skipped " + std::to_string(backtester.get_rejected_orders()) + " buys");
+        }
+        
+        LOG_INFO(strategy_name + ": " + std::to_string(results_.total_trades) + " trades, " +
+                 std::to_string(results_.total_return * 100) + "% return");
+        return true;
+        
+    } catch (const std::exception& e) {
+        LOG_ERROR("Backtest failed: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool TradingBot::run_batch(const std::string& manifest_file) {
+    try {
+        BatchManifest manifest;
+        std::string error;
+        if (!BatchRunner::load_manifest(manifest_file, manifest, error)) {
+            LOG_ERROR("Invalid batch manifest: " + error);
+            return false;
+        }
+        
+        BatchRunner runner;
+        if (!runner.initialize(load_backtest_config(), load_risk_parameters())) {
+            LOG_ERROR("Failed to initialize batch runner");
+            return false;
+        }
+        runner.set_session_calendar(load_session_calendar());
+        
+        std::vector<BatchJobResult> results = runner.run(
+            manifest,
+            [this](const std::string& name) { return create_strategy(name); },
+            [this](const std::string& name) { return get_strategy_parameters(name); });
+        
+        size_t failed = 0;
+        for (const auto& result : results) {
+            if (!result.success) {
+                ++failed;
+                LOG_WARNING("Batch job " + result.data_id + "/" + result.strategy_name + "/" +
+                            result.override_name + " failed: " + result.error);
+            }
+        }
+        
+        if (!BatchRunner::write_results(results, manifest.output_file)) {
+            LOG_ERROR("Failed to write batch results: " + manifest.output_file);
+            return false;
+        }
+        
+        LOG_INFO("Batch finished: " + std::to_string(results.size()) + " jobs (" + std::to_string(failed) +
+                 " failed) over " + std::to_string(runner.get_data_loads()) + " data files, results in " +
+                 manifest.output_file);
+        return failed == 0;
+        
+    } catch (const std::exception& e) {
+        LOG_ERROR("Batch failed: " + std::string(e.what()));
+        return false;
+    }
+}
+
 void TradingBot::generate_report(const std::string& output_file) {
     try {
         // TODO: Use ReportGenerator when implemented
@@ -167,6 +352,10 @@ void TradingBot::generate_report(const std::string& output_file) {
     }
 }
 
+const std::map<std::string, BacktestResults>& TradingBot::get_comparison_results() const {
+    return comparison_results_;
+}
+
 const BacktestResults& TradingBot::get_results() const {
     return results_;
 }
@@ -205,6 +394,10 @@ bool TradingBot::run_backtest_with_api(
         
         LOG_INFO("Data saved to: " + temp_csv);
         
+        // Same file name for every fetch of the symbol: never reuse the bars
+        // of an earlier run
+        csv_parser_->clear();
+        
         // Run backtest with the fetched data
         bool result = run_backtest(temp_csv, strategy_name);
         
@@ -259,6 +452,152 @@ bool TradingBot::fetch_market_data(
     }
 }
 
+OptimizationResult TradingBot::optimize_strategy(
+    const std::string& data_file,
+    const std::string& strategy_name,
+    const OptimizerConfig& optimizer_config) {
+    
+    OptimizationResult result;
+    
+    try {
+        auto data = std::make_shared<CSVParser>();
+        if (!data->load_data(data_file) || !data->validate_data()) {
+            LOG_ERROR("Failed to load data from: " + data_file);
+            return result;
+        }
+        
+        if (!create_strategy(strategy_name)) {
+            return result;
+        }
+        
+        ParameterOptimizer optimizer;
+        if (!optimizer.initialize(optimizer_config)) {
+            LOG_ERROR("Invalid optimizer configuration");
+            return result;
+        }
+        optimizer.set_session_calendar(load_session_calendar());
+        
+        for (const auto& range : get_parameter_ranges(strategy_name)) {
+            optimizer.add_parameter(range);
+        }
+        
+        LOG_INFO("Optimizing " + strategy_name + " over " +
+                 std::to_string(optimizer.get_parameters().size()) + " parameters");
+        
+        result = optimizer.optimize(
+            [this, strategy_name]() { return create_strategy(strategy_name); },
+            data, load_backtest_config(), load_risk_parameters());
+        
+        LOG_INFO("Optimization finished after " + std::to_string(result.evaluations) +
+                 " backtests (" + std::to_string(result.cache_hits) + " memoized)");
+        LOG_INFO("Best score: " + std::to_string(result.best_score));
+        
+    } catch (const std::exception& e) {
+        LOG_ERROR("Optimization failed: " + std::string(e.what()));
+    }
+    
+    return result;
+}
+
+bool TradingBot::run_paper_trading(
+    const std::string& strategy_name,
+    const PaperTradingConfig& paper_config) {
+    
+    try {
+        if (!api_enabled_ || !api_fetcher_) {
+            LOG_ERROR("API data fetcher is not available");
+            return false;
+        }
+        
+        std::shared_ptr<Strategy> strategy = create_strategy(strategy_name);
+        if (!strategy || !strategy->initialize(get_strategy_parameters(strategy_name))) {
+            LOG_ERROR("Failed to create strategy: " + strategy_name);
+            return false;
+        }
+        
+        auto risk_manager = std::make_shared<RiskManager>();
+        if (!risk_manager->initialize(load_risk_parameters())) {
+            LOG_ERROR("Failed to initialize Risk Manager");
+            return false;
+        }
+        risk_manager->set_session_calendar(load_session_calendar());
+        
+        PaperTrader trader;
+        if (!trader.initialize(load_backtest_config())) {
+            LOG_ERROR("Failed to initialize paper trader");
+            return false;
+        }
+        trader.set_paper_config(paper_config);
+        trader.set_journal(journal_);
+        
+        LOG_INFO("Paper trading " + paper_config.symbol + " with " + strategy_name);
+        
+        if (!trader.start(strategy, std::make_shared<APIQuoteFeed>(*api_fetcher_), risk_manager)) {
+            LOG_ERROR("Failed to start paper trading session");
+            return false;
+        }
+        results_ = trader.wait();
+        
+        LOG_INFO("Paper trading finished: " + std::to_string(trader.get_decisions()) + " quotes decided, " +
+                 std::to_string(trader.get_quotes_dropped()) + " dropped");
+        LOG_INFO("Simulated fills: " + std::to_string(results_.total_trades));
+        LOG_INFO("Tick-to-decision latency: " + trader.get_latency_histogram().summary());
+        
+        return true;
+        
+    } catch (const std::exception& e) {
+        LOG_ERROR("Paper trading failed: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool TradingBot::start_recording(const std::string& journal_file) {
+    if (!api_enabled_ || !api_fetcher_) {
+        LOG_ERROR("API data fetcher is not available");
+        return false;
+    }
+    
+    auto journal = std::make_shared<JournalWriter>();
+    if (!journal->open(journal_file)) {
+        LOG_ERROR("Failed to open journal: " + journal_file);
+        return false;
+    }
+    
+    api_fetcher_->enable_recording(journal);
+    journal_ = journal;
+    LOG_INFO("Recording market data to: " + journal_file);
+    return true;
+}
+
+bool TradingBot::use_recorded_session(const std::string& journal_file) {
+    if (!api_enabled_ || !api_fetcher_) {
+        LOG_ERROR("API data fetcher is not available");
+        return false;
+    }
+    
+    auto client = std::make_unique<JournalAPIClient>();
+    if (!client->load(journal_file)) {
+        LOG_ERROR("Failed to load journal: " + journal_file);
+        return false;
+    }
+    
+    // Stand in for the network providers
+    api_fetcher_->set_client(APIProvider::YAHOO_FINANCE, std::move(client));
+    api_fetcher_->set_provider(APIProvider::YAHOO_FINANCE);
+    LOG_INFO("Serving market data from journal: " + journal_file);
+    return true;
+}
+
+bool TradingBot::load_strategy_plugin(const std::string& library_file) {
+    std::string error;
+    if (!StrategyRegistry::instance().load_plugin(library_file, error)) {
+        LOG_ERROR("Failed to load strategy plugin: " + error);
+        return false;
+    }
+    LOG_INFO("Loaded strategy plugin: " + library_file + " (strategies: " + available_strategies() + ")");
+    return true;
+}
+
 bool TradingBot::set_api_provider(APIProvider provider) {
     if (!api_enabled_ || !api_fetcher_) {
         LOG_ERROR("API data fetcher is not available");
@@ -277,147 +616,134 @@ bool TradingBot::set_api_provider(APIProvider provider) {
 // Private helper methods
 
 std::unique_ptr<Strategy> TradingBot::create_strategy(const std::string& strategy_name) {
-    // Factory method to create different strategy types
-    
-    if (strategy_name == "SMA_CROSSOVER" || strategy_name == "SMA") {
-        return std::make_unique<SMACrossoverStrategy>();
-        
-    } else if (strategy_name == "EMA_CROSSOVER" || strategy_name == "EMA") {
-        return std::make_unique<EMAStrategy>();
-        
-    } else if (strategy_name == "RSI" || strategy_name == "RSI_STRATEGY") {
-        return std::make_unique<RSIStrategy>();
-        
-    } else {
+    std::unique_ptr<Strategy> strategy = StrategyRegistry::instance().create(strategy_name);
+    if (!strategy) {
         LOG_ERROR("Unknown strategy name: " + strategy_name);
-        LOG_INFO("Available strategies: SMA_CROSSOVER, EMA_CROSSOVER, RSI");
-        return nullptr;
+        LOG_INFO("Available strategies: " + available_strategies());
     }
+    return strategy;
 }
 
 std::map<std::string, double> TradingBot::get_strategy_parameters(const std::string& strategy_name) {
-    std::map<std::string, double> params;
-    
-    // Start with default parameters for each strategy type
-    if (strategy_name == "SMA_CROSSOVER" || strategy_name == "SMA") {
-        params = {
-            {"short_period", 10.0},
-            {"long_period", 30.0}
-        };
-        
-    } else if (strategy_name == "EMA_CROSSOVER" || strategy_name == "EMA") {
-        params = {
-            {"short_period", 12.0},
-            {"long_period", 26.0}
-        };
-        
-    } else if (strategy_name == "RSI" || strategy_name == "RSI_STRATEGY") {
-        params = {
-            {"rsi_period", 14.0},
-            {"overbought_threshold", 70.0},
-            {"oversold_threshold", 30.0}
-        };
-        
-    } else {
+    const StrategyRegistry& registry = StrategyRegistry::instance();
+    const StrategyInfo* info = registry.find(strategy_name);
+    if (!info) {
         LOG_ERROR("Unknown strategy name: " + strategy_name);
-        LOG_INFO("Available strategies: SMA_CROSSOVER, EMA_CROSSOVER, RSI");
+        LOG_INFO("Available strategies: " + available_strategies());
         return {};
     }
     
+    // Schema defaults, overridden by the config's "strategies" section
+    std::map<std::string, double> configured;
+    const auto& sections = config_.get().strategies;
+    auto entry = sections.find(info->name);
+    if (entry == sections.end()) {
+        entry = sections.find(strategy_name);
+    }
+    if (entry != sections.end()) {
+        configured = entry->second;
+    }
+    
+    std::map<std::string, double> params;
+    std::string error;
+    if (!registry.resolve_parameters(info->name, configured, params, error)) {
+        LOG_WARNING("Ignoring configured parameters (" + error + "), using defaults");
+        params = registry.get_default_parameters(info->name);
+    }
+    
     LOG_INFO("Loaded parameters for strategy: " + strategy_name);
     return params;
 }
 
+std::vector<ParameterRange> TradingBot::get_parameter_ranges(const std::string& strategy_name) {
+    const StrategyInfo* info = StrategyRegistry::instance().find(strategy_name);
+    if (!info) {
+        LOG_ERROR("Unknown strategy name: " + strategy_name);
+        return {};
+    }
+    
+    std::vector<ParameterRange> ranges;
+    for (const auto& spec : info->parameters) {
+        ranges.emplace_back(spec.name, spec.min_value, spec.max_value, spec.step);
+    }
+    
+    // Risk parameters searched alongside every strategy
+    ranges.emplace_back("stop_loss_pct", 0.01, 0.20, 0.005);
+    ranges.emplace_back("take_profit_pct", 0.02, 0.40, 0.005);
+    ranges.emplace_back("max_position_size", 0.01, 0.10, 0.005);
+    
+    return ranges;
+}
+
+std::string TradingBot::available_strategies() const {
+    std::string names;
+    for (const auto& name : StrategyRegistry::instance().get_names()) {
+        names += (names.empty() ? "" : ", ") + name;
+    }
+    return names;
+}
+
 bool TradingBot::load_configuration(const std::string& config_file) {
-    try {
-        std::ifstream file(config_file);
-        if (!file.is_open()) {
-            LOG_WARNING("Config file not found, using default configuration: " + config_file);
-            return true; // Use defaults
-        }
-        
-        // Read entire config file
-        std::string config_content((std::istreambuf_iterator<char>(file)),
-                                   std::istreambuf_iterator<char>());
-        file.close();
-        
-        // Simple JSON-like parsing (basic implementation)
-        config_data_ = parse_simple_json(config_content);
-        
-        LOG_INFO("Configuration loaded from: " + config_file);
-        return true;
-        
-    } catch (const std::exception& e) {
-        LOG_ERROR("Failed to load configuration: " + std::string(e.what()));
+    std::string error;
+    if (!config_.load(config_file, error)) {
+        LOG_WARNING("Failed to load configuration: " + error);
         return false;
     }
+    
+    LOG_INFO("Configuration loaded from: " + config_file);
+    return true;
 }
 
-RiskParameters TradingBot::load_risk_parameters() {
-    RiskParameters params; // Start with defaults
-    
-    // For now, just use default values
-    // TODO: Add proper JSON config parsing later
+bool TradingBot::reload_configuration() {
+    std::string error;
+    switch (config_.reload(error)) {
+        case ConfigLoader::ReloadResult::UNCHANGED:
+            return true;
+        case ConfigLoader::ReloadResult::FAILED:
+            LOG_ERROR("Configuration not reloaded: " + error);
+            return false;
+        case ConfigLoader::ReloadResult::RELOADED:
+            break;
+    }
     
-    LOG_INFO("Loaded risk parameters with default values");
-    return params;
+    if (risk_manager_ && !risk_manager_->initialize(load_risk_parameters())) {
+        LOG_ERROR("Reloaded risk parameters rejected by the Risk Manager");
+        return false;
+    }
+    if (risk_manager_) {
+        risk_manager_->set_session_calendar(load_session_calendar());
+    }
+    if (backtester_ && !backtester_->initialize(load_backtest_config())) {
+        LOG_ERROR("Reloaded backtest config rejected by the Backtester");
+        return false;
+    }
+    LOG_INFO("Configuration reloaded from: " + config_.get_filename());
+    return true;
 }
 
-BacktestConfig TradingBot::load_backtest_config() {
-    BacktestConfig config; // Start with defaults
-    
-    // For now, just use default values
-    // TODO: Add proper JSON config parsing later
-    
-    LOG_INFO("Loaded backtest config with default values");
-    return config;
+RiskParameters TradingBot::load_risk_parameters() {
+    return config_.get().risk;
 }
 
-std::map<std::string, std::map<std::string, std::string>> TradingBot::parse_simple_json(const std::string& json_content) {
-    std::map<std::string, std::map<std::string, std::string>> result;
-    
-    // Simple JSON parser for basic key-value pairs
-    // This is a basic implementation - for production we shoulduse a proper JSON library
-    
-    std::string current_section;
-    std::istringstream iss(json_content);
-    std::string line;
-    
-    while (std::getline(iss, line)) {
-        // Remove whitespace
-        line.erase(0, line.find_first_not_of(" \t"));
-        line.erase(line.find_last_not_of(" \t") + 1);
-        
-        // Skip comments and empty lines
-        if (line.empty() || line[0] == '/' || line[0] == '{' || line[0] == '}') {
-            continue;
-        }
-        
-        // Check for section header (e.g., "risk_management": {)
-        if (line.find("\":") != std::string::npos && line.find("{") != std::string::npos) {
-            size_t start = line.find("\"") + 1;
-            size_t end = line.find("\"", start);
-            current_section = line.substr(start, end - start);
-            continue;
-        }
-        
-        // Parse key-value pairs
-        if (line.find(":") != std::string::npos && !current_section.empty()) {
-            size_t colon = line.find(":");
-            std::string key = line.substr(0, colon);
-            std::string value = line.substr(colon + 1);
-            
-            
-            key.erase(0, key.find_first_not_of(" \t\""));
-            key.erase(key.find_last_not_of(" \t\",") + 1);
-            value.erase(0, value.find_first_not_of(" \t\""));
-            value.erase(value.find_last_not_of(" \t\",") + 1);
-            
-            result[current_section][key] = value;
-        }
+SessionCalendar TradingBot::load_session_calendar() {
+    const BotConfig& config = config_.get();
+    SessionCalendar calendar(config.session);
+    for (const auto& date : config.holidays) {
+        calendar.add_holiday(date);
     }
     
-    return result;
+    // Table over the configured backtest range; RiskManager extends it if
+    // bars run past either end
+    int64_t first = 0, last = 0;
+    if (TimeUtils::parse_timestamp(config.backtesting.start_date, first) &&
+        TimeUtils::parse_timestamp(config.backtesting.end_date, last)) {
+        calendar.build(first, last);
+    }
+    return calendar;
+}
+
+BacktestConfig TradingBot::load_backtest_config() {
+    return config_.get().backtesting;
 }
 
 } // namespace TradingBot
@@ -0,0 +1,416 @@
+#include "utils/json.h"
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+
+namespace TradingBot {
+
+namespace {
+
+// Deeper documents are rejected rather than risking the stack
+const int MAX_DEPTH = 256;
+
+void append_utf8(std::string& out, uint32_t code_point) {
+    if (code_point < 0x80) {
+        out += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        out += static_cast<char>(0xC0 | (code_point >> 6));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        out += static_cast<char>(0xE0 | (code_point >> 12));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (code_point >> 18));
+        out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+} // namespace
+
+// Single-pass recursive descent over the text; stops at the first error
+class JsonParser {
+public:
+    explicit JsonParser(std::string_view text) : text_(text), pos_(0), line_(1), line_start_(0) {}
+
+    bool parse(JsonValue& value, std::string& error) {
+        skip_whitespace();
+        if (!parse_value(value, 0)) {
+            error = error_;
+            return false;
+        }
+        skip_whitespace();
+        if (pos_ != text_.size()) {
+            fail("unexpected text after the document");
+            error = error_;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    std::string_view text_;
+    size_t pos_;
+    size_t line_;
+    size_t line_start_;
+    std::string error_;
+
+    bool fail(const std::string& reason) {
+        error_ = "line " + std::to_string(line_) + ", column " + std::to_string(pos_ - line_start_ + 1) + ": " +
+                 reason;
+        return false;
+    }
+
+    bool at_end() const {
+        return pos_ >= text_.size();
+    }
+
+    void skip_whitespace() {
+        while (pos_ < text_.size()) {
+            char c = text_[pos_];
+            if (c == '\n') {
+                ++line_;
+                line_start_ = pos_ + 1;
+            } else if (c != ' ' && c != '\t' && c != '\r') {
+                return;
+            }
+            ++pos_;
+        }
+    }
+
+    bool consume_literal(std::string_view literal) {
+        if (text_.substr(pos_, literal.size()) != literal) {
+            return fail("invalid literal");
+        }
+        pos_ += literal.size();
+        return true;
+    }
+
+    bool parse_value(JsonValue& value, int depth) {
+        if (at_end()) {
+            return fail("unexpected end of input");
+        }
+        value.line_ = line_;
+        switch (text_[pos_]) {
+            case '{':
+                return parse_object(value, depth);
+            case '[':
+                return parse_array(value, depth);
+            case '"':
+                value.type_ = JsonValue::Type::STRING;
+                return parse_string(value.string_);
+            case 't':
+                value.type_ = JsonValue::Type::BOOLEAN;
+                value.bool_ = true;
+                return consume_literal("true");
+            case 'f':
+                value.type_ = JsonValue::Type::BOOLEAN;
+                value.bool_ = false;
+                return consume_literal("false");
+            case 'n':
+                value.type_ = JsonValue::Type::NUL;
+                return consume_literal("null");
+            default:
+                value.type_ = JsonValue::Type::NUMBER;
+                return parse_number(value.number_);
+        }
+    }
+
+    bool parse_object(JsonValue& value, int depth) {
+        if (depth >= MAX_DEPTH) {
+            return fail("nesting too deep");
+        }
+        value.type_ = JsonValue::Type::OBJECT;
+        ++pos_;
+        skip_whitespace();
+        if (!at_end() && text_[pos_] == '}') {
+            ++pos_;
+            return true;
+        }
+        while (true) {
+            if (at_end() || text_[pos_] != '"') {
+                return fail("expected a member name");
+            }
+            value.members_.emplace_back();
+            JsonValue::Member& member = value.members_.back();
+            if (!parse_string(member.first)) {
+                return false;
+            }
+            skip_whitespace();
+            if (at_end() || text_[pos_] != ':') {
+                return fail("expected ':' after member name");
+            }
+            ++pos_;
+            skip_whitespace();
+            if (!parse_value(member.second, depth + 1)) {
+                return false;
+            }
+            skip_whitespace();
+            if (!at_end() && text_[pos_] == ',') {
+                ++pos_;
+                skip_whitespace();
+            } else if (!at_end() && text_[pos_] == '}') {
+                ++pos_;
+                return true;
+            } else {
+                return fail("expected ',' or '}'");
+            }
+        }
+    }
+
+    bool parse_array(JsonValue& value, int depth) {
+        if (depth >= MAX_DEPTH) {
+            return fail("nesting too deep");
+        }
+        value.type_ = JsonValue::Type::ARRAY;
+        ++pos_;
+        skip_whitespace();
+        if (!at_end() && text_[pos_] == ']') {
+            ++pos_;
+            return true;
+        }
+        while (true) {
+            value.items_.emplace_back();
+            if (!parse_value(value.items_.back(), depth + 1)) {
+                return false;
+            }
+            skip_whitespace();
+            if (!at_end() && text_[pos_] == ',') {
+                ++pos_;
+                skip_whitespace();
+            } else if (!at_end() && text_[pos_] == ']') {
+                ++pos_;
+                return true;
+            } else {
+                return fail("expected ',' or ']'");
+            }
+        }
+    }
+
+    bool parse_hex4(uint32_t& code) {
+        if (pos_ + 4 > text_.size()) {
+            return fail("truncated \\u escape");
+        }
+        code = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            int digit = hex_value(text_[pos_ + i]);
+            if (digit < 0) {
+                return fail("invalid \\u escape");
+            }
+            code = code << 4 | static_cast<uint32_t>(digit);
+        }
+        pos_ += 4;
+        return true;
+    }
+
+    bool parse_string(std::string& out) {
+        ++pos_;
+        // Copy unescaped runs in one go
+        size_t run = pos_;
+        while (true) {
+            if (at_end()) {
+                return fail("unterminated string");
+            }
+            char c = text_[pos_];
+            if (c == '"') {
+                out.append(text_.data() + run, pos_ - run);
+                ++pos_;
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) {
+                return fail("control character in string");
+            }
+            if (c != '\\') {
+                ++pos_;
+                continue;
+            }
+
+            out.append(text_.data() + run, pos_ - run);
+            ++pos_;
+            if (at_end()) {
+                return fail("unterminated string");
+            }
+            char escape = text_[pos_++];
+            switch (escape) {
+                case '"': out += '"'; break;
+                case '\\': out += '\\'; break;
+                case '/': out += '/'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    uint32_t code = 0;
+                    if (!parse_hex4(code)) {
+                        return false;
+                    }
+                    if (code >= 0xD800 && code < 0xDC00) {
+                        uint32_t low = 0;
+                        if (text_.substr(pos_, 2) != "\\u") {
+                            return fail("unpaired surrogate");
+                        }
+                        pos_ += 2;
+                        if (!parse_hex4(low)) {
+                            return false;
+                        }
+                        if (low < 0xDC00 || low >= 0xE000) {
+                            return fail("unpaired surrogate");
+                        }
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    } else if (code >= 0xDC00 && code < 0xE000) {
+                        return fail("unpaired surrogate");
+                    }
+                    append_utf8(out, code);
+                    break;
+                }
+                default:
+                    --pos_;
+                    return fail("invalid escape");
+            }
+            run = pos_;
+        }
+    }
+
+    bool parse_number(double& number) {
+        // Check the JSON grammar (no leading '+', zeros, bare '.'), then let
+        // from_chars convert: locale-independent and correctly rounded
+        size_t start = pos_;
+        size_t p = pos_;
+        auto digits = [&]() {
+            size_t first = p;
+            while (p < text_.size() && text_[p] >= '0' && text_[p] <= '9') {
+                ++p;
+            }
+            return p - first;
+        };
+        if (p < text_.size() && text_[p] == '-') {
+            ++p;
+        }
+        size_t integer_start = p;
+        size_t integer_digits = digits();
+        if (integer_digits == 0) {
+            return fail("expected a value");
+        }
+        if (integer_digits > 1 && text_[integer_start] == '0') {
+            return fail("leading zero in number");
+        }
+        if (p < text_.size() && text_[p] == '.') {
+            ++p;
+            if (digits() == 0) {
+                pos_ = p;
+                return fail("expected digits after '.'");
+            }
+        }
+        if (p < text_.size() && (text_[p] == 'e' || text_[p] == 'E')) {
+            ++p;
+            if (p < text_.size() && (text_[p] == '+' || text_[p] == '-')) {
+                ++p;
+            }
+            if (digits() == 0) {
+                pos_ = p;
+                return fail("expected digits in exponent");
+            }
+        }
+
+        auto result = std::from_chars(text_.data() + start, text_.data() + p, number);
+        if (result.ec != std::errc() || !std::isfinite(number)) {
+            return fail("number out of range");
+        }
+        pos_ = p;
+        return true;
+    }
+};
+
+JsonValue::JsonValue() : type_(Type::NUL), line_(0), bool_(false), number_(0.0) {
+}
+
+JsonValue::Type JsonValue::type() const {
+    return type_;
+}
+
+size_t JsonValue::line() const {
+    return line_;
+}
+
+bool JsonValue::is_null() const {
+    return type_ == Type::NUL;
+}
+
+bool JsonValue::is_bool() const {
+    return type_ == Type::BOOLEAN;
+}
+
+bool JsonValue::is_number() const {
+    return type_ == Type::NUMBER;
+}
+
+bool JsonValue::is_string() const {
+    return type_ == Type::STRING;
+}
+
+bool JsonValue::is_array() const {
+    return type_ == Type::ARRAY;
+}
+
+bool JsonValue::is_object() const {
+    return type_ == Type::OBJECT;
+}
+
+bool JsonValue::as_bool() const {
+    return bool_;
+}
+
+double JsonValue::as_number() const {
+    return number_;
+}
+
+const std::string& JsonValue::as_string() const {
+    return string_;
+}
+
+const std::vector<JsonValue>& JsonValue::items() const {
+    return items_;
+}
+
+const std::vector<JsonValue::Member>& JsonValue::members() const {
+    return members_;
+}
+
+const JsonValue* JsonValue::find(std::string_view key) const {
+    for (const Member& member : members_) {
+        if (member.first == key) {
+            return &member.second;
+        }
+    }
+    return nullptr;
+}
+
+const char* JsonValue::type_name(Type type) {
+    switch (type) {
+        case Type::NUL: return "null";
+        case Type::BOOLEAN: return "boolean";
+        case Type::NUMBER: return "number";
+        case Type::STRING: return "string";
+        case Type::ARRAY: return "array";
+        case Type::OBJECT: return "object";
+    }
+    return "value";
+}
+
+bool parse_json(std::string_view text, JsonValue& value, std::string& error) {
+    value = JsonValue();
+    JsonParser parser(text);
+    return parser.parse(value, error);
+}
+
+} // namespace TradingBot
@@ -0,0 +1,117 @@
+#include "utils/latency_histogram.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace TradingBot {
+
+LatencyHistogram::LatencyHistogram() {
+    // One group of sub-buckets for values below kSubBuckets, then one per remaining bit
+    buckets_.assign((64 - kSubBucketBits + 1) * kSubBuckets, 0);
+    reset();
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds) {
+    ++buckets_[bucket_index(nanoseconds)];
+    ++count_;
+    min_ = std::min(min_, nanoseconds);
+    max_ = std::max(max_, nanoseconds);
+    sum_ += static_cast<double>(nanoseconds);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(buckets_.begin(), buckets_.end(), 0);
+    count_ = 0;
+    min_ = std::numeric_limits<uint64_t>::max();
+    max_ = 0;
+    sum_ = 0.0;
+}
+
+uint64_t LatencyHistogram::count() const {
+    return count_;
+}
+
+uint64_t LatencyHistogram::min() const {
+    return count_ > 0 ? min_ : 0;
+}
+
+uint64_t LatencyHistogram::max() const {
+    return max_;
+}
+
+double LatencyHistogram::mean() const {
+    return count_ > 0 ? sum_ / static_cast<double>(count_) : 0.0;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    if (count_ == 0) {
+        return 0;
+    }
+
+    p = std::max(0.0, std::min(100.0, p));
+    uint64_t rank = static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(count_)));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            // Never report beyond what was actually observed
+            return std::min(bucket_upper_bound(i), max_);
+        }
+    }
+    return max_;
+}
+
+std::string LatencyHistogram::summary() const {
+    std::ostringstream out;
+    out.precision(2);
+    out << std::fixed
+        << "n=" << count_
+        << " mean=" << mean() / 1000.0 << "us"
+        << " p50=" << percentile(50.0) / 1000.0 << "us"
+        << " p90=" << percentile(90.0) / 1000.0 << "us"
+        << " p99=" << percentile(99.0) / 1000.0 << "us"
+        << " p99.9=" << percentile(99.9) / 1000.0 << "us"
+        << " max=" << max() / 1000.0 << "us";
+    return out.str();
+}
+
+// Private helper methods
+
+size_t LatencyHistogram::bucket_index(uint64_t value) {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+
+    // Group by highest set bit, then by the next kSubBucketBits bits below it
+    int msb = 63 - __builtin_clzll(value);
+    int shift = msb - kSubBucketBits;
+    size_t group = static_cast<size_t>(shift + 1);
+    return group * kSubBuckets + static_cast<size_t>((value >> shift) & (kSubBuckets - 1));
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(size_t index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+
+    size_t group = index / kSubBuckets;
+    uint64_t sub = index % kSubBuckets;
+    int shift = static_cast<int>(group) - 1;
+    uint64_t lower = (kSubBuckets + sub) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+} // namespace TradingBot
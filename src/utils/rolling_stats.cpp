@@ -0,0 +1,110 @@
+#include "utils/rolling_stats.h"
+#include <algorithm>
+#include <cmath>
+
+namespace TradingBot {
+
+RollingStats::RollingStats(int window) {
+    reset(window);
+}
+
+void RollingStats::reset(int window) {
+    window_ = std::max(window, 1);
+    values_.assign(window_, 0.0);
+    reset();
+}
+
+void RollingStats::reset() {
+    count_ = 0;
+    next_ = 0;
+    sum_ = 0.0;
+    m2_ = 0.0;
+}
+
+void RollingStats::push(double value) {
+    if (count_ < values_.size()) {
+        // Filling the window: plain Welford
+        double old_mean = count_ > 0 ? sum_ / count_ : 0.0;
+        ++count_;
+        sum_ += value;
+        m2_ += (value - old_mean) * (value - sum_ / count_);
+    } else {
+        // Full window: swap the oldest value for this one
+        double n = static_cast<double>(values_.size());
+        double old_value = values_[next_];
+        double old_mean = sum_ / n;
+        sum_ += value - old_value;
+        m2_ += (value - old_value) * (value - sum_ / n + old_value - old_mean);
+    }
+    values_[next_] = value;
+
+    // Once per lap, resum the window so rounding cannot build up
+    if (++next_ == values_.size()) {
+        next_ = 0;
+        resum();
+    }
+}
+
+void RollingStats::resum() {
+    double sum = 0.0;
+    for (size_t i = 0; i < count_; ++i) {
+        sum += values_[i];
+    }
+    double mean = sum / count_;
+    double m2 = 0.0;
+    for (size_t i = 0; i < count_; ++i) {
+        m2 += (values_[i] - mean) * (values_[i] - mean);
+    }
+    sum_ = sum;
+    m2_ = m2;
+}
+
+bool RollingStats::is_ready() const {
+    return count_ == values_.size();
+}
+
+size_t RollingStats::get_count() const {
+    return count_;
+}
+
+int RollingStats::get_window() const {
+    return window_;
+}
+
+double RollingStats::get_mean() const {
+    return count_ > 0 ? sum_ / count_ : 0.0;
+}
+
+double RollingStats::get_sum() const {
+    return sum_;
+}
+
+double RollingStats::get_variance() const {
+    return count_ > 1 ? std::max(m2_, 0.0) / (count_ - 1) : 0.0;
+}
+
+double RollingStats::get_stdev() const {
+    return std::sqrt(get_variance());
+}
+
+double RollingStats::get_population_variance() const {
+    return count_ > 1 ? std::max(m2_, 0.0) / count_ : 0.0;
+}
+
+double RollingStats::get_population_stdev() const {
+    return std::sqrt(get_population_variance());
+}
+
+double RollingStats::get_zscore(double value) const {
+    double stdev = get_population_stdev();
+    return stdev > 0.0 ? (value - get_mean()) / stdev : 0.0;
+}
+
+double RollingStats::get_last() const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    return values_[next_ == 0 ? values_.size() - 1 : next_ - 1];
+}
+
+} // namespace TradingBot
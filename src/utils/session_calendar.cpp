@@ -0,0 +1,133 @@
+#include "utils/session_calendar.h"
+#include "utils/time_utils.h"
+#include <algorithm>
+
+namespace TradingBot {
+
+namespace {
+
+const int64_t kSecondsPerDay = 86400;
+
+int64_t floor_div(int64_t value, int64_t divisor) {
+    int64_t quotient = value / divisor;
+    return quotient * divisor > value ? quotient - 1 : quotient;
+}
+
+} // namespace
+
+SessionCalendar::SessionCalendar() : table_first_(0) {
+}
+
+SessionCalendar::SessionCalendar(const SessionHours& hours) : hours_(hours), table_first_(0) {
+}
+
+const SessionHours& SessionCalendar::get_hours() const {
+    return hours_;
+}
+
+bool SessionCalendar::add_holiday(const std::string& date) {
+    int64_t epoch;
+    if (!TimeUtils::parse_timestamp(date, epoch)) {
+        return false;
+    }
+    int64_t day = floor_div(epoch, kSecondsPerDay);
+    auto position = std::lower_bound(holidays_.begin(), holidays_.end(), day);
+    if (position == holidays_.end() || *position != day) {
+        holidays_.insert(position, day);
+    }
+    table_.clear();
+    return true;
+}
+
+void SessionCalendar::build(int64_t first_epoch, int64_t last_epoch) {
+    table_first_ = trading_day(first_epoch);
+    int64_t last = trading_day(last_epoch);
+    table_.clear();
+    if (last < table_first_) {
+        return;
+    }
+
+    // One count up front, then a running index
+    int64_t index = session_index(table_first_);
+    table_.reserve(static_cast<size_t>(last - table_first_ + 1));
+    for (int64_t day = table_first_; day <= last; ++day) {
+        bool open = compute_is_trading_day(day);
+        table_.push_back(static_cast<int32_t>(index << 1 | (open ? 1 : 0)));
+        index += open;
+    }
+}
+
+bool SessionCalendar::covers(int64_t day) const {
+    return day >= table_first_ && day - table_first_ < static_cast<int64_t>(table_.size());
+}
+
+int64_t SessionCalendar::trading_day(int64_t epoch_seconds) const {
+    return floor_div(epoch_seconds + local_offset(), kSecondsPerDay);
+}
+
+void SessionCalendar::day_bounds(int64_t epoch_seconds, int64_t& begin, int64_t& end) const {
+    begin = trading_day(epoch_seconds) * kSecondsPerDay - local_offset();
+    end = begin + kSecondsPerDay;
+}
+
+bool SessionCalendar::is_trading_day(int64_t day) const {
+    int64_t slot = day - table_first_;
+    if (slot >= 0 && slot < static_cast<int64_t>(table_.size())) {
+        return (table_[slot] & 1) != 0;
+    }
+    return compute_is_trading_day(day);
+}
+
+bool SessionCalendar::is_open(int64_t epoch_seconds) const {
+    if (!is_trading_day(trading_day(epoch_seconds))) {
+        return false;
+    }
+    int64_t local = epoch_seconds + hours_.utc_offset_minutes * 60;
+    int64_t minute = (local - floor_div(local, kSecondsPerDay) * kSecondsPerDay) / 60;
+    if (hours_.open_minutes <= hours_.close_minutes) {
+        return minute >= hours_.open_minutes && minute < hours_.close_minutes;
+    }
+    return minute >= hours_.open_minutes || minute < hours_.close_minutes;
+}
+
+int64_t SessionCalendar::session_index(int64_t day) const {
+    int64_t slot = day - table_first_;
+    if (slot >= 0 && slot < static_cast<int64_t>(table_.size())) {
+        return table_[slot] >> 1;
+    }
+    return day >= 0 ? count_sessions(0, day) : -count_sessions(day, 0);
+}
+
+bool SessionCalendar::compute_is_trading_day(int64_t day) const {
+    if (hours_.weekends_closed && TimeUtils::weekday_from_days(day) >= 5) {
+        return false;
+    }
+    return !std::binary_search(holidays_.begin(), holidays_.end(), day);
+}
+
+int64_t SessionCalendar::count_sessions(int64_t from, int64_t to) const {
+    int64_t days = to - from;
+    int64_t count = days;
+    if (hours_.weekends_closed) {
+        // Whole weeks have five sessions; walk the remainder
+        count = days / 7 * 5;
+        for (int64_t day = from + days / 7 * 7; day < to; ++day) {
+            count += TimeUtils::weekday_from_days(day) < 5;
+        }
+    }
+
+    auto first = std::lower_bound(holidays_.begin(), holidays_.end(), from);
+    auto last = std::lower_bound(holidays_.begin(), holidays_.end(), to);
+    for (auto it = first; it != last; ++it) {
+        count -= !hours_.weekends_closed || TimeUtils::weekday_from_days(*it) < 5;
+    }
+    return count;
+}
+
+int64_t SessionCalendar::local_offset() const {
+    // Sessions spanning midnight start their trading day at the open
+    int64_t shift = hours_.open_minutes > hours_.close_minutes ? (24 * 60 - hours_.open_minutes) * 60 : 0;
+    return hours_.utc_offset_minutes * 60 + shift;
+}
+
+} // namespace TradingBot
@@ -0,0 +1,126 @@
+#include "utils/thread_utils.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace TradingBot {
+
+bool pin_current_thread(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+int available_cpu_count() {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        int count = CPU_COUNT(&set);
+        if (count > 0) {
+            return count;
+        }
+    }
+#endif
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+namespace {
+
+// Parse a sysfs CPU list such as "0-3,8-11"
+std::vector<int> parse_cpu_list(const std::string& text) {
+    std::vector<int> cpus;
+    std::istringstream ranges(text);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        int first = 0, last = 0;
+        char dash = 0;
+        std::istringstream parts(range);
+        if (!(parts >> first)) {
+            continue;
+        }
+        last = (parts >> dash >> last) && dash == '-' ? last : first;
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+} // namespace
+
+std::vector<std::vector<int>> numa_cpu_nodes() {
+    std::vector<int> available;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                available.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (available.empty()) {
+        for (int cpu = 0; cpu < available_cpu_count(); ++cpu) {
+            available.push_back(cpu);
+        }
+    }
+
+    std::vector<std::vector<int>> nodes;
+#ifdef __linux__
+    // Node directories may be sparse (node0, node2, ...); stop after a run of gaps
+    for (int node = 0, misses = 0; misses < 8; ++node) {
+        std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string text;
+        if (!cpulist.is_open() || !std::getline(cpulist, text)) {
+            ++misses;
+            continue;
+        }
+        misses = 0;
+
+        std::vector<int> cpus;
+        for (int cpu : parse_cpu_list(text)) {
+            if (std::find(available.begin(), available.end(), cpu) != available.end()) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty()) {
+            nodes.push_back(cpus);
+        }
+    }
+#endif
+    if (nodes.empty()) {
+        nodes.push_back(available);
+    }
+    return nodes;
+}
+
+void set_current_thread_name(const std::string& name) {
+#ifdef __linux__
+    // Linux limits thread names to 15 characters
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#else
+    (void)name;
+#endif
+}
+
+} // namespace TradingBot
@@ -0,0 +1,195 @@
+#include "utils/time_utils.h"
+#include <charconv>
+
+namespace TradingBot {
+namespace TimeUtils {
+
+namespace {
+
+const int64_t kSecondsPerDay = 86400;
+
+// Value of 'count' digits at text[pos]; 'bad' picks up any non-digit
+// without a branch per character
+inline int digits(const char* text, size_t count, unsigned& bad) {
+    int value = 0;
+    for (size_t i = 0; i < count; ++i) {
+        unsigned digit = static_cast<unsigned>(text[i]) - '0';
+        bad |= digit > 9 ? 1u : 0u;
+        value = value * 10 + static_cast<int>(digit);
+    }
+    return value;
+}
+
+inline bool is_digit(char c) {
+    return static_cast<unsigned>(c) - '0' <= 9;
+}
+
+bool is_leap(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+unsigned days_in_month(int year, unsigned month) {
+    static const unsigned kDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && is_leap(year) ? 29 : kDays[month - 1];
+}
+
+inline void put_digits(char* out, unsigned value, size_t count) {
+    for (size_t i = count; i-- > 0;) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+// Shared by both precisions: whole seconds plus the fraction in nanoseconds
+bool parse(std::string_view text, int64_t& seconds, int64_t& nanoseconds) {
+    const char* p = text.data();
+    size_t size = text.size();
+    nanoseconds = 0;
+
+    // Bare integer epoch (an ISO date always has '-' at offset 4)
+    if (size < 10 || p[4] != '-') {
+        size_t start = size > 0 && p[0] == '-' ? 1 : 0;
+        if (start == size) {
+            return false;
+        }
+        for (size_t i = start; i < size; ++i) {
+            if (!is_digit(p[i])) {
+                return false;
+            }
+        }
+        auto result = std::from_chars(p, p + size, seconds);
+        return result.ec == std::errc() && result.ptr == p + size;
+    }
+
+    unsigned bad = 0;
+    int year = digits(p, 4, bad);
+    int month = digits(p + 5, 2, bad);
+    int day = digits(p + 8, 2, bad);
+    if (bad || p[7] != '-' || month < 1 || month > 12 || day < 1 ||
+        day > static_cast<int>(days_in_month(year, month))) {
+        return false;
+    }
+
+    int hour = 0, minute = 0, second = 0;
+    if (size > 10) {
+        if ((p[10] != ' ' && p[10] != 'T') || size < 16 || p[13] != ':') {
+            return false;
+        }
+        hour = digits(p + 11, 2, bad);
+        minute = digits(p + 14, 2, bad);
+
+        size_t pos = 16;
+        if (pos < size && p[pos] == ':') {
+            if (pos + 3 > size) {
+                return false;
+            }
+            second = digits(p + pos + 1, 2, bad);
+            pos += 3;
+        }
+
+        if (pos < size && p[pos] == '.') {
+            int64_t scale = 100000000;
+            for (++pos; pos < size && is_digit(p[pos]); ++pos) {
+                nanoseconds += (p[pos] - '0') * scale;
+                scale /= 10;
+            }
+        }
+        if (pos < size && p[pos] == 'Z') {
+            ++pos;
+        }
+        if (bad || pos != size || hour > 23 || minute > 59 || second > 60) {
+            return false;
+        }
+    }
+
+    seconds = days_from_civil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) * kSecondsPerDay +
+              hour * 3600 + minute * 60 + second;
+    return true;
+}
+
+} // namespace
+
+// Howard Hinnant's days_from_civil / civil_from_days algorithms
+int64_t days_from_civil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(year - era * 400);
+    const unsigned doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+void civil_from_days(int64_t days, int& year, unsigned& month, unsigned& day) {
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    day = doy - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = static_cast<int>(yoe + era * 400) + (month <= 2);
+}
+
+int weekday_from_days(int64_t days) {
+    // 1970-01-01 was a Thursday
+    int64_t weekday = (days + 3) % 7;
+    return static_cast<int>(weekday < 0 ? weekday + 7 : weekday);
+}
+
+bool parse_timestamp(std::string_view text, int64_t& epoch_seconds) {
+    int64_t nanoseconds;
+    return parse(text, epoch_seconds, nanoseconds);
+}
+
+bool parse_timestamp_ns(std::string_view text, int64_t& epoch_nanoseconds) {
+    int64_t seconds, nanoseconds;
+    if (!parse(text, seconds, nanoseconds)) {
+        return false;
+    }
+    epoch_nanoseconds = seconds * 1000000000 + nanoseconds;
+    return true;
+}
+
+size_t format_date(int64_t epoch_seconds, char* out) {
+    int64_t days = epoch_seconds / kSecondsPerDay - (epoch_seconds % kSecondsPerDay < 0 ? 1 : 0);
+    int year;
+    unsigned month, day;
+    civil_from_days(days, year, month, day);
+
+    put_digits(out, static_cast<unsigned>(year), 4);
+    out[4] = '-';
+    put_digits(out + 5, month, 2);
+    out[7] = '-';
+    put_digits(out + 8, day, 2);
+    return 10;
+}
+
+size_t format_timestamp(int64_t epoch_seconds, char* out) {
+    format_date(epoch_seconds, out);
+    int64_t seconds = epoch_seconds % kSecondsPerDay;
+    if (seconds < 0) {
+        seconds += kSecondsPerDay;
+    }
+
+    out[10] = ' ';
+    put_digits(out + 11, static_cast<unsigned>(seconds / 3600), 2);
+    out[13] = ':';
+    put_digits(out + 14, static_cast<unsigned>(seconds / 60 % 60), 2);
+    out[16] = ':';
+    put_digits(out + 17, static_cast<unsigned>(seconds % 60), 2);
+    return 19;
+}
+
+std::string format_timestamp(int64_t epoch_seconds) {
+    char buffer[19];
+    return std::string(buffer, format_timestamp(epoch_seconds, buffer));
+}
+
+std::string format_date(int64_t epoch_seconds) {
+    char buffer[10];
+    return std::string(buffer, format_date(epoch_seconds, buffer));
+}
+
+} // namespace TimeUtils
+} // namespace TradingBot
@@ -0,0 +1,300 @@
+#include "utils/work_stealing_pool.h"
+#include "utils/thread_utils.h"
+#include <chrono>
+#include <string>
+
+namespace TradingBot {
+
+namespace {
+
+// Worker the current thread belongs to, so nested submits stay local
+thread_local const WorkStealingPool* current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+std::mutex shared_mutex;
+std::unique_ptr<WorkStealingPool> shared_pool;
+SchedulerOptions shared_options;
+
+} // namespace
+
+WorkStealingPool::WorkStealingPool(size_t num_threads)
+    : queued_(0), pending_(0), next_worker_(0), steals_(0), pinned_(0), node_count_(1), stop_(false) {
+    SchedulerOptions options;
+    options.num_threads = num_threads;
+    start(options);
+}
+
+WorkStealingPool::WorkStealingPool(const SchedulerOptions& options)
+    : queued_(0), pending_(0), next_worker_(0), steals_(0), pinned_(0), node_count_(1), stop_(false) {
+    start(options);
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::unique_lock<std::mutex> lock(idle_mutex_);
+        all_done_.wait(lock, [this] { return pending_.load() == 0; });
+        stop_ = true;
+    }
+    work_available_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+WorkStealingPool& WorkStealingPool::shared() {
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    if (!shared_pool) {
+        shared_pool.reset(new WorkStealingPool(shared_options));
+    }
+    return *shared_pool;
+}
+
+bool WorkStealingPool::configure_shared(const SchedulerOptions& options) {
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    if (shared_pool) {
+        return false;
+    }
+    shared_options = options;
+    return true;
+}
+
+void WorkStealingPool::start(const SchedulerOptions& options) {
+    size_t num_threads = options.num_threads > 0 ? options.num_threads :
+        static_cast<size_t>(available_cpu_count());
+
+    // Placement: with NUMA awareness workers are dealt across nodes so a
+    // small pool still uses every node; otherwise cores are filled in order
+    std::vector<std::vector<int>> nodes = numa_cpu_nodes();
+    if (!options.numa_aware || !options.pin_threads) {
+        std::vector<int> all;
+        for (const auto& node : nodes) {
+            all.insert(all.end(), node.begin(), node.end());
+        }
+        nodes.assign(1, all);
+    }
+    node_count_ = std::min(nodes.size(), num_threads);
+
+    std::vector<size_t> worker_node(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        size_t node = i % nodes.size();
+        size_t slot = (i / nodes.size()) % nodes[node].size();
+        workers_.emplace_back(new Worker());
+        workers_[i]->cpu = options.pin_threads ? nodes[node][slot] : -1;
+        worker_node[i] = node;
+    }
+
+    // Steal from workers on the same node before crossing to another
+    for (size_t i = 0; i < num_threads; ++i) {
+        for (int same_node = 1; same_node >= 0; --same_node) {
+            for (size_t offset = 1; offset < num_threads; ++offset) {
+                size_t victim = (i + offset) % num_threads;
+                if ((worker_node[victim] == worker_node[i]) == (same_node == 1)) {
+                    workers_[i]->victims.push_back(victim);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        threads_.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+void WorkStealingPool::submit(Task task) {
+    pending_.fetch_add(1);
+    size_t index = current_pool == this ? current_worker : next_worker_.fetch_add(1) % workers_.size();
+    push(index, std::move(task));
+}
+
+void WorkStealingPool::wait_idle() {
+    std::unique_lock<std::mutex> lock(idle_mutex_);
+    all_done_.wait(lock, [this] { return pending_.load() == 0; });
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+size_t WorkStealingPool::get_thread_count() const {
+    return threads_.size();
+}
+
+size_t WorkStealingPool::get_steals() const {
+    return steals_.load();
+}
+
+size_t WorkStealingPool::get_node_count() const {
+    return node_count_;
+}
+
+size_t WorkStealingPool::get_pinned_count() const {
+    return pinned_.load();
+}
+
+void WorkStealingPool::push(size_t index, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+        workers_[index]->tasks.push_back(std::move(task));
+    }
+    queued_.fetch_add(1);
+
+    // Taking the lock orders this against a worker checking queued_ before sleeping
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    work_available_.notify_one();
+}
+
+bool WorkStealingPool::try_pop(size_t index, Task& task) {
+    Worker& worker = *workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    queued_.fetch_sub(1);
+    return true;
+}
+
+bool WorkStealingPool::try_steal(const std::vector<size_t>& victims, Task& task) {
+    for (size_t index : victims) {
+        Worker& victim = *workers_[index];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued_.fetch_sub(1);
+            steals_.fetch_add(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::execute(Task& task) {
+    try {
+        task();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(idle_mutex_);
+        if (!error_) {
+            error_ = std::current_exception();
+        }
+    }
+    task = nullptr;
+
+    if (pending_.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(idle_mutex_);
+        all_done_.notify_all();
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t index) {
+    current_pool = this;
+    current_worker = index;
+    set_current_thread_name("tb-worker-" + std::to_string(index));
+    if (workers_[index]->cpu >= 0 && pin_current_thread(workers_[index]->cpu)) {
+        pinned_.fetch_add(1);
+    }
+
+    Task task;
+    for (;;) {
+        if (try_pop(index, task) || try_steal(workers_[index]->victims, task)) {
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(idle_mutex_);
+        work_available_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+        if (stop_ && queued_.load() == 0) {
+            return;
+        }
+    }
+}
+
+TaskGroup::TaskGroup(WorkStealingPool& pool) : pool_(pool), state_(std::make_shared<State>()) {
+}
+
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    } catch (...) {
+    }
+}
+
+void TaskGroup::run(WorkStealingPool::Task task) {
+    std::shared_ptr<State> state = state_;
+    state->pending.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->queue.push_back(std::move(task));
+    }
+    // The pool runs whichever of the group's tasks is oldest when a worker
+    // gets to this one; it finds the queue empty if the waiter got there first
+    pool_.submit([state]() { run_queued(*state, false); });
+}
+
+void TaskGroup::wait() {
+    while (state_->pending.load() > 0) {
+        if (run_queued(*state_, true)) {
+            continue;
+        }
+        // The rest are running elsewhere. Wake now and then in case they add
+        // tasks to this group that this thread could take.
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->done.wait_for(lock, std::chrono::milliseconds(1),
+                              [this] { return state_->pending.load() == 0; });
+    }
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->error) {
+        std::exception_ptr error = state_->error;
+        state_->error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+bool TaskGroup::run_queued(State& state, bool newest) {
+    WorkStealingPool::Task task;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.queue.empty()) {
+            return false;
+        }
+        if (newest) {
+            task = std::move(state.queue.back());
+            state.queue.pop_back();
+        } else {
+            task = std::move(state.queue.front());
+            state.queue.pop_front();
+        }
+    }
+
+    if (!state.cancelled.load()) {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!state.error) {
+                state.error = std::current_exception();
+            }
+            state.cancelled = true;
+        }
+    }
+    task = nullptr;
+
+    if (state.pending.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.done.notify_all();
+    }
+    return true;
+}
+
+void TaskGroup::cancel() {
+    state_->cancelled = true;
+}
+
+bool TaskGroup::is_cancelled() const {
+    return state_->cancelled.load();
+}
+
+} // namespace TradingBot
@@ -169,18 +169,15 @@ void test_multiple_symbols() {
     std::string end_date = "2024-10-07";
     std::string start_date = "2024-09-07";
     
-    std::cout << "Fetching recent data for multiple symbols..." << std::endl;
+    std::cout << "Fetching recent data for multiple symbols concurrently..." << std::endl;
     
-    for (const auto& symbol : symbols) {
+    std::vector<APIResponse> responses = fetcher.fetch_many(symbols, DataInterval::DAILY, start_date, end_date);
+    
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        const std::string& symbol = symbols[i];
+        const APIResponse& response = responses[i];
         std::cout << "\n" << symbol << ": ";
         
-        APIResponse response = fetcher.fetch_data(
-            symbol,
-            DataInterval::DAILY,
-            start_date,
-            end_date
-        );
-        
         if (response.success && !response.data.empty()) {
             const auto& latest = response.data.back();
             std::cout << "✓ " << response.data.size() << " days | "
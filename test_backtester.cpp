@@ -1,15 +1,125 @@
 #include <iostream>
 #include <memory>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
 #include "backtester/backtester.h"
 #include "strategy/strategy.h"
 #include "data/csv_parser.h"
 #include "risk/risk_manager.h"
+#include "utils/work_stealing_pool.h"
+#include "test_helpers.h"
 
 using namespace TradingBot;
 
+std::shared_ptr<Strategy> make_strategy(int which) {
+    std::shared_ptr<Strategy> strategy;
+    if (which == 1) {
+        strategy = std::make_shared<EMAStrategy>();
+    } else if (which == 2) {
+        strategy = std::make_shared<RSIStrategy>();
+    } else {
+        strategy = std::make_shared<SMACrossoverStrategy>();
+    }
+    std::map<std::string, double> params = {{"short_period", 5.0}, {"long_period", 20.0}, {"period", 14.0},
+                                            {"oversold_threshold", 30.0}, {"overbought_threshold", 70.0}};
+    strategy->initialize(params);
+    return strategy;
+}
+
+std::shared_ptr<CSVParser> load_wave_data() {
+    const std::string data_file = "test_backtester_wave.csv";
+    {
+        std::ofstream data(data_file);
+        data << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < 2000; ++i) {
+            double close = 100.0 + 10.0 * std::sin(i / 15.0) + 3.0 * std::sin(i / 4.0);
+            data << test_bar_time(i) << "," << close << "," << close + 1.0 << ","
+                 << close - 1.0 << "," << close << "," << 100000 << "\n";
+        }
+    }
+    auto csv_parser = std::make_shared<CSVParser>();
+    bool loaded = csv_parser->load_data(data_file);
+    std::remove(data_file.c_str());
+    return loaded ? csv_parser : nullptr;
+}
+
+// One pass over the data for several strategies must match separate runs
+bool test_multi_strategy_pass(const BacktestConfig& config) {
+    auto csv_parser = load_wave_data();
+    if (!csv_parser) {
+        return false;
+    }
+
+    BacktestConfig cheap_config = config;
+    cheap_config.commission_rate = 0.0;
+
+    std::vector<StrategyRun> runs;
+    for (int which = 0; which < 4; ++which) {
+        runs.emplace_back(make_strategy(which), std::make_shared<RiskManager>(),
+                          which == 3 ? cheap_config : config);
+    }
+    Backtester backtester;
+    backtester.initialize(config);
+    auto combined = backtester.run_backtests(runs, csv_parser);
+
+    for (int which = 0; which < 4; ++which) {
+        Backtester single;
+        single.initialize(which == 3 ? cheap_config : config);
+        auto alone = single.run_backtest(make_strategy(which), csv_parser, std::make_shared<RiskManager>());
+        std::cout << "  " << runs[which].strategy->get_name() << ": " << combined[which].total_trades
+                  << " trades, " << (combined[which].total_return * 100) << "%" << std::endl;
+        if (alone.total_trades == 0 || combined[which].total_trades != alone.total_trades ||
+            combined[which].total_return != alone.total_return ||
+            combined[which].equity_curve != alone.equity_curve) {
+            std::cout << "Multi-strategy run " << which << " differs from its single run" << std::endl;
+            return false;
+        }
+    }
+    std::cout << "Multi-strategy pass matches " << runs.size() << " separate runs" << std::endl;
+    return true;
+}
+
+// A strategy and risk manager reused across runs, or cloned, must give the
+// same results as fresh instances
+bool test_reuse_and_clone(const BacktestConfig& config) {
+    auto csv_parser = load_wave_data();
+    if (!csv_parser) {
+        return false;
+    }
+
+    Backtester backtester;
+    backtester.initialize(config);
+    for (int which = 0; which < 3; ++which) {
+        auto fresh = backtester.run_backtest(make_strategy(which), csv_parser, std::make_shared<RiskManager>());
+
+        auto strategy = make_strategy(which);
+        auto risk_manager = std::make_shared<RiskManager>();
+        backtester.run_backtest(strategy, csv_parser, risk_manager);
+        auto again = backtester.run_backtest(strategy, csv_parser, risk_manager);
+        std::shared_ptr<Strategy> copy = strategy->clone();
+        auto cloned = backtester.run_backtest(copy, csv_parser, risk_manager->clone());
+
+        for (const auto* results : {&again, &cloned}) {
+            if (fresh.total_trades == 0 || results->total_trades != fresh.total_trades ||
+                results->total_return != fresh.total_return || results->equity_curve != fresh.equity_curve) {
+                std::cout << strategy->get_name() << " differs when reused or cloned" << std::endl;
+                return false;
+            }
+        }
+    }
+    std::cout << "Reused and cloned strategies match fresh runs" << std::endl;
+    return true;
+}
+
 int main() {
     std::cout << "=== Backtester Test ===" << std::endl;
     
+    // Several workers even on a single core, so run_backtests splits its lanes
+    SchedulerOptions scheduler;
+    scheduler.num_threads = 3;
+    WorkStealingPool::configure_shared(scheduler);
+    
     Backtester backtester;
     
 
@@ -52,11 +162,35 @@ int main() {
             if (sma_strategy->initialize(strategy_params)) {
                 std::cout << "SMA strategy initialized (5/20 periods)" << std::endl;
                 
-                // This would run a full backtest (commented out for basic test)
-                // auto results = backtester.run_backtest(sma_strategy, csv_parser, risk_manager);
-                // std::cout << "Backtest completed with " << results.total_trades << " trades" << std::endl;
+                auto results = backtester.run_backtest(sma_strategy, csv_parser, risk_manager);
+                std::cout << "Backtest completed with " << results.total_trades << " trades" << std::endl;
+                std::cout << "  Total Return: " << (results.total_return * 100) << "%" << std::endl;
+                std::cout << "  Annualized Return: " << (results.annualized_return * 100) << "%" << std::endl;
+                std::cout << "  Sharpe Ratio: " << results.sharpe_ratio << std::endl;
+                std::cout << "  Max Drawdown: " << (results.max_drawdown * 100) << "%" << std::endl;
+                std::cout << "  Profit Factor: " << results.profit_factor << std::endl;
+                
+                // Statistics must not depend on storing the curve and trades
+                BacktestConfig lean_config = config;
+                lean_config.record_trades = false;
+                lean_config.record_equity_curve = false;
+                Backtester lean_backtester;
+                lean_backtester.initialize(lean_config);
                 
-                std::cout << "Backtester components ready for full testing" << std::endl;
+                auto lean_strategy = std::make_shared<SMACrossoverStrategy>();
+                lean_strategy->initialize(strategy_params);
+                auto lean_results = lean_backtester.run_backtest(lean_strategy, csv_parser,
+                                                                 std::make_shared<RiskManager>());
+                
+                if (!lean_results.trades.empty() || !lean_results.equity_curve.empty() ||
+                    lean_results.total_trades != results.total_trades ||
+                    lean_results.total_return != results.total_return ||
+                    lean_results.sharpe_ratio != results.sharpe_ratio ||
+                    lean_results.max_drawdown != results.max_drawdown) {
+                    std::cout << "Streaming statistics mismatch without stored history" << std::endl;
+                    return 1;
+                }
+                std::cout << "Streaming statistics match without stored history" << std::endl;
             } else {
                 std::cout << "Strategy initialization failed" << std::endl;
             }
@@ -70,6 +204,10 @@ int main() {
         std::cout << "Test completed with minor issues: " << e.what() << std::endl;
     }
     
+    if (!test_multi_strategy_pass(config) || !test_reuse_and_clone(config)) {
+        return 1;
+    }
+    
     std::cout << "Backtester test completed!" << std::endl;
     return 0;
 }
@@ -0,0 +1,210 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include "data/bar_resampler.h"
+#include "strategy/resampled_strategy.h"
+#include "backtester/backtester.h"
+#include "utils/time_utils.h"
+
+using namespace TradingBot;
+
+// One-minute bars from 2023-01-02 (a Monday) 00:00 UTC
+std::vector<MarketData> make_minute_bars(int count) {
+    const int64_t start = TimeUtils::days_from_civil(2023, 1, 2) * 86400;
+    std::vector<MarketData> bars;
+    for (int i = 0; i < count; ++i) {
+        MarketData bar;
+        bar.timestamp = TimeUtils::format_timestamp(start + i * 60);
+        double mid = 100.0 + 8.0 * std::sin(i / 90.0) + 0.5 * std::cos(i / 7.0);
+        bar.open = mid - 0.1;
+        bar.close = mid + 0.1;
+        bar.high = mid + 0.3 + (i % 5) * 0.01;
+        bar.low = mid - 0.3 - (i % 3) * 0.01;
+        bar.volume = 1000 + i % 17;
+        bars.push_back(bar);
+    }
+    return bars;
+}
+
+bool test_time_utils() {
+    int64_t epoch;
+    if (!TimeUtils::parse_timestamp("2023-03-15 13:45:30", epoch) || epoch != 1678887930 ||
+        TimeUtils::format_timestamp(epoch) != "2023-03-15 13:45:30") {
+        std::cout << "Timestamp round trip failed" << std::endl;
+        return false;
+    }
+    if (!TimeUtils::parse_timestamp("2024-02-29", epoch) || TimeUtils::format_date(epoch) != "2024-02-29" ||
+        TimeUtils::parse_timestamp("2023-02-29", epoch) || TimeUtils::parse_timestamp("2023-01-01 x", epoch)) {
+        std::cout << "Date validation failed" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Every coarse bar must equal a direct aggregation of its fine bars
+bool check_resample(const std::vector<MarketData>& fine, DataInterval interval, int per_bar) {
+    std::vector<MarketData> coarse = BarResampler::resample(fine, interval);
+    size_t expected = (fine.size() + per_bar - 1) / per_bar;
+    if (coarse.size() != expected) {
+        std::cout << interval_name(interval) << ": expected " << expected << " bars, got " << coarse.size() << std::endl;
+        return false;
+    }
+    for (size_t b = 0; b < coarse.size(); ++b) {
+        size_t first = b * per_bar;
+        size_t last = std::min(fine.size(), first + per_bar) - 1;
+        double high = fine[first].high, low = fine[first].low, volume = 0.0;
+        for (size_t i = first; i <= last; ++i) {
+            high = std::max(high, fine[i].high);
+            low = std::min(low, fine[i].low);
+            volume += fine[i].volume;
+        }
+        const MarketData& bar = coarse[b];
+        if (bar.open != fine[first].open || bar.close != fine[last].close || bar.high != high ||
+            bar.low != low || bar.volume != volume) {
+            std::cout << interval_name(interval) << " bar " << b << " OHLCV mismatch" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_resample_series() {
+    std::vector<MarketData> fine = make_minute_bars(3 * 1440 + 77);
+    if (!check_resample(fine, DataInterval::MINUTE_5, 5) || !check_resample(fine, DataInterval::MINUTE_15, 15) ||
+        !check_resample(fine, DataInterval::HOUR_1, 60) || !check_resample(fine, DataInterval::DAILY, 1440)) {
+        return false;
+    }
+
+    std::vector<MarketData> hourly = BarResampler::resample(fine, DataInterval::HOUR_1);
+    std::vector<MarketData> daily = BarResampler::resample(fine, DataInterval::DAILY);
+    if (hourly[1].timestamp != "2023-01-02 01:00:00" || daily[1].timestamp != "2023-01-03") {
+        std::cout << "Coarse bars should be stamped with their bucket start" << std::endl;
+        return false;
+    }
+
+    // Daily bars roll up into a week starting Monday and a month starting on the 1st
+    std::vector<MarketData> weekly = BarResampler::resample(daily, DataInterval::WEEKLY);
+    std::vector<MarketData> monthly = BarResampler::resample(daily, DataInterval::MONTHLY);
+    if (weekly.size() != 1 || weekly[0].timestamp != "2023-01-02" ||
+        monthly.size() != 1 || monthly[0].timestamp != "2023-01-01") {
+        std::cout << "Calendar-aligned buckets are wrong" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_multi_timeframe_stream() {
+    std::vector<MarketData> fine = make_minute_bars(600);
+
+    BarResampler resampler;
+    size_t five = 0, hour = 0;
+    double hour_volume = 0.0;
+    resampler.subscribe(DataInterval::MINUTE_5, [&](DataInterval, const MarketData&) { ++five; });
+    resampler.subscribe(DataInterval::HOUR_1, [&](DataInterval interval, const MarketData& bar) {
+        if (interval == DataInterval::HOUR_1) {
+            ++hour;
+            hour_volume += bar.volume;
+        }
+    });
+
+    for (const MarketData& bar : fine) {
+        resampler.add_bar(bar);
+    }
+    // 600 minutes: the last 5m and 1h buckets are still open
+    if (five != 119 || hour != 9 || resampler.get_partial(DataInterval::HOUR_1) == nullptr) {
+        std::cout << "Streaming emitted " << five << " 5m and " << hour << " 1h bars" << std::endl;
+        return false;
+    }
+    resampler.flush();
+    if (five != 120 || hour != 10) {
+        std::cout << "Flush should emit the open bars" << std::endl;
+        return false;
+    }
+
+    double total_volume = 0.0;
+    for (const MarketData& bar : fine) {
+        total_volume += bar.volume;
+    }
+    if (hour_volume != total_volume) {
+        std::cout << "Hourly volume does not add up" << std::endl;
+        return false;
+    }
+
+    // Ticks build bars the same way
+    BarResampler ticks;
+    MarketData minute;
+    ticks.subscribe(DataInterval::MINUTE_1, [&](DataInterval, const MarketData& bar) { minute = bar; });
+    ticks.add_tick("2023-01-02 09:30:05", 10.0, 100);
+    ticks.add_tick("2023-01-02 09:30:20", 10.5, 50);
+    ticks.add_tick("2023-01-02 09:30:41", 9.8, 25);
+    ticks.add_tick("2023-01-02 09:30:59", 10.1, 10);
+    ticks.add_tick("2023-01-02 09:31:00", 10.2, 5);
+    if (minute.timestamp != "2023-01-02 09:30:00" || minute.open != 10.0 || minute.high != 10.5 ||
+        minute.low != 9.8 || minute.close != 10.1 || minute.volume != 185) {
+        std::cout << "Tick aggregation is wrong" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_resampled_backtest() {
+    std::vector<MarketData> fine = make_minute_bars(5 * 1440);
+
+    const std::string data_file = "test_bar_resampler_data.csv";
+    {
+        std::ofstream out(data_file);
+        out << "timestamp,open,high,low,close,volume\n";
+        out.precision(10);
+        for (const MarketData& bar : fine) {
+            out << bar.timestamp << "," << bar.open << "," << bar.high << "," << bar.low << ","
+                << bar.close << "," << bar.volume << "\n";
+        }
+    }
+    auto data = std::make_shared<CSVParser>();
+    bool loaded = data->load_data(data_file);
+    std::remove(data_file.c_str());
+    if (!loaded) {
+        std::cout << "Failed to load test data" << std::endl;
+        return false;
+    }
+
+    std::map<std::string, double> params = {{"short_period", 5.0}, {"long_period", 20.0}};
+    auto inner = std::make_shared<SMACrossoverStrategy>();
+    auto strategy = std::make_shared<ResampledStrategy>(inner, DataInterval::MINUTE_15);
+    strategy->initialize(params);
+
+    Backtester backtester;
+    backtester.initialize(BacktestConfig());
+    BacktestResults results = backtester.run_backtest(strategy, data, std::make_shared<RiskManager>());
+
+    std::cout << "  " << strategy->get_name() << ": " << results.total_trades << " trades over "
+              << data->get_data_count() << " one-minute bars" << std::endl;
+
+    if (strategy->get_name() != "SMA_CROSSOVER @15m" || results.total_trades == 0) {
+        std::cout << "Resampled strategy did not trade" << std::endl;
+        return false;
+    }
+    // Entries only fire on the first minute of a 15-minute bucket (exits may be stops)
+    for (const Trade& trade : results.trades) {
+        int64_t epoch;
+        if (trade.action == "BUY" && TimeUtils::parse_timestamp(trade.timestamp, epoch) && epoch % 900 != 0) {
+            std::cout << "Trade at " << trade.timestamp << " is off the 15-minute grid" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Bar Resampler Test ===" << std::endl;
+
+    if (!test_time_utils() || !test_resample_series() || !test_multi_timeframe_stream() ||
+        !test_resampled_backtest()) {
+        return 1;
+    }
+
+    std::cout << "Bar resampler test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,246 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include "data/bar_source.h"
+#include "data/api_bar_source.h"
+#include "backtester/backtester.h"
+#include "utils/time_utils.h"
+
+using namespace TradingBot;
+
+bool create_minute_data_file(const std::string& filename, int rows) {
+    std::ofstream data(filename);
+    if (!data.is_open()) {
+        return false;
+    }
+
+    const int64_t start = TimeUtils::days_from_civil(2023, 1, 2) * 86400;
+    data << "timestamp,open,high,low,close,volume\n";
+    for (int i = 0; i < rows; ++i) {
+        double close = 100.0 + 8.0 * std::sin(i / 150.0) + 0.7 * std::cos(i / 11.0);
+        data << TimeUtils::format_timestamp(start + i * 60) << "," << close - 0.02 << "," << close + 0.3 << ","
+             << close - 0.3 << "," << close << "," << 1000 + i % 61 << "\n";
+    }
+    return true;
+}
+
+bool same_trades(const BacktestResults& a, const BacktestResults& b) {
+    if (a.trades.size() != b.trades.size() || a.total_return != b.total_return) {
+        return false;
+    }
+    for (size_t i = 0; i < a.trades.size(); ++i) {
+        if (a.trades[i].timestamp != b.trades[i].timestamp || a.trades[i].price != b.trades[i].price ||
+            a.trades[i].quantity != b.trades[i].quantity) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BacktestResults run(std::shared_ptr<BarSource> source) {
+    auto strategy = std::make_shared<SMACrossoverStrategy>();
+    strategy->initialize({{"short_period", 10.0}, {"long_period", 40.0}});
+    BacktestConfig config;
+    config.record_equity_curve = false;
+    Backtester backtester;
+    backtester.initialize(config);
+    return backtester.run_backtest(strategy, source, std::make_shared<RiskManager>());
+}
+
+bool test_streaming_backtest(const std::string& data_file) {
+    // Baseline: whole file in memory
+    auto start = std::chrono::steady_clock::now();
+    auto data = std::make_shared<CSVParser>();
+    data->load_data(data_file);
+    auto strategy = std::make_shared<SMACrossoverStrategy>();
+    strategy->initialize({{"short_period", 10.0}, {"long_period", 40.0}});
+    BacktestConfig config;
+    config.record_equity_curve = false;
+    Backtester backtester;
+    backtester.initialize(config);
+    BacktestResults loaded = backtester.run_backtest(strategy, data, std::make_shared<RiskManager>());
+    double loaded_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    BacktestResults streamed = run(std::make_shared<CSVBarSource>(data_file, 2048));
+    double streamed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    BacktestResults read_ahead = run(std::make_shared<ReadAheadBarSource>(std::make_shared<CSVBarSource>(data_file, 2048)));
+    double read_ahead_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "  " << data->get_data_count() << " bars: load+run " << loaded_ms << "ms, streamed "
+              << streamed_ms << "ms, read-ahead " << read_ahead_ms << "ms (" << loaded.total_trades
+              << " trades)" << std::endl;
+
+    if (!same_trades(loaded, streamed) || !same_trades(loaded, read_ahead)) {
+        std::cout << "Streaming backtest differs from the loaded one" << std::endl;
+        return false;
+    }
+
+    // Compressed store streams the same bars
+    auto store = std::make_shared<CompressedBarStore>(10000.0, 4096);
+    store->append_all(data->get_all_data());
+    if (!same_trades(loaded, run(std::make_shared<CompressedBarSource>(store)))) {
+        std::cout << "Compressed source differs from the loaded data" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_read_ahead_bounds(const std::string& data_file) {
+    auto source = std::make_shared<ReadAheadBarSource>(std::make_shared<CSVBarSource>(data_file, 1000), 2);
+    std::vector<MarketData> batch;
+    size_t bars = 0, largest = 0;
+    while (source->next_batch(batch)) {
+        bars += batch.size();
+        largest = std::max(largest, batch.size());
+    }
+    size_t first_pass = bars;
+
+    // Rewind mid-stream and read everything again
+    source->rewind();
+    source->next_batch(batch);
+    source->rewind();
+    bars = 0;
+    while (source->next_batch(batch)) {
+        bars += batch.size();
+    }
+
+    if (largest != 1000 || bars != first_pass) {
+        std::cout << "Read-ahead batches of " << largest << " bars, " << bars << " after rewind" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Inner source that fails part way, as a dropped connection would
+class FailingSource : public BarSource {
+public:
+    FailingSource() : calls_(0) {}
+    bool next_batch(std::vector<MarketData>& batch) override {
+        if (++calls_ > 2) {
+            throw std::runtime_error("connection lost");
+        }
+        batch.assign(10, MarketData());
+        return true;
+    }
+    bool rewind() override { calls_ = 0; return true; }
+    std::string get_name() const override { return "failing"; }
+
+private:
+    int calls_;
+};
+
+bool test_read_ahead_error() {
+    ReadAheadBarSource source(std::make_shared<FailingSource>());
+    std::vector<MarketData> batch;
+    int batches = 0;
+    try {
+        while (source.next_batch(batch)) {
+            ++batches;
+        }
+    } catch (const std::runtime_error& e) {
+        return batches == 2;
+    }
+    std::cout << "Read-ahead swallowed the inner source's error" << std::endl;
+    return false;
+}
+
+// Provider that ignores the requested range and returns its whole history
+class FullHistoryClient : public APIClient {
+public:
+    FullHistoryClient() : requests(0), fail_from(0) {}
+
+    APIResponse fetch_historical_data(const std::string& /*symbol*/, DataInterval /*interval*/,
+                                      const std::string& /*start_date*/, const std::string& /*end_date*/) override {
+        ++requests;
+        APIResponse response;
+        if (fail_from > 0 && requests >= fail_from) {
+            response.success = false;
+            response.error_message = "rate limited";
+            return response;
+        }
+        response.success = true;
+        for (int day = 0; day < 100; ++day) {
+            MarketData bar;
+            bar.timestamp = TimeUtils::format_date((TimeUtils::days_from_civil(2023, 1, 1) + day) * 86400);
+            bar.open = bar.high = bar.low = bar.close = 100.0 + day;
+            bar.volume = 1000;
+            response.data.push_back(bar);
+        }
+        return response;
+    }
+
+    APIResponse fetch_latest_quote(const std::string& /*symbol*/) override { return APIResponse(); }
+    std::string get_provider_name() const override { return "Full history"; }
+    bool validate_api_key() override { return true; }
+
+    int requests;
+    int fail_from;                     // First request to fail (0 = never)
+};
+
+bool test_api_source() {
+    APIDataFetcher fetcher;
+    FullHistoryClient* client = new FullHistoryClient();
+    fetcher.set_client(APIProvider::YAHOO_FINANCE, std::unique_ptr<APIClient>(client));
+    fetcher.set_provider(APIProvider::YAHOO_FINANCE);
+
+    APIBarSource source(fetcher, "TEST", DataInterval::DAILY, "2023-01-10", "2023-03-01", 14);
+    std::vector<MarketData> batch;
+    std::vector<MarketData> bars;
+    while (source.next_batch(batch)) {
+        bars.insert(bars.end(), batch.begin(), batch.end());
+    }
+
+    // 2023-01-10 .. 2023-03-01 is 51 days, fetched in four 14-day windows
+    if (bars.size() != 51 || bars.front().timestamp != "2023-01-10" || bars.back().timestamp != "2023-03-01" ||
+        client->requests != 4) {
+        std::cout << "API source returned " << bars.size() << " bars in " << client->requests
+                  << " requests" << std::endl;
+        return false;
+    }
+
+    // A failed window throws instead of passing for the end of the history
+    // (another symbol, so nothing comes from the fetcher's cache)
+    client->requests = 0;
+    client->fail_from = 2;
+    APIBarSource failing(fetcher, "OTHER", DataInterval::DAILY, "2023-01-10", "2023-03-01", 14);
+    bool threw = false;
+    try {
+        while (failing.next_batch(batch)) {
+        }
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    if (!threw || failing.get_last_error() != "rate limited") {
+        std::cout << "Failed window ended the API source silently" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Bar Source Test ===" << std::endl;
+
+    const std::string data_file = "test_bar_source_data.csv";
+    if (!create_minute_data_file(data_file, 200000)) {
+        std::cout << "Failed to create test data" << std::endl;
+        return 1;
+    }
+
+    bool ok = test_streaming_backtest(data_file) && test_read_ahead_bounds(data_file) &&
+              test_read_ahead_error() && test_api_source();
+    std::remove(data_file.c_str());
+
+    if (!ok) {
+        return 1;
+    }
+
+    std::cout << "Bar source test completed!" << std::endl;
+    return 0;
+}
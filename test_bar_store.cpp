@@ -0,0 +1,248 @@
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include "data/bar_store.h"
+#include "backtester/backtester.h"
+#include "utils/time_utils.h"
+
+using namespace TradingBot;
+
+// One-minute bars with cent prices and whole-share volumes, as vendors ship them
+bool create_minute_data_file(const std::string& filename, int rows) {
+    std::ofstream data(filename);
+    if (!data.is_open()) {
+        return false;
+    }
+
+    const int64_t start = TimeUtils::days_from_civil(2023, 1, 2) * 86400 + 9 * 3600 + 30 * 60;
+    data << "timestamp,open,high,low,close,volume\n";
+    for (int i = 0; i < rows; ++i) {
+        double mid = 150.0 + 12.0 * std::sin(i / 400.0) + 1.5 * std::sin(i / 13.0);
+        double cents = std::round(mid * 100.0);
+        double open = (cents - 3) / 100.0;
+        double close = (cents + 2) / 100.0;
+        double high = (cents + 9 + i % 4) / 100.0;
+        double low = (cents - 8 - i % 3) / 100.0;
+        // 390-minute sessions, one per day
+        int64_t timestamp = start + (i / 390) * 86400 + (i % 390) * 60;
+        data << TimeUtils::format_timestamp(timestamp) << "," << open << "," << high << "," << low << ","
+             << close << "," << 2000 + (i * 37) % 5000 << "\n";
+    }
+    return true;
+}
+
+bool same_bars(const std::vector<MarketData>& a, const std::vector<MarketData>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].timestamp != b[i].timestamp || a[i].open != b[i].open || a[i].high != b[i].high ||
+            a[i].low != b[i].low || a[i].close != b[i].close || a[i].volume != b[i].volume) {
+            std::cout << "Bar " << i << " differs: " << a[i].timestamp << " vs " << b[i].timestamp << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_round_trip(const CSVParser& csv, size_t csv_bytes, CompressedBarStore& store) {
+    if (!store.append_all(csv.get_all_data())) {
+        std::cout << "Store rejected a bar" << std::endl;
+        return false;
+    }
+    store.seal();
+
+    double ratio = static_cast<double>(csv_bytes) / store.compressed_bytes();
+    std::cout << "  " << store.size() << " bars in " << store.block_count() << " blocks: " << csv_bytes
+              << " CSV bytes -> " << store.compressed_bytes() << " (" << ratio << "x)" << std::endl;
+
+    if (!same_bars(csv.get_all_data(), store.decode_all())) {
+        std::cout << "Decoded bars differ from the input" << std::endl;
+        return false;
+    }
+    if (ratio < 5.0) {
+        std::cout << "Compression below 5x" << std::endl;
+        return false;
+    }
+
+    // A range read only decodes the blocks it overlaps
+    int64_t from = TimeUtils::days_from_civil(2023, 1, 10) * 86400;
+    int64_t to = from + 86400 - 1;
+    std::vector<MarketData> day = store.decode_range(from, to);
+    if (day.size() != 390 || day.front().timestamp != "2023-01-10 09:30:00") {
+        std::cout << "Range read returned " << day.size() << " bars" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_lossless_fallback(const std::string& filename) {
+    CompressedBarStore store(100.0, 64);
+    std::vector<MarketData> bars;
+    for (int i = 0; i < 150; ++i) {
+        MarketData bar;
+        bar.timestamp = TimeUtils::format_date(TimeUtils::days_from_civil(2020, 1, 1) * 86400 + i * 86400);
+        bar.open = 100.0 + std::sqrt(2.0) * i;   // Not exact at two decimals
+        bar.high = bar.open + 1.0 / 3.0;
+        bar.low = bar.open - 0.1;
+        bar.close = bar.open + 0.05;
+        bar.volume = 1000.5 + i;
+        bars.push_back(bar);
+    }
+    MarketData backwards = bars.front();
+    if (!store.append_all(bars) || store.append(backwards)) {
+        std::cout << "Store should accept ordered bars and reject one going backwards" << std::endl;
+        return false;
+    }
+
+    // Unsealed tail is readable before and after a save/load
+    if (!same_bars(bars, store.decode_all())) {
+        std::cout << "XOR-encoded bars differ from the input" << std::endl;
+        return false;
+    }
+    CompressedBarStore loaded;
+    if (!store.save(filename) || !loaded.load(filename) || !same_bars(bars, loaded.decode_all())) {
+        std::cout << "Saved store did not load back identically" << std::endl;
+        return false;
+    }
+    std::remove(filename.c_str());
+    return true;
+}
+
+// Saves 'store', lets 'damage' edit the raw file, and reports whether it still loads
+bool load_damaged(const CompressedBarStore& original, const std::string& filename,
+                  void (*damage)(std::string&), CompressedBarStore& loaded) {
+    CompressedBarStore copy = original;
+    copy.save(filename);
+    std::string raw;
+    {
+        std::ifstream in(filename, std::ios::binary);
+        raw.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    damage(raw);
+    {
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        out.write(raw.data(), static_cast<std::streamsize>(raw.size()));
+    }
+    bool ok = loaded.load(filename);
+    std::remove(filename.c_str());
+    return ok;
+}
+
+bool test_corrupt_file(const std::string& filename) {
+    CompressedBarStore store(100.0, 64);
+    for (int i = 0; i < 150; ++i) {
+        MarketData bar;
+        bar.timestamp = TimeUtils::format_date(TimeUtils::days_from_civil(2020, 1, 1) * 86400 + i * 86400);
+        bar.open = 100.0 + i;
+        bar.high = bar.open + 1.0;
+        bar.low = bar.open - 1.0;
+        bar.close = bar.open + 0.5;
+        bar.volume = 1000 + i;
+        store.append(bar);
+    }
+
+    // Header: 4-byte magic, then price_scale and block_size
+    CompressedBarStore loaded;
+    auto zero_scale = [](std::string& raw) { std::fill(raw.begin() + 4, raw.begin() + 12, '\0'); };
+    auto zero_block_size = [](std::string& raw) { std::fill(raw.begin() + 12, raw.begin() + 20, '\0'); };
+    if (load_damaged(store, filename, zero_scale, loaded) ||
+        load_damaged(store, filename, zero_block_size, loaded)) {
+        std::cout << "Store loaded a zero price scale or block size" << std::endl;
+        return false;
+    }
+
+    // Encoded bytes are the tail of the file; all continuation bits means no
+    // varint ever ends, so decoding must stop at the block boundary
+    auto endless_varints = [](std::string& raw) { std::fill(raw.end() - 64, raw.end(), '\xff'); };
+    if (!load_damaged(store, filename, endless_varints, loaded)) {
+        std::cout << "Store with a consistent header failed to load" << std::endl;
+        return false;
+    }
+    bool threw = false;
+    try {
+        loaded.decode_all();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    if (!threw) {
+        std::cout << "Overrunning block decoded without an error" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_backtest_speed(const std::string& data_file, const CompressedBarStore& store) {
+    std::map<std::string, double> params = {{"short_period", 10.0}, {"long_period", 40.0}};
+    BacktestConfig config;
+    config.record_equity_curve = false;
+
+    auto start = std::chrono::steady_clock::now();
+    auto data = std::make_shared<CSVParser>();
+    data->load_data(data_file);
+    auto csv_strategy = std::make_shared<SMACrossoverStrategy>();
+    csv_strategy->initialize(params);
+    Backtester csv_backtester;
+    csv_backtester.initialize(config);
+    BacktestResults from_csv = csv_backtester.run_backtest(csv_strategy, data, std::make_shared<RiskManager>());
+    double csv_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    auto store_strategy = std::make_shared<SMACrossoverStrategy>();
+    store_strategy->initialize(params);
+    Backtester store_backtester;
+    store_backtester.initialize(config);
+    BacktestResults from_store = store_backtester.run_backtest(store_strategy, store, std::make_shared<RiskManager>());
+    double store_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "  Load + backtest: CSV " << csv_ms << "ms, compressed " << store_ms << "ms ("
+              << from_store.total_trades << " trades)" << std::endl;
+
+    if (from_csv.total_trades != from_store.total_trades || from_csv.total_return != from_store.total_return) {
+        std::cout << "Backtest over the compressed store differs from the CSV run" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < from_csv.trades.size(); ++i) {
+        if (from_csv.trades[i].timestamp != from_store.trades[i].timestamp ||
+            from_csv.trades[i].price != from_store.trades[i].price) {
+            std::cout << "Trade " << i << " differs between CSV and compressed runs" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Compressed Bar Store Test ===" << std::endl;
+
+    const std::string data_file = "test_bar_store_data.csv";
+    const std::string store_file = "test_bar_store.tbc";
+    if (!create_minute_data_file(data_file, 200000)) {
+        std::cout << "Failed to create test data" << std::endl;
+        return 1;
+    }
+
+    CSVParser csv;
+    std::ifstream sized(data_file, std::ios::binary | std::ios::ate);
+    size_t csv_bytes = static_cast<size_t>(sized.tellg());
+    sized.close();
+
+    CompressedBarStore store(100.0);
+    bool ok = csv.load_data(data_file) && test_round_trip(csv, csv_bytes, store) &&
+              test_lossless_fallback(store_file) && test_corrupt_file(store_file) && test_backtest_speed(data_file, store);
+    std::remove(data_file.c_str());
+    std::remove(store_file.c_str());
+
+    if (!ok) {
+        return 1;
+    }
+
+    std::cout << "Compressed bar store test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,208 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include "batch/batch_runner.h"
+#include "utils/time_utils.h"
+
+using namespace TradingBot;
+
+bool create_wave_file(const std::string& filename, int rows, double period) {
+    std::ofstream data(filename);
+    if (!data.is_open()) {
+        return false;
+    }
+
+    const int64_t start = TimeUtils::days_from_civil(2020, 1, 1);
+    data << "timestamp,open,high,low,close,volume\n";
+    for (int i = 0; i < rows; ++i) {
+        double close = 100.0 + 10.0 * std::sin(i / period) + 0.01 * i;
+        data << TimeUtils::format_date((start + i) * 86400) << "," << close - 0.1 << "," << close + 0.5 << ","
+             << close - 0.5 << "," << close << "," << 1000 + i % 37 << "\n";
+    }
+    return true;
+}
+
+std::unique_ptr<Strategy> make_strategy(const std::string& name) {
+    if (name == "SMA") return std::make_unique<SMACrossoverStrategy>();
+    if (name == "EMA") return std::make_unique<EMAStrategy>();
+    if (name == "RSI") return std::make_unique<RSIStrategy>();
+    return nullptr;
+}
+
+std::map<std::string, double> default_parameters(const std::string& name) {
+    if (name == "SMA" || name == "EMA") return {{"short_period", 5.0}, {"long_period", 20.0}};
+    if (name == "RSI") return {{"period", 14.0}, {"overbought_threshold", 70.0}, {"oversold_threshold", 30.0}};
+    return {};
+}
+
+bool test_manifest_errors() {
+    const std::string manifest_file = "test_batch_bad_manifest.txt";
+    {
+        std::ofstream manifest(manifest_file);
+        manifest << "data AAA a.csv\n"
+                 << "strategy SMA\n"
+                 << "override fast short_period=three\n";
+    }
+
+    BatchManifest manifest;
+    std::string error;
+    bool loaded = BatchRunner::load_manifest(manifest_file, manifest, error);
+    std::remove(manifest_file.c_str());
+
+    if (loaded || error.find(":3:") == std::string::npos) {
+        std::cout << "Bad override was not reported on its line: " << error << std::endl;
+        return false;
+    }
+
+    // Config fields are range-checked against the config schema
+    {
+        std::ofstream out(manifest_file);
+        out << "data AAA a.csv\n"
+            << "override loose stop_loss_pct=2\n";
+    }
+    loaded = BatchRunner::load_manifest(manifest_file, manifest, error);
+    std::remove(manifest_file.c_str());
+
+    if (loaded || error.find(":2: risk_management.stop_loss_pct") == std::string::npos) {
+        std::cout << "Out-of-range override was not reported: " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_batch(const std::string& file_a, const std::string& file_b) {
+    const std::string manifest_file = "test_batch_manifest.txt";
+    const std::string output_file = "test_batch_results.csv";
+    {
+        std::ofstream manifest(manifest_file);
+        manifest << "# two series, one listed twice under different ids\n"
+                 << "data AAA " << file_a << "\n"
+                 << "data BBB " << file_b << "\n"
+                 << "data AAA_COPY " << file_a << "\n"
+                 << "strategy SMA EMA\n"
+                 << "strategy RSI\n"
+                 << "override base\n"
+                 << "override tight stop_loss_pct=0.01 short_period=3\n"
+                 << "output " << output_file << "\n"
+                 << "threads 4\n";
+    }
+
+    BatchManifest manifest;
+    std::string error;
+    if (!BatchRunner::load_manifest(manifest_file, manifest, error)) {
+        std::cout << "Manifest rejected: " << error << std::endl;
+        return false;
+    }
+    std::remove(manifest_file.c_str());
+
+    BatchRunner runner;
+    runner.initialize(BacktestConfig(), RiskParameters());
+    std::vector<BatchJobResult> results = runner.run(manifest, make_strategy, default_parameters);
+
+    if (results.size() != 18 || runner.get_data_loads() != 2) {
+        std::cout << results.size() << " jobs, " << runner.get_data_loads() << " data loads" << std::endl;
+        return false;
+    }
+
+    // Every job matches the same backtest run on its own
+    size_t trades = 0;
+    for (const BatchJobResult& job : results) {
+        if (!job.success) {
+            std::cout << "Job failed: " << job.error << std::endl;
+            return false;
+        }
+
+        std::map<std::string, double> params = default_parameters(job.strategy_name);
+        RiskParameters risk_params;
+        if (job.override_name == "tight") {
+            risk_params.stop_loss_pct = 0.01;
+            params["short_period"] = 3.0;   // RSI ignores it
+        }
+
+        std::shared_ptr<Strategy> strategy(make_strategy(job.strategy_name));
+        strategy->initialize(params);
+        auto risk_manager = std::make_shared<RiskManager>();
+        risk_manager->initialize(risk_params);
+        auto data = std::make_shared<CSVParser>();
+        data->load_data(job.data_id == "BBB" ? file_b : file_a);
+
+        Backtester backtester;
+        backtester.initialize(BacktestConfig());
+        BacktestResults expected = backtester.run_backtest(strategy, data, risk_manager);
+        if (expected.total_trades != job.results.total_trades || expected.total_return != job.results.total_return) {
+            std::cout << job.data_id << "/" << job.strategy_name << "/" << job.override_name << ": "
+                      << job.results.total_trades << " trades vs " << expected.total_trades << std::endl;
+            return false;
+        }
+        trades += job.results.total_trades;
+    }
+    if (trades == 0) {
+        std::cout << "Batch produced no trades" << std::endl;
+        return false;
+    }
+
+    if (!BatchRunner::write_results(results, output_file)) {
+        std::cout << "Failed to write results" << std::endl;
+        return false;
+    }
+    std::ifstream output(output_file);
+    std::string line;
+    size_t lines = 0;
+    while (std::getline(output, line)) {
+        ++lines;
+    }
+    output.close();
+    std::remove(output_file.c_str());
+
+    if (lines != 19) {
+        std::cout << "Results file has " << lines << " lines" << std::endl;
+        return false;
+    }
+
+    std::cout << "  " << results.size() << " jobs over " << runner.get_data_loads() << " data loads, "
+              << trades << " trades" << std::endl;
+    return true;
+}
+
+bool test_missing_data() {
+    BatchManifest manifest;
+    BatchDataSet data_set;
+    data_set.id = "NONE";
+    data_set.file = "does_not_exist.csv";
+    manifest.data_sets.push_back(data_set);
+    manifest.strategies.push_back("SMA");
+    manifest.strategies.push_back("UNKNOWN");
+
+    BatchRunner runner;
+    runner.initialize(BacktestConfig(), RiskParameters());
+    std::vector<BatchJobResult> results = runner.run(manifest, make_strategy, default_parameters);
+    if (results.size() != 2 || results[0].success || results[0].error.empty()) {
+        std::cout << "Missing data file was not reported per job" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Batch Runner Test ===" << std::endl;
+
+    const std::string file_a = "test_batch_a.csv";
+    const std::string file_b = "test_batch_b.csv";
+    if (!create_wave_file(file_a, 1500, 15.0) || !create_wave_file(file_b, 1200, 9.0)) {
+        std::cout << "Failed to create test data" << std::endl;
+        return 1;
+    }
+
+    bool ok = test_manifest_errors() && test_batch(file_a, file_b) && test_missing_data();
+    std::remove(file_a.c_str());
+    std::remove(file_b.c_str());
+
+    if (!ok) {
+        return 1;
+    }
+
+    std::cout << "Batch runner test completed!" << std::endl;
+    return 0;
+}
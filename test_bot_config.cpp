@@ -0,0 +1,194 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "config/bot_config.h"
+
+using namespace TradingBot;
+
+std::string read_file(const std::string& filename) {
+    std::ifstream file(filename);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void write_file(const std::string& filename, const std::string& content) {
+    std::ofstream file(filename);
+    file << content;
+}
+
+bool contains(const std::string& text, const std::string& part) {
+    return text.find(part) != std::string::npos;
+}
+
+// The shipped configs load into the typed structs, nested keys included
+bool test_shipped_configs() {
+    ConfigLoader loader;
+    std::string error;
+    if (!loader.load("config.json", error)) {
+        std::cout << "config.json rejected: " << error << std::endl;
+        return false;
+    }
+    const BotConfig& config = loader.get();
+    if (config.api.alpha_vantage.api_key != "demo" || config.api.default_provider != "yahoo_finance" ||
+        config.risk.position_sizing_atr != 2.0 || config.backtesting.end_date != "2023-12-31" ||
+        config.strategies.at("SMA_CROSSOVER").at("long_period") != 30.0 ||
+        config.strategies.at("MEAN_REVERSION").at("std_dev_threshold") != 2.0 ||
+        config.logging.max_file_size_mb != 10.0 || config.data.date_format != "%Y-%m-%d %H:%M:%S" ||
+        !config.portfolio_risk || config.portfolio_risk->max_concentration != 0.25) {
+        std::cout << "config.json values not loaded" << std::endl;
+        return false;
+    }
+
+    for (const char* example : {"examples/config_aggressive_sma.json", "examples/config_conservative_sma.json",
+                                "examples/config_ema_swing.json", "examples/config_rsi_scalping.json"}) {
+        if (!loader.load(example, error)) {
+            std::cout << example << " rejected: " << error << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_json_syntax() {
+    JsonValue value;
+    std::string error;
+    if (!parse_json("{\"a\": [1, -2.5e3, true, null], \"s\": \"q\\\"\\u00e9\\ud83d\\ude00\"}", value, error) ||
+        value.find("a")->items()[1].as_number() != -2500.0 || !value.find("a")->items()[3].is_null() ||
+        value.find("s")->as_string() != "q\"\xc3\xa9\xf0\x9f\x98\x80") {
+        std::cout << "Valid document misread: " << error << std::endl;
+        return false;
+    }
+
+    const char* broken[] = {"{\"a\": [1, 2,]}", "{\"a\": 01}", "{\"a\": 1} x", "{\"a\" 1}", "{\"a\": \"\\ud800\"}",
+                            "{\"a\": tru}", "[1.]"};
+    for (const char* text : broken) {
+        if (parse_json(text, value, error) || !contains(error, "line 1, column")) {
+            std::cout << "Accepted or unlocated: " << text << " (" << error << ")" << std::endl;
+            return false;
+        }
+    }
+    parse_json("{\n  \"a\": 1,\n  \"b\": ]\n}", value, error);
+    if (!contains(error, "line 3, column 8")) {
+        std::cout << "Wrong error position: " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Validation errors name the offending path and line
+bool test_validation() {
+    struct Case {
+        const char* text;
+        const char* expected;
+    };
+    const Case cases[] = {
+        {"{\n\"risk_management\": {\n  \"stop_loss_pct\": 1.5\n}}", "risk_management.stop_loss_pct (line 3)"},
+        {"{\"backtesting\": {\"comission_rate\": 0.001}}", "backtesting.comission_rate (line 1): unknown key"},
+        {"{\"api\": {\"alpha_vantage\": {\"timeout_seconds\": \"30\"}}}", "api.alpha_vantage.timeout_seconds"},
+        {"{\"risk_management\": {\"atr_period\": 2.5}}", "risk_management.atr_period"},
+        {"{\"logging\": {\"min_level\": \"LOUD\"}}", "logging.min_level"},
+        {"{\"data\": {\"validation\": {\"min_volume\": -1}}}", "data.validation.min_volume"},
+        {"{\"strategies\": {\"RSI\": {\"period\": [14]}}}", "strategies.RSI.period"},
+        {"{\"backtesting\": {\"start_date\": \"2023-02-01\", \"end_date\": \"2023-01-01\"}}", "backtesting.end_date"},
+        {"{\"session\": {\"open_minutes\": 1500}}", "session.open_minutes"},
+        {"{\"portfolio_risk\": {\"var_confidence\": 1.0}}", "portfolio_risk.var_confidence"},
+        {"{\"session\": {\"holidays\": [\"2023-02-30\"]}}", "session.holidays"},
+    };
+    for (const Case& c : cases) {
+        BotConfig config;
+        std::string error;
+        if (ConfigLoader::parse(c.text, config, error) || !contains(error, c.expected)) {
+            std::cout << "Expected error at " << c.expected << ", got '" << error << "'" << std::endl;
+            return false;
+        }
+    }
+
+    // Exchange hours and holidays
+    BotConfig session;
+    std::string session_error;
+    if (!ConfigLoader::parse("{\"session\": {\"utc_offset_minutes\": -300, \"open_minutes\": 570, "
+                             "\"close_minutes\": 960, \"holidays\": [\"2023-01-16\"]}}", session, session_error) ||
+        session.session.utc_offset_minutes != -300 || session.session.open_minutes != 570 ||
+        session.session.close_minutes != 960 || !session.session.weekends_closed ||
+        session.holidays != std::vector<std::string>{"2023-01-16"}) {
+        std::cout << "Session section not loaded: " << session_error << std::endl;
+        return false;
+    }
+
+    // Overrides share the schema
+    RiskParameters risk;
+    BacktestConfig backtest;
+    std::string error;
+    if (!set_risk_parameter(risk, "atr_period", 20.0, error) || risk.atr_period != 20 ||
+        set_risk_parameter(risk, "max_drawdown", 0.0, error) || !contains(error, "risk_management.max_drawdown") ||
+        set_risk_parameter(risk, "short_period", 5.0, error) || !error.empty() ||
+        !set_backtest_parameter(backtest, "use_intrabar_execution", 1.0, error) || !backtest.use_intrabar_execution) {
+        std::cout << "Overrides not checked against the schema: " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_reload() {
+    const std::string filename = "test_bot_config.json";
+    write_file(filename, "{\"risk_management\": {\"stop_loss_pct\": 0.03}}");
+
+    ConfigLoader loader;
+    std::string error;
+    if (!loader.load(filename, error) || loader.get().risk.stop_loss_pct != 0.03) {
+        std::cout << "Initial load failed: " << error << std::endl;
+        return false;
+    }
+
+    // Untouched and rewritten-identical files are not parsed again
+    bool ok = loader.reload(error) == ConfigLoader::ReloadResult::UNCHANGED;
+    write_file(filename, "{\"risk_management\": {\"stop_loss_pct\": 0.03}}");
+    ok = ok && loader.reload(error) == ConfigLoader::ReloadResult::UNCHANGED && loader.get_parse_count() == 1;
+
+    write_file(filename, "{\"risk_management\": {\"stop_loss_pct\": 0.04}}");
+    ok = ok && loader.reload(error) == ConfigLoader::ReloadResult::RELOADED && loader.get().risk.stop_loss_pct == 0.04;
+
+    // A broken edit is reported once and the last good config stays
+    write_file(filename, "{\"risk_management\": {\"stop_loss_pct\": \"high\"}}");
+    ok = ok && loader.reload(error) == ConfigLoader::ReloadResult::FAILED &&
+         contains(error, filename + ": risk_management.stop_loss_pct") && loader.get().risk.stop_loss_pct == 0.04 &&
+         loader.reload(error) == ConfigLoader::ReloadResult::UNCHANGED;
+    std::remove(filename.c_str());
+
+    if (!ok) {
+        std::cout << "Reload did not behave (" << error << ")" << std::endl;
+    }
+    return ok;
+}
+
+bool test_parse_speed() {
+    std::string text = read_file("config.json");
+    const int iterations = 2000;
+    size_t keys = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        BotConfig config;
+        std::string error;
+        ConfigLoader::parse(text, config, error);
+        keys += config.strategies.size();
+    }
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+    std::cout << "  " << us << " us per config.json parse" << std::endl;
+    return keys == static_cast<size_t>(iterations) * 2;
+}
+
+int main() {
+    std::cout << "=== Config Loader Test ===" << std::endl;
+
+    if (!test_shipped_configs() || !test_json_syntax() || !test_validation() || !test_reload() ||
+        !test_parse_speed()) {
+        return 1;
+    }
+
+    std::cout << "Config loader test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,338 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "backtester/cross_sectional_backtester.h"
+#include "strategy/indicator_kernels.h"
+
+using namespace TradingBot;
+
+const double NaN = std::numeric_limits<double>::quiet_NaN();
+const int64_t DAY = 86400;
+
+// Random-walk universe; 'gaps' blanks out some quotes and delays some listings
+UniverseData make_universe(size_t symbols, size_t bars, bool gaps, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> step(0.0003, 0.02);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    UniverseData universe;
+    for (size_t s = 0; s < symbols; ++s) {
+        universe.symbols.push_back("S" + std::to_string(s));
+    }
+    for (size_t i = 0; i < bars; ++i) {
+        universe.epochs.push_back(946684800 + static_cast<int64_t>(i) * DAY);
+    }
+    universe.closes.resize(symbols * bars);
+
+    std::vector<double> prices(symbols);
+    std::vector<size_t> listed(symbols, 0);
+    for (size_t s = 0; s < symbols; ++s) {
+        prices[s] = 10.0 + 90.0 * unit(rng);
+        if (gaps && s % 7 == 3) {
+            listed[s] = static_cast<size_t>(unit(rng) * bars / 2);
+        }
+    }
+    for (size_t i = 0; i < bars; ++i) {
+        double* row = &universe.closes[i * symbols];
+        for (size_t s = 0; s < symbols; ++s) {
+            prices[s] *= std::exp(step(rng));
+            bool missing = i < listed[s] || (gaps && unit(rng) < 0.02);
+            row[s] = missing ? NaN : prices[s];
+        }
+    }
+    return universe;
+}
+
+bool test_rsi_matches_kernel() {
+    UniverseData universe = make_universe(40, 600, false, 7);
+    const size_t n = universe.symbol_count();
+
+    RSIRankStrategy strategy;
+    if (!strategy.initialize({{"period", 14}, {"top_k", 5}})) {
+        std::cout << "CS_RSI rejected valid parameters" << std::endl;
+        return false;
+    }
+    strategy.reset(n);
+
+    // Expected RSI per symbol from the whole-array kernel
+    std::vector<std::vector<double>> expected(n, std::vector<double>(universe.bar_count()));
+    std::vector<double> column(universe.bar_count());
+    for (size_t s = 0; s < n; ++s) {
+        for (size_t i = 0; i < universe.bar_count(); ++i) {
+            column[i] = universe.bar(i)[s];
+        }
+        IndicatorKernels::rsi(column.data(), column.size(), 14, expected[s].data());
+    }
+
+    for (size_t i = 0; i < universe.bar_count(); ++i) {
+        const std::vector<uint32_t>& picks = strategy.rank(universe.bar(i));
+        const std::vector<double>& scores = strategy.get_scores();
+        for (size_t s = 0; s < n; ++s) {
+            double want = expected[s][i];
+            bool same = std::isnan(want) ? std::isnan(scores[s]) : std::fabs(scores[s] - want) <= 1e-9;
+            if (!same) {
+                std::cout << "CS_RSI score " << scores[s] << " != kernel RSI " << want << " at bar " << i
+                          << ", symbol " << s << std::endl;
+                return false;
+            }
+        }
+
+        // Picks are the five best scores, best first
+        if (i >= 14) {
+            for (size_t k = 1; k < picks.size(); ++k) {
+                if (scores[picks[k - 1]] < scores[picks[k]]) {
+                    std::cout << "CS_RSI picks out of order at bar " << i << std::endl;
+                    return false;
+                }
+            }
+            size_t better = 0;
+            for (size_t s = 0; s < n; ++s) {
+                better += scores[s] > scores[picks.back()] ? 1 : 0;
+            }
+            if (picks.size() != 5 || better > 4) {
+                std::cout << "CS_RSI picks are not the top five at bar " << i << std::endl;
+                return false;
+            }
+        } else if (!picks.empty()) {
+            std::cout << "CS_RSI picked during warm-up" << std::endl;
+            return false;
+        }
+    }
+    std::cout << "CS_RSI scores match the RSI kernel" << std::endl;
+    return true;
+}
+
+bool test_momentum_picks() {
+    // Four symbols over six bars, lookback 2; symbol 3 lists at bar 2
+    UniverseData universe;
+    universe.symbols = {"A", "B", "C", "D"};
+    universe.epochs = {0, DAY, 2 * DAY, 3 * DAY, 4 * DAY, 5 * DAY};
+    universe.closes = {
+        10, 20, 30, NaN,
+        11, 20, 29, NaN,
+        12, NaN, 28, 5,
+        13, 22, 27, 6,
+        12, 23, 30, 9,
+        11, 24, 33, 9,
+    };
+
+    MomentumRankStrategy strategy;
+    if (!strategy.initialize({{"lookback_period", 2}, {"top_k", 2}})) {
+        std::cout << "CS_MOMENTUM rejected valid parameters" << std::endl;
+        return false;
+    }
+    strategy.reset(universe.symbol_count());
+
+    std::vector<std::vector<uint32_t>> expected = {
+        {}, {},
+        {0, 2},        // A +20%, C -6.7%; B has no quote, D just listed
+        {0, 1},        // A +18.2%, B +10% (from its last quote), C -6.9%
+        {3, 1},        // D +80%, B +15%, C +7.1%, A 0%
+        {3, 2},        // D +50%, C +22.2%, B +9.1%, A -15.4%
+    };
+    for (size_t i = 0; i < universe.bar_count(); ++i) {
+        const std::vector<uint32_t>& picks = strategy.rank(universe.bar(i));
+        if (picks != expected[i]) {
+            std::cout << "CS_MOMENTUM picks wrong at bar " << i << std::endl;
+            return false;
+        }
+    }
+    if (std::fabs(strategy.get_scores()[1] - (24.0 / 22.0 - 1.0)) > 1e-12) {
+        std::cout << "CS_MOMENTUM score wrong" << std::endl;
+        return false;
+    }
+
+    // Missing parameters throw, invalid ones are rejected
+    bool threw = false;
+    try {
+        strategy.initialize({{"top_k", 2}});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    if (!threw || strategy.initialize({{"lookback_period", 0}, {"top_k", 2}}) ||
+        strategy.initialize({{"lookback_period", 5}, {"top_k", 2.5}})) {
+        std::cout << "CS_MOMENTUM accepted bad parameters" << std::endl;
+        return false;
+    }
+    std::cout << "CS_MOMENTUM picks correct" << std::endl;
+    return true;
+}
+
+bool test_registry() {
+    const CrossSectionalRegistry& registry = CrossSectionalRegistry::instance();
+    if (!registry.create("CS_MOMENTUM") || !registry.create("CS_RSI") || registry.create("SMA_CROSSOVER")) {
+        std::cout << "CrossSectionalRegistry lookup wrong" << std::endl;
+        return false;
+    }
+
+    // Every schema's defaults are accepted by its strategy
+    for (const auto& name : registry.get_names()) {
+        auto strategy = registry.create(name);
+        if (!strategy->initialize(registry.get_default_parameters(name)) ||
+            strategy->get_parameters() != registry.get_default_parameters(name)) {
+            std::cout << name << " rejected its schema defaults" << std::endl;
+            return false;
+        }
+    }
+
+    // Overrides are checked against the schema like single-symbol strategies
+    std::map<std::string, double> params;
+    std::string error;
+    if (!registry.resolve_parameters("CS_RSI", {{"top_k", 10}, {"hold_lowest", 1}}, params, error) ||
+        params["top_k"] != 10 || params["hold_lowest"] != 1 || params["period"] != 14) {
+        std::cout << "CS_RSI overrides not resolved: " << error << std::endl;
+        return false;
+    }
+    if (registry.resolve_parameters("CS_RSI", {{"hold_lowest", 0.5}}, params, error) ||
+        registry.resolve_parameters("CS_MOMENTUM", {{"period", 14}}, params, error) ||
+        registry.resolve_parameters("CS_MOMENTUM", {{"top_k", 0}}, params, error)) {
+        std::cout << "Cross-sectional schema accepted a bad parameter" << std::endl;
+        return false;
+    }
+    std::cout << "Cross-sectional registry resolves parameters" << std::endl;
+    return true;
+}
+
+bool test_align() {
+    std::vector<MarketData> a(3), b(2);
+    for (size_t i = 0; i < 3; ++i) {
+        a[i].epoch = static_cast<int64_t>(i) * 2 * DAY;      // days 0, 2, 4
+        a[i].close = 10.0 + i;
+    }
+    b[0].epoch = DAY;
+    b[0].close = 50.0;
+    b[1].epoch = 2 * DAY;
+    b[1].close = 51.0;
+
+    UniverseData universe = UniverseData::align({"A", "B"}, {&a, &b});
+    std::vector<int64_t> epochs = {0, DAY, 2 * DAY, 4 * DAY};
+    if (universe.epochs != epochs || universe.bar(0)[0] != 10.0 || !std::isnan(universe.bar(0)[1]) ||
+        !std::isnan(universe.bar(1)[0]) || universe.bar(1)[1] != 50.0 || universe.bar(2)[0] != 11.0 ||
+        universe.bar(2)[1] != 51.0 || universe.bar(3)[0] != 12.0 || !std::isnan(universe.bar(3)[1])) {
+        std::cout << "UniverseData::align merged wrong" << std::endl;
+        return false;
+    }
+    std::cout << "Universe alignment correct" << std::endl;
+    return true;
+}
+
+bool test_backtest() {
+    UniverseData universe = make_universe(60, 800, true, 11);
+
+    BacktestConfig config;
+    config.initial_capital = 1000000.0;
+    CrossSectionalBacktester backtester;
+    backtester.initialize(config);
+    backtester.set_rebalance_period(5);
+
+    auto strategy = std::shared_ptr<CrossSectionalStrategy>(CrossSectionalRegistry::instance().create("CS_MOMENTUM"));
+    strategy->initialize({{"lookback_period", 60}, {"top_k", 10}});
+    BacktestResults first = backtester.run_universe_backtest(strategy, universe);
+
+    if (first.total_trades == 0 || first.equity_curve.size() != universe.bar_count() ||
+        first.trades.front().symbol.empty() || first.trades.front().action != "BUY") {
+        std::cout << "Universe backtest produced no usable trades" << std::endl;
+        return false;
+    }
+
+    // Never more than top_k holdings, never negative
+    size_t held = 0;
+    for (double quantity : backtester.get_holdings()) {
+        if (quantity < 0.0) {
+            std::cout << "Negative holding" << std::endl;
+            return false;
+        }
+        held += quantity > 0.0 ? 1 : 0;
+    }
+    if (held == 0 || held > 10) {
+        std::cout << "Holding " << held << " symbols with top_k 10" << std::endl;
+        return false;
+    }
+
+    // Before the first ranking nothing trades and equity is flat
+    if (first.equity_curve[59] != config.initial_capital || first.trades.front().epoch < universe.epochs[60]) {
+        std::cout << "Traded during the lookback warm-up" << std::endl;
+        return false;
+    }
+
+    // The same instances give the same run again
+    BacktestResults second = backtester.run_universe_backtest(strategy, universe);
+    if (second.total_trades != first.total_trades || second.equity_curve != first.equity_curve) {
+        std::cout << "Repeated universe backtest differs" << std::endl;
+        return false;
+    }
+    // Limits that never bind leave the run as it was; a concentration cap
+    // below one slot's weight blocks every buy
+    PortfolioRiskLimits loose;
+    loose.max_concentration = 0.2;
+    PortfolioRiskLimits tight;
+    tight.max_concentration = 0.05;
+    PortfolioRiskLimits invalid;
+    invalid.var_confidence = 1.0;
+    if (backtester.set_portfolio_risk(invalid) || !backtester.set_portfolio_risk(loose)) {
+        std::cout << "Portfolio risk limits not validated" << std::endl;
+        return false;
+    }
+    BacktestResults checked = backtester.run_universe_backtest(strategy, universe);
+    if (checked.total_trades != first.total_trades || backtester.get_rejected_orders() != 0) {
+        std::cout << "Loose portfolio limits changed the run (" << backtester.get_rejected_orders()
+                  << " buys skipped)" << std::endl;
+        return false;
+    }
+    backtester.set_portfolio_risk(tight);
+    BacktestResults blocked = backtester.run_universe_backtest(strategy, universe);
+    if (blocked.total_trades != 0 || backtester.get_rejected_orders() == 0) {
+        std::cout << "Concentration limit did not block oversized buys" << std::endl;
+        return false;
+    }
+    backtester.clear_portfolio_risk();
+
+    std::cout << "Universe backtest: " << first.total_trades << " trades, " << first.total_return * 100
+              << "% return" << std::endl;
+    return true;
+}
+
+bool test_large_universe() {
+    // 3000 symbols of daily bars over 20 years
+    const size_t symbols = 3000, bars = 20 * 252;
+    UniverseData universe = make_universe(symbols, bars, true, 3);
+
+    BacktestConfig config;
+    config.initial_capital = 10000000.0;
+    config.record_trades = false;
+    CrossSectionalBacktester backtester;
+    backtester.initialize(config);
+
+    for (const char* name : {"CS_MOMENTUM", "CS_RSI"}) {
+        auto strategy = std::shared_ptr<CrossSectionalStrategy>(CrossSectionalRegistry::instance().create(name));
+        strategy->initialize(strategy->get_parameters());
+
+        auto start = std::chrono::steady_clock::now();
+        BacktestResults results = backtester.run_universe_backtest(strategy, universe);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "  " << name << ": " << symbols << " symbols x " << bars << " bars in " << seconds << " s, "
+                  << results.total_trades << " trades" << std::endl;
+        if (seconds >= 60.0 || results.total_trades == 0) {
+            std::cout << "Large universe run too slow or idle" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Cross-Sectional Strategy Test ===" << std::endl;
+
+    if (!test_rsi_matches_kernel() || !test_momentum_picks() || !test_registry() || !test_align() || !test_backtest() ||
+        !test_large_universe()) {
+        return 1;
+    }
+
+    std::cout << "Cross-sectional test completed!" << std::endl;
+    return 0;
+}
@@ -1,5 +1,126 @@
 #include "data/csv_parser.h"
+#include "test_helpers.h"
 #include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+// Write a large file with awkward rows: blank lines, CRLF, junk and missing fields
+bool create_large_data_file(const std::string& filename, int rows) {
+    std::ofstream data(filename, std::ios::binary);
+    if (!data.is_open()) {
+        return false;
+    }
+
+    data << "timestamp,open,high,low,close,volume\n";
+    for (int i = 0; i < rows; ++i) {
+        double close = 100.0 + (i % 1000) * 0.01 + i * 1e-6;
+        data << TradingBot::test_bar_time(i) << "," << close - 0.05 << "," << close + 0.5 << ","
+             << close - 0.5 << "," << close << "," << 1000 + i % 97;
+        if (i % 9973 == 0) {
+            data << "\r";
+        }
+        data << "\n";
+        if (i % 50021 == 0) {
+            data << "\n2023-01-02 bad,abc,1e999,,7x,\n";
+        }
+    }
+    return true;
+}
+
+bool test_parallel_load() {
+    const std::string filename = "test_csv_large.csv";
+    if (!create_large_data_file(filename, 600000)) {
+        return false;
+    }
+
+    TradingBot::CSVParser serial;
+    auto start = std::chrono::steady_clock::now();
+    serial.load_data(filename);
+    double serial_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    bool identical = true;
+    for (size_t threads : {size_t(1), size_t(3), size_t(8), size_t(0)}) {
+        TradingBot::CSVParser parallel;
+        start = std::chrono::steady_clock::now();
+        bool loaded = parallel.load_data_parallel(filename, threads);
+        double parallel_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        const auto& a = serial.get_all_data();
+        const auto& b = parallel.get_all_data();
+        bool same = loaded && a.size() == b.size();
+        for (size_t i = 0; same && i < a.size(); ++i) {
+            same = a[i].timestamp == b[i].timestamp && a[i].epoch == b[i].epoch && a[i].open == b[i].open && a[i].high == b[i].high &&
+                   a[i].low == b[i].low && a[i].close == b[i].close && a[i].volume == b[i].volume;
+        }
+        same = same && parallel.validate_data() == serial.validate_data();
+
+        std::cout << "  " << (threads ? threads : std::thread::hardware_concurrency()) << " thread(s): "
+                  << parallel_ms << "ms vs serial " << serial_ms << "ms for " << b.size() << " rows"
+                  << (same ? "" : " - MISMATCH") << std::endl;
+        identical = identical && same;
+    }
+    std::remove(filename.c_str());
+
+    if (!identical) {
+        std::cout << "✗ Parallel load differs from serial load" << std::endl;
+        return false;
+    }
+    std::cout << "✓ Parallel load matches serial load" << std::endl;
+    return true;
+}
+
+// Epochs are read once at load; the parser round-trips through the formatters
+bool test_timestamps() {
+    const std::string filename = "test_csv_epochs.csv";
+    {
+        std::ofstream data(filename);
+        data << "timestamp,open,high,low,close,volume\n"
+             << "2024-02-29 23:59:59,1,2,0.5,1.5,10\n"
+             << "1969-12-31T12:00:00Z,1,2,0.5,1.5,10\n"
+             << "2023-13-01,1,2,0.5,1.5,10\n";
+    }
+    TradingBot::CSVParser parser;
+    bool loaded = parser.load_data(filename);
+    std::remove(filename.c_str());
+    if (!loaded || parser.get_data_count() != 3 ||
+        parser.get_data(0).epoch != 1709251199 || parser.get_data(1).epoch != -43200 ||
+        parser.get_data(2).epoch != TradingBot::TimeUtils::NO_EPOCH) {
+        std::cout << "✗ Loader epochs are wrong" << std::endl;
+        return false;
+    }
+
+    int64_t nanoseconds = 0;
+    char text[32];
+    size_t length = TradingBot::TimeUtils::format_timestamp(1709251199, text);
+    if (!TradingBot::TimeUtils::parse_timestamp_ns("2024-02-29 23:59:59.123456789", nanoseconds) ||
+        nanoseconds != 1709251199123456789LL || std::string(text, length) != "2024-02-29 23:59:59" ||
+        TradingBot::TimeUtils::format_date(-43200, text) != 10 || std::string(text, 10) != "1969-12-31") {
+        std::cout << "✗ Timestamp parse/format round trip failed" << std::endl;
+        return false;
+    }
+
+    // Hand-built bars fall back to the string
+    TradingBot::MarketData bar;
+    bar.timestamp = "2024-03-01";
+    int64_t epoch = 0;
+    if (!TradingBot::get_epoch(bar, epoch) || epoch != 1709251200) {
+        std::cout << "✗ get_epoch fallback failed" << std::endl;
+        return false;
+    }
+
+    const int iterations = 1000000;
+    int64_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        TradingBot::TimeUtils::parse_timestamp("2024-02-29 23:59:59", epoch);
+        sum += epoch;
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+    std::cout << "✓ Timestamps parse in " << ns << " ns (" << (sum != 0) << ")" << std::endl;
+    return true;
+}
 
 int main() {
     TradingBot::CSVParser parser;
@@ -35,6 +156,10 @@ int main() {
         return 1;
     }
     
+    if (!test_timestamps() || !test_parallel_load()) {
+        return 1;
+    }
+    
     std::cout << "\nCSV Parser test completed!" << std::endl;
     return 0;
 }
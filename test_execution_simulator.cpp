@@ -0,0 +1,142 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include "backtester/backtester.h"
+#include "backtester/execution_simulator.h"
+#include "test_helpers.h"
+
+using namespace TradingBot;
+
+MarketData make_bar(const std::string& timestamp, double open, double high, double low, double close) {
+    MarketData bar;
+    bar.timestamp = timestamp;
+    bar.open = open;
+    bar.high = high;
+    bar.low = low;
+    bar.close = close;
+    bar.volume = 1000;
+    return bar;
+}
+
+bool near(double a, double b) {
+    return std::fabs(a - b) < 1e-9;
+}
+
+bool test_limit_and_stop_triggers() {
+    ExecutionSimulator sim;
+    uint64_t buy_limit = sim.submit_limit(OrderSide::BUY, 10, 98.0);
+    uint64_t sell_stop = sim.submit_stop(OrderSide::SELL, 5, 95.0);
+    sim.submit_limit(OrderSide::SELL, 5, 110.0);
+
+    // Low reaches 97: buy limit fills at its price, the stop does not trigger
+    std::vector<Fill> fills;
+    sim.process_bar(make_bar("t1", 100, 103, 97, 101), fills);
+    if (fills.size() != 1 || fills[0].order_id != buy_limit || !near(fills[0].price, 98.0)) {
+        std::cout << "Buy limit did not fill at its price" << std::endl;
+        return false;
+    }
+
+    // Gap down through the stop fills at the open
+    fills.clear();
+    sim.process_bar(make_bar("t2", 93, 94, 92, 93.5), fills);
+    if (fills.size() != 1 || fills[0].order_id != sell_stop || !near(fills[0].price, 93.0)) {
+        std::cout << "Gapped stop did not fill at the open" << std::endl;
+        return false;
+    }
+
+    if (sim.pending_count() != 1) {
+        std::cout << "Unexpected resting orders: " << sim.pending_count() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_bracket_path_order() {
+    // Both legs inside the bar: an up bar visits the low first, so the stop wins
+    ExecutionSimulator up;
+    up.submit_bracket(OrderSide::SELL, 10, 95.0, 105.0);
+    std::vector<Fill> fills;
+    up.process_bar(make_bar("t1", 100, 106, 94, 104), fills);
+    if (fills.size() != 1 || fills[0].tag != "stop_loss" || up.pending_count() != 0) {
+        std::cout << "Up bar should stop out before reaching the target" << std::endl;
+        return false;
+    }
+
+    // A down bar visits the high first, so the take-profit wins
+    ExecutionSimulator down;
+    down.submit_bracket(OrderSide::SELL, 10, 95.0, 105.0);
+    fills.clear();
+    down.process_bar(make_bar("t1", 100, 106, 94, 96), fills);
+    if (fills.size() != 1 || fills[0].tag != "take_profit" || !near(fills[0].price, 105.0) ||
+        down.pending_count() != 0) {
+        std::cout << "Down bar should reach the target before the stop" << std::endl;
+        return false;
+    }
+
+    // Cancelling the group removes both legs
+    uint64_t group = down.submit_bracket(OrderSide::SELL, 10, 95.0, 105.0);
+    down.cancel_group(group);
+    if (down.pending_count() != 0) {
+        std::cout << "Cancelled bracket left orders resting" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_intrabar_backtest() {
+    // Rising trend whose pullbacks trade through the stop only intrabar
+    const std::string data_file = "test_execution_simulator_data.csv";
+    std::ofstream out(data_file);
+    out << "timestamp,open,high,low,close,volume\n";
+    for (int i = 0; i < 200; ++i) {
+        double close = 100.0 + 0.3 * i + 6.0 * std::sin(i / 5.0);
+        out << test_bar_time(i) << "," << close << "," << close + 3.0 << ","
+            << close - 3.0 << "," << close << "," << 100000 << "\n";
+    }
+    out.close();
+
+    auto data = std::make_shared<CSVParser>();
+    bool loaded = data->load_data(data_file);
+    std::remove(data_file.c_str());
+    if (!loaded) {
+        std::cout << "Failed to load test data" << std::endl;
+        return false;
+    }
+
+    auto strategy = std::make_shared<SMACrossoverStrategy>();
+    strategy->initialize({{"short_period", 3.0}, {"long_period", 10.0}});
+
+    BacktestConfig config;
+    config.use_intrabar_execution = true;
+
+    Backtester backtester;
+    backtester.initialize(config);
+    BacktestResults results = backtester.run_backtest(strategy, data, std::make_shared<RiskManager>());
+
+    std::cout << "  Intrabar run: " << results.total_trades << " trades, return "
+              << (results.total_return * 100) << "%" << std::endl;
+
+    // Every sell must close a position opened by an earlier buy
+    double position = 0.0;
+    for (const Trade& trade : results.trades) {
+        position += trade.action == "BUY" ? trade.quantity : -trade.quantity;
+        if (position < -1e-9) {
+            std::cout << "Position went short" << std::endl;
+            return false;
+        }
+    }
+    return results.total_trades > 0 && results.equity_curve.size() == data->get_data_count();
+}
+
+int main() {
+    std::cout << "=== Execution Simulator Test ===" << std::endl;
+
+    if (!test_limit_and_stop_triggers() || !test_bracket_path_order() || !test_intrabar_backtest()) {
+        return 1;
+    }
+
+    std::cout << "Execution simulator test completed!" << std::endl;
+    return 0;
+}
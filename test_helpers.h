@@ -0,0 +1,34 @@
+#pragma once
+
+// Fixtures shared by the test executables
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include "utils/time_utils.h"
+
+namespace TradingBot {
+
+    // Time of synthetic bar i: hourly from 2023-01-01 00:00:00
+    inline std::string test_bar_time(int i) {
+        return TimeUtils::format_timestamp(TimeUtils::days_from_civil(2023, 1, 1) * 86400 + int64_t(i) * 3600);
+    }
+
+    // Oscillating price series so crossover strategies actually trade; 'drift'
+    // is added per bar
+    inline bool create_wave_data_file(const std::string& filename, int rows, double drift = 0.0) {
+        std::ofstream data(filename);
+        if (!data.is_open()) {
+            return false;
+        }
+
+        data << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < rows; ++i) {
+            double close = 100.0 + 8.0 * std::sin(i / 6.0) + 2.0 * std::cos(i / 1.7) + i * drift;
+            data << test_bar_time(i) << "," << close << "," << close + 1.0 << "," << close - 1.0 << ","
+                 << close << "," << 100000 << "\n";
+        }
+        return true;
+    }
+
+} // namespace TradingBot
@@ -0,0 +1,143 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include "backtester/backtester.h"
+#include "strategy/indicator_cache.h"
+#include "test_helpers.h"
+
+using namespace TradingBot;
+
+// Run the same strategy with and without the cache and compare results
+bool compare_runs(std::shared_ptr<CSVParser> data, std::shared_ptr<IndicatorCache> cache,
+                  std::shared_ptr<Strategy> plain_strategy, std::shared_ptr<Strategy> cached_strategy,
+                  const std::map<std::string, double>& params) {
+    plain_strategy->initialize(params);
+    cached_strategy->initialize(params);
+
+    Backtester plain;
+    plain.initialize(BacktestConfig());
+    BacktestResults expected = plain.run_backtest(plain_strategy, data,
+                                                  std::make_shared<RiskManager>());
+
+    Backtester cached;
+    cached.initialize(BacktestConfig());
+    cached.set_indicator_cache(cache);
+    BacktestResults actual = cached.run_backtest(cached_strategy, data,
+                                                 std::make_shared<RiskManager>());
+
+    std::cout << "  " << plain_strategy->get_name() << ": " << expected.total_trades << " trades, "
+              << "return " << (expected.total_return * 100) << "%" << std::endl;
+
+    return expected.total_trades == actual.total_trades &&
+           expected.total_return == actual.total_return &&
+           expected.sharpe_ratio == actual.sharpe_ratio;
+}
+
+// Feeds the strategy a bar that is not the one the cache was attached with
+class ShiftedSMAStrategy : public SMACrossoverStrategy {
+public:
+    TradingSignal generate_signal(const MarketData& data, const Position& current_position) override {
+        MarketData shifted = data;
+        shifted.close += 1.0;
+        return SMACrossoverStrategy::generate_signal(shifted, current_position);
+    }
+};
+
+int main() {
+    std::cout << "=== Indicator Cache Test ===" << std::endl;
+
+    const std::string data_file = "test_indicator_cache_data.csv";
+    if (!create_wave_data_file(data_file, 300)) {
+        std::cout << "Failed to create test data" << std::endl;
+        return 1;
+    }
+
+    auto data = std::make_shared<CSVParser>();
+    if (!data->load_data(data_file)) {
+        std::cout << "Failed to load test data" << std::endl;
+        return 1;
+    }
+    std::remove(data_file.c_str());
+
+    auto cache = std::make_shared<IndicatorCache>();
+
+    if (!compare_runs(data, cache, std::make_shared<SMACrossoverStrategy>(), std::make_shared<SMACrossoverStrategy>(),
+                      {{"short_period", 5.0}, {"long_period", 20.0}}) ||
+        !compare_runs(data, cache, std::make_shared<EMAStrategy>(), std::make_shared<EMAStrategy>(),
+                      {{"short_period", 5.0}, {"long_period", 20.0}}) ||
+        !compare_runs(data, cache, std::make_shared<RSIStrategy>(), std::make_shared<RSIStrategy>(),
+                      {{"period", 14.0}, {"overbought_threshold", 70.0}, {"oversold_threshold", 30.0}})) {
+        std::cout << "Cached indicators changed backtest results" << std::endl;
+        return 1;
+    }
+    std::cout << "Cached and uncached backtests match" << std::endl;
+
+    // Second sweep over the same periods is served from the cache
+    size_t misses_before = cache->get_misses();
+    compare_runs(data, cache, std::make_shared<SMACrossoverStrategy>(), std::make_shared<SMACrossoverStrategy>(),
+                 {{"short_period", 5.0}, {"long_period", 20.0}});
+    if (cache->get_misses() != misses_before) {
+        std::cout << "Repeated run recomputed cached series" << std::endl;
+        return 1;
+    }
+    std::cout << "Cache hits: " << cache->get_hits() << ", misses: " << cache->get_misses() << std::endl;
+
+    // Reloading the file with new contents must not serve the old series
+    if (!create_wave_data_file(data_file, 300, 0.05) || !data->load_data(data_file)) {
+        std::cout << "Failed to reload test data" << std::endl;
+        return 1;
+    }
+    std::remove(data_file.c_str());
+    if (!compare_runs(data, cache, std::make_shared<SMACrossoverStrategy>(), std::make_shared<SMACrossoverStrategy>(),
+                      {{"short_period", 5.0}, {"long_period", 20.0}})) {
+        std::cout << "Cache served series from before the reload" << std::endl;
+        return 1;
+    }
+
+    // A cache out of step with the data fails the run instead of holding
+    auto shifted = std::make_shared<ShiftedSMAStrategy>();
+    shifted->initialize({{"short_period", 5.0}, {"long_period", 20.0}});
+    Backtester desynced;
+    desynced.initialize(BacktestConfig());
+    desynced.set_indicator_cache(cache);
+    bool threw = false;
+    try {
+        desynced.run_backtest(shifted, data, std::make_shared<RiskManager>());
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    if (!threw) {
+        std::cout << "Cache desync was swallowed" << std::endl;
+        return 1;
+    }
+
+    // Budget for roughly two series: older ones are evicted first
+    IndicatorCache small_cache(2 * 300 * sizeof(double) + 512);
+    const auto& bars = data->get_all_data();
+    auto first = small_cache.get("wave", bars, IndicatorType::SMA, 5);
+    small_cache.get("wave", bars, IndicatorType::SMA, 10);
+    small_cache.get("wave", bars, IndicatorType::SMA, 5);     // Touch: now most recent
+    small_cache.get("wave", bars, IndicatorType::SMA, 20);    // Evicts SMA(10)
+
+    size_t misses = small_cache.get_misses();
+    small_cache.get("wave", bars, IndicatorType::SMA, 5);
+    if (small_cache.get_misses() != misses || small_cache.size() > 2 ||
+        small_cache.get_memory_usage() > small_cache.get_memory_budget()) {
+        std::cout << "LRU eviction did not respect the memory budget" << std::endl;
+        return 1;
+    }
+
+    // Arrays handed out stay valid after eviction
+    small_cache.clear();
+    if (first->size() != bars.size() || !std::isnan((*first)[0]) || std::isnan((*first)[4])) {
+        std::cout << "Evicted series was invalidated" << std::endl;
+        return 1;
+    }
+    std::cout << "LRU eviction respects the memory budget" << std::endl;
+
+    std::cout << "Indicator cache test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "strategy/indicator_kernels.h"
+
+using namespace TradingBot;
+using namespace TradingBot::IndicatorKernels;
+
+struct Series {
+    std::vector<double> high, low, close;
+};
+
+Series make_series(size_t count) {
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> step(0.0, 1.0);
+    std::uniform_real_distribution<double> spread(0.0, 2.0);
+    Series series;
+    double price = 100.0;
+    for (size_t i = 0; i < count; ++i) {
+        price = std::max(1.0, price + step(rng));
+        // Flat stretches exercise the zero-loss and zero-spread branches
+        double close = (i / 50) % 7 == 3 ? 100.0 : price;
+        series.close.push_back(close);
+        series.high.push_back(close + spread(rng));
+        series.low.push_back(close - spread(rng));
+    }
+    return series;
+}
+
+// Same value, or both NaN
+bool identical(double a, double b) {
+    return (std::isnan(a) && std::isnan(b)) || a == b;
+}
+
+bool close_enough(double a, double b) {
+    return (std::isnan(a) && std::isnan(b)) || std::fabs(a - b) <= 1e-9 * std::max(1.0, std::fabs(b));
+}
+
+// Every kernel at 'level' against the scalar kernels
+bool compare_level(SimdLevel level, const Series& series) {
+    const size_t n = series.close.size();
+    const double* c = series.close.data();
+    std::vector<double> expected(n), actual(n);
+    bool ok = true;
+
+    auto check = [&](const char* name, int period, bool exact, auto kernel) {
+        set_simd_level(SimdLevel::SCALAR);
+        kernel(expected.data());
+        set_simd_level(level);
+        kernel(actual.data());
+        for (size_t i = 0; i < n; ++i) {
+            if (exact ? !identical(actual[i], expected[i]) : !close_enough(actual[i], expected[i])) {
+                std::cout << simd_level_name(level) << " " << name << "(" << period << ")[" << i << "] = " << actual[i]
+                          << ", scalar " << expected[i] << std::endl;
+                ok = false;
+                return;
+            }
+        }
+    };
+
+    for (int period : {1, 2, 3, 14, 20, 61, 200}) {
+        check("rolling_sum", period, true, [&](double* out) { rolling_sum(c, n, period, out); });
+        check("sma", period, true, [&](double* out) { sma(c, n, period, out); });
+        check("ema", period, false, [&](double* out) { ema(c, n, period, out); });
+        check("rsi", period, true, [&](double* out) { rsi(c, n, period, out); });
+        check("atr", period, true, [&](double* out) {
+            atr(series.high.data(), series.low.data(), c, n, period, out);
+        });
+        check("zscore", period, false, [&](double* out) { zscore(c, n, period, out); });
+    }
+    check("true_range", 1, true, [&](double* out) {
+        true_range(series.high.data(), series.low.data(), c, n, out);
+    });
+
+    // The returned EMA equals the last element, and is the same without 'out'
+    set_simd_level(level);
+    for (size_t count : {size_t(19), size_t(20), size_t(21), size_t(27), n}) {
+        double last = ema(c, count, 20, actual.data());
+        if (!identical(last, actual[count - 1]) || !identical(ema(c, count, 20, nullptr), last)) {
+            std::cout << simd_level_name(level) << " EMA return value differs at count " << count << std::endl;
+            ok = false;
+        }
+    }
+
+    // A prefix gives the same EMA as the whole array at that index
+    ema(c, n, 26, expected.data());
+    for (size_t count = 26; count < 300; ++count) {
+        if (!identical(ema(c, count, 26, nullptr), expected[count - 1])) {
+            std::cout << simd_level_name(level) << " EMA of a prefix differs at " << count << std::endl;
+            ok = false;
+            break;
+        }
+    }
+    return ok;
+}
+
+bool test_reference_values(const Series& series) {
+    const size_t n = series.close.size();
+    const double* c = series.close.data();
+    std::vector<double> out(n);
+
+    // Single-window forms equal the batch output at the window's end
+    const int period = 14;
+    size_t at = 777;
+    sma(c, n, period, out.data());
+    bool ok = identical(window_sum(c + at + 1 - period, period) / period, out[at]);
+    rsi(c, n, period, out.data());
+    ok = ok && identical(rsi_value(c + at - period, period), out[at]);
+    atr(series.high.data(), series.low.data(), c, n, period, out.data());
+    ok = ok && identical(atr_value(series.high.data() + at - period, series.low.data() + at - period,
+                                   c + at - period, period), out[at]);
+    if (!ok) {
+        std::cout << "Single-window forms differ from the batch kernels" << std::endl;
+        return false;
+    }
+
+    // Rolling min/max against a direct scan; warm-up and short input are NaN
+    for (int window : {1, 5, 64}) {
+        std::vector<double> lowest(n), highest(n);
+        rolling_min(c, n, window, lowest.data());
+        rolling_max(c, n, window, highest.data());
+        for (size_t i = 0; i < n; ++i) {
+            if (i + 1 < static_cast<size_t>(window)) {
+                if (!std::isnan(lowest[i]) || !std::isnan(highest[i])) {
+                    std::cout << "Rolling min/max defined during warm-up" << std::endl;
+                    return false;
+                }
+                continue;
+            }
+            double low = c[i], high = c[i];
+            for (size_t j = i + 1 - window; j <= i; ++j) {
+                low = std::min(low, c[j]);
+                high = std::max(high, c[j]);
+            }
+            if (lowest[i] != low || highest[i] != high) {
+                std::cout << "Rolling min/max(" << window << ") wrong at " << i << std::endl;
+                return false;
+            }
+        }
+    }
+    sma(c, 5, 10, out.data());
+    if (!std::isnan(out[4]) || !std::isnan(ema(c, 5, 10, nullptr))) {
+        std::cout << "Short input should give NaN" << std::endl;
+        return false;
+    }
+
+    // Flat window: RSI 100, z-score 0
+    std::vector<double> flat(30, 50.0);
+    rsi(flat.data(), flat.size(), 14, out.data());
+    double rsi_flat = out[29];
+    zscore(flat.data(), flat.size(), 14, out.data());
+    if (rsi_flat != 100.0 || out[29] != 0.0) {
+        std::cout << "Flat window handled wrong" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void benchmark(SimdLevel level, const Series& series) {
+    set_simd_level(level);
+    const size_t n = series.close.size();
+    std::vector<double> out(n);
+    auto start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < 5; ++repeat) {
+        sma(series.close.data(), n, 50, out.data());
+        rsi(series.close.data(), n, 14, out.data());
+        ema(series.close.data(), n, 26, out.data());
+        atr(series.high.data(), series.low.data(), series.close.data(), n, 14, out.data());
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / 5;
+    std::cout << "  " << simd_level_name(level) << ": " << ms << " ms for SMA/RSI/EMA/ATR over " << n << " bars"
+              << std::endl;
+}
+
+int main() {
+    std::cout << "=== Indicator Kernels Test ===" << std::endl;
+
+    SimdLevel best = detect_simd_level();
+    std::cout << "CPU supports: " << simd_level_name(best) << std::endl;
+
+    Series series = make_series(5003);
+    if (!test_reference_values(series)) {
+        return 1;
+    }
+    for (SimdLevel level : {SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (static_cast<int>(level) <= static_cast<int>(best) && !compare_level(level, series)) {
+            return 1;
+        }
+    }
+    std::cout << "SIMD kernels match scalar" << std::endl;
+
+    Series large = make_series(250000);
+    for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (static_cast<int>(level) <= static_cast<int>(best)) {
+            benchmark(level, large);
+        }
+    }
+    set_simd_level(best);
+
+    std::cout << "Indicator kernels test completed!" << std::endl;
+    return 0;
+}
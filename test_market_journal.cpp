@@ -0,0 +1,273 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include "data/market_journal.h"
+#include "live/journal_replayer.h"
+#include "live/paper_trader.h"
+#include "utils/time_utils.h"
+#include "utils/work_stealing_pool.h"
+#include "test_helpers.h"
+
+using namespace TradingBot;
+
+// Provider returning canned data, standing in for a network client
+class FakeClient : public APIClient {
+public:
+    APIResponse fetch_historical_data(const std::string& symbol, DataInterval /*interval*/,
+                                      const std::string& /*start_date*/, const std::string& /*end_date*/) override {
+        APIResponse response;
+        response.success = true;
+        response.metadata["symbol"] = symbol;
+        for (int i = 0; i < 3; ++i) {
+            MarketData bar;
+            // Like Yahoo intraday bars: a date-only label on an intraday time
+            bar.timestamp = "2023-01-0" + std::to_string(i + 1);
+            bar.epoch = TimeUtils::days_from_civil(2023, 1, i + 1) * 86400 + 14 * 3600 + 30 * 60;
+            bar.open = 100.1 + i;
+            bar.high = 101.7 + i;
+            bar.low = 99.3 + i;
+            bar.close = 100.0 + i / 3.0;
+            bar.volume = 12345 + i;
+            response.data.push_back(bar);
+        }
+        return response;
+    }
+
+    APIResponse fetch_latest_quote(const std::string& /*symbol*/) override {
+        APIResponse response;
+        response.success = false;
+        response.error_message = "rate limited";
+        return response;
+    }
+
+    std::string get_provider_name() const override { return "Fake"; }
+    bool validate_api_key() override { return true; }
+};
+
+bool same_bar(const MarketData& a, const MarketData& b) {
+    return a.timestamp == b.timestamp && a.epoch == b.epoch && a.open == b.open && a.high == b.high &&
+           a.low == b.low && a.close == b.close && a.volume == b.volume;
+}
+
+bool test_recorded_provider(const std::string& journal_file) {
+    auto journal = std::make_shared<JournalWriter>();
+    if (!journal->open(journal_file)) {
+        std::cout << "Failed to open journal" << std::endl;
+        return false;
+    }
+
+    RecordingAPIClient recorder(std::unique_ptr<APIClient>(new FakeClient()), journal);
+    APIResponse live = recorder.fetch_historical_data("AAPL", DataInterval::DAILY, "2023-01-01", "2023-01-03");
+    APIResponse failed = recorder.fetch_latest_quote("AAPL");
+    journal->close();
+
+    // Stand-in provider serves the same responses, bit for bit
+    JournalAPIClient standin;
+    if (!standin.load(journal_file)) {
+        std::cout << "Failed to load journal" << std::endl;
+        return false;
+    }
+
+    APIResponse replayed = standin.fetch_historical_data("AAPL", DataInterval::DAILY, "", "");
+    APIResponse replayed_quote = standin.fetch_latest_quote("AAPL");
+    APIResponse exhausted = standin.fetch_historical_data("AAPL", DataInterval::DAILY, "", "");
+
+    if (!replayed.success || replayed.data.size() != live.data.size() ||
+        replayed.metadata != live.metadata || replayed_quote.success ||
+        replayed_quote.error_message != failed.error_message || exhausted.success) {
+        std::cout << "Stand-in provider did not reproduce recorded responses" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < live.data.size(); ++i) {
+        if (!same_bar(live.data[i], replayed.data[i])) {
+            std::cout << "Recorded bar differs after replay" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Concurrent fetches are recorded and replayed per symbol
+bool test_concurrent_fetch(const std::string& journal_file) {
+    std::vector<std::string> symbols;
+    for (int i = 0; i < 24; ++i) {
+        symbols.push_back("SYM" + std::to_string(i));
+    }
+
+    std::remove(journal_file.c_str());
+    auto journal = std::make_shared<JournalWriter>();
+    if (!journal->open(journal_file)) {
+        return false;
+    }
+    APIDataFetcher recorder;
+    recorder.set_client(APIProvider::YAHOO_FINANCE, std::unique_ptr<APIClient>(new FakeClient()));
+    recorder.set_provider(APIProvider::YAHOO_FINANCE);
+    recorder.enable_recording(journal);
+    std::vector<APIResponse> live = recorder.fetch_many(symbols, DataInterval::DAILY, "2023-01-01", "2023-01-03", 4);
+    journal->close();
+
+    std::unique_ptr<JournalAPIClient> standin(new JournalAPIClient());
+    if (!standin->load(journal_file)) {
+        return false;
+    }
+    APIDataFetcher replayer;
+    replayer.set_client(APIProvider::YAHOO_FINANCE, std::move(standin));
+    replayer.set_provider(APIProvider::YAHOO_FINANCE);
+    std::vector<APIResponse> replayed = replayer.fetch_many(symbols, DataInterval::DAILY, "2023-01-01", "2023-01-03");
+
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        if (!live[i].success || !replayed[i].success || replayed[i].metadata != live[i].metadata ||
+            live[i].metadata.at("symbol") != symbols[i]) {
+            std::cout << "Concurrent fetch of " << symbols[i] << " was not recorded and replayed" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_truncated_tail(const std::string& journal_file) {
+    std::ifstream in(journal_file, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+
+    // Cut the last record short, as a crash mid-append would
+    std::ofstream out(journal_file, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 5));
+    out.close();
+
+    JournalReader reader;
+    JournalRecord record;
+    size_t records = 0;
+    if (!reader.open(journal_file)) {
+        return false;
+    }
+    while (reader.next(record)) {
+        ++records;
+    }
+    if (records != 1 || !reader.is_truncated()) {
+        std::cout << "Truncated journal should yield its complete records only" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_session_replay(const std::string& journal_file) {
+    const std::string data_file = "test_market_journal_data.csv";
+    if (!create_wave_data_file(data_file, 300, 1e-7)) {
+        return false;
+    }
+    auto data = std::make_shared<CSVParser>();
+    bool loaded = data->load_data(data_file);
+    std::remove(data_file.c_str());
+    if (!loaded) {
+        std::cout << "Failed to load test data" << std::endl;
+        return false;
+    }
+
+    std::map<std::string, double> params = {{"short_period", 5.0}, {"long_period", 20.0}};
+
+    // Record a paper session over a replay feed
+    std::remove(journal_file.c_str());
+    auto journal = std::make_shared<JournalWriter>();
+    journal->open(journal_file);
+
+    auto live_strategy = std::make_shared<SMACrossoverStrategy>();
+    live_strategy->initialize(params);
+
+    PaperTradingConfig config;
+    config.symbol = "WAVE";
+    config.poll_interval_ms = 0;
+    config.queue_capacity = 512;
+
+    PaperTrader trader;
+    trader.initialize(BacktestConfig());
+    trader.set_paper_config(config);
+    trader.set_journal(journal);
+    trader.start(live_strategy, std::make_shared<ReplayQuoteFeed>(data), std::make_shared<RiskManager>());
+    BacktestResults live = trader.wait();
+    journal->close();
+
+    // Replay as fast as possible: identical decisions
+    auto replay_strategy = std::make_shared<SMACrossoverStrategy>();
+    replay_strategy->initialize(params);
+
+    JournalReplayer replayer;
+    replayer.initialize(BacktestConfig());
+    BacktestResults replayed = replayer.replay(journal_file, replay_strategy, std::make_shared<RiskManager>());
+
+    std::cout << "  Replayed " << replayer.get_quotes_replayed() << " quotes, "
+              << replayed.total_trades << " fills; decision " << replayer.get_latency_histogram().summary()
+              << std::endl;
+
+    if (replayer.get_quotes_replayed() != trader.get_decisions() ||
+        replayed.trades.size() != live.trades.size() || replayed.total_return != live.total_return) {
+        std::cout << "Replay diverged from the recorded session" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < live.trades.size(); ++i) {
+        if (replayed.trades[i].timestamp != live.trades[i].timestamp ||
+            replayed.trades[i].price != live.trades[i].price ||
+            replayed.trades[i].quantity != live.trades[i].quantity) {
+            std::cout << "Replayed fill differs from the recorded session" << std::endl;
+            return false;
+        }
+    }
+
+    // Replaying with the live session's already-used strategy gives the same
+    // run: both are reset when a session starts
+    BacktestResults reused = replayer.replay(journal_file, live_strategy, std::make_shared<RiskManager>());
+    if (reused.trades.size() != replayed.trades.size() || reused.total_return != replayed.total_return ||
+        reused.equity_curve != replayed.equity_curve) {
+        std::cout << "Replay with reused instances diverged" << std::endl;
+        return false;
+    }
+
+    // Paced replay honours the recorded spacing, scaled by the speed
+    std::remove(journal_file.c_str());
+    JournalWriter paced;
+    paced.open(journal_file);
+    for (int i = 0; i < 5; ++i) {
+        paced.record_quote("WAVE", data->get_data(i), 1000000000LL + i * 20000000LL);
+    }
+    paced.close();
+
+    auto paced_strategy = std::make_shared<SMACrossoverStrategy>();
+    paced_strategy->initialize(params);
+    replayer.set_speed(2.0);
+    auto start = std::chrono::steady_clock::now();
+    replayer.replay(journal_file, paced_strategy, std::make_shared<RiskManager>());
+    double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // 80ms of recorded spacing at 2x is at least 40ms
+    if (elapsed_ms < 40.0) {
+        std::cout << "Paced replay ran too fast: " << elapsed_ms << "ms" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Market Journal Test ===" << std::endl;
+
+    // Several workers even on a single core, so concurrent fetches overlap
+    SchedulerOptions scheduler;
+    scheduler.num_threads = 4;
+    WorkStealingPool::configure_shared(scheduler);
+
+    const std::string journal_file = "test_market_journal.tbj";
+    std::remove(journal_file.c_str());
+
+    bool ok = test_recorded_provider(journal_file) && test_truncated_tail(journal_file) &&
+              test_session_replay(journal_file) && test_concurrent_fetch(journal_file);
+    std::remove(journal_file.c_str());
+
+    if (!ok) {
+        return 1;
+    }
+
+    std::cout << "Market journal test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <vector>
+#include "data/csv_parser.h"
+#include "strategy/strategy.h"
+#include "strategy/strategy_registry.h"
+#include "utils/rolling_stats.h"
+
+using namespace TradingBot;
+
+// Window mean/variance recomputed from scratch
+void naive_stats(const std::vector<double>& values, size_t end, int window, double& mean, double& variance) {
+    mean = 0.0;
+    for (size_t i = end - window; i < end; ++i) {
+        mean += values[i];
+    }
+    mean /= window;
+    variance = 0.0;
+    for (size_t i = end - window; i < end; ++i) {
+        variance += (values[i] - mean) * (values[i] - mean);
+    }
+    variance /= window - 1;
+}
+
+// The streaming statistics track a direct computation, even on large
+// prices with a tiny spread and after millions of values. At 1e6 +- 0.01
+// the inputs only carry ~8 significant digits of spread, so that bounds the
+// agreement; a sum-of-squares formula would lose it entirely.
+bool test_rolling_stats() {
+    const int window = 50;
+    const size_t total = 3000000;
+    std::vector<double> values(total);
+    for (size_t i = 0; i < total; ++i) {
+        values[i] = 1.0e6 + 0.01 * std::sin(i * 0.37) + 1.0e-4 * (i % 7);
+    }
+
+    RollingStats stats(window);
+    double worst = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < total; ++i) {
+        stats.push(values[i]);
+        if (i + 1 >= static_cast<size_t>(window) && (i % 99991 == 0 || i + 1 == total)) {
+            double mean, variance;
+            naive_stats(values, i + 1, window, mean, variance);
+            worst = std::max({worst, std::fabs(stats.get_mean() - mean) / mean,
+                              std::fabs(stats.get_variance() - variance) / variance});
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / total;
+    std::cout << "  " << ns << " ns per value, worst relative error " << worst << std::endl;
+    if (!stats.is_ready() || stats.get_count() != static_cast<size_t>(window) || worst > 1e-6) {
+        std::cout << "Rolling statistics drifted from the direct computation" << std::endl;
+        return false;
+    }
+
+    // Partial windows and resets
+    stats.reset(4);
+    stats.push(1.0);
+    stats.push(3.0);
+    if (stats.is_ready() || stats.get_mean() != 2.0 || stats.get_variance() != 2.0 || stats.get_last() != 3.0) {
+        std::cout << "Partial window statistics wrong" << std::endl;
+        return false;
+    }
+    for (double value : {5.0, 5.0, 5.0, 5.0}) {
+        stats.push(value);
+    }
+    if (stats.get_variance() != 0.0 || stats.get_zscore(5.0) != 0.0) {
+        std::cout << "Constant window should have no spread" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Buys below the lower band, exits at the mean, sells above the upper band
+bool test_signals() {
+    MeanReversionStrategy strategy;
+    if (!strategy.initialize({{"lookback_period", 10.0}, {"std_dev_threshold", 1.5}}) ||
+        strategy.initialize({{"lookback_period", 1.0}, {"std_dev_threshold", 1.5}})) {
+        std::cout << "Parameter validation wrong" << std::endl;
+        return false;
+    }
+
+    std::vector<double> closes = {100, 101, 100, 99, 100, 101, 100, 99, 100, 101, 90, 95, 100, 112};
+    std::vector<SignalType> signals;
+    Position position;
+    for (double close : closes) {
+        MarketData bar;
+        bar.close = bar.open = bar.high = bar.low = close;
+        TradingSignal signal = strategy.generate_signal(bar, position);
+        signals.push_back(signal.type);
+        if (signal.type == SignalType::BUY) {
+            position.quantity = 10.0;
+        } else if (signal.type == SignalType::SELL) {
+            position.quantity = 0.0;
+        }
+    }
+
+    for (size_t i = 0; i < 9; ++i) {
+        if (signals[i] != SignalType::HOLD) {
+            std::cout << "Signal before the window filled" << std::endl;
+            return false;
+        }
+    }
+    if (signals[10] != SignalType::BUY || signals[11] != SignalType::HOLD || signals[12] != SignalType::SELL ||
+        signals[13] != SignalType::SELL) {
+        std::cout << "Band signals wrong" << std::endl;
+        return false;
+    }
+
+    // A reset instance repeats the run exactly
+    strategy.reset();
+    position = Position();
+    for (size_t i = 0; i < closes.size(); ++i) {
+        MarketData bar;
+        bar.close = bar.open = bar.high = bar.low = closes[i];
+        TradingSignal signal = strategy.generate_signal(bar, position);
+        if (signal.type != signals[i]) {
+            std::cout << "Reset run differs at bar " << i << std::endl;
+            return false;
+        }
+        position.quantity = signal.type == SignalType::BUY ? 10.0 : signal.type == SignalType::SELL ? 0.0 : position.quantity;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Mean Reversion Strategy Test ===" << std::endl;
+
+    if (!test_rolling_stats() || !test_signals()) {
+        return 1;
+    }
+
+    // The registry builds it from the config.json parameter names
+    auto strategy = StrategyRegistry::instance().create("MEAN_REVERSION");
+    auto params = StrategyRegistry::instance().get_default_parameters("MEAN_REVERSION");
+    if (!strategy || !strategy->initialize(params) || params.at("lookback_period") != 20.0 ||
+        params.at("std_dev_threshold") != 2.0) {
+        std::cout << "MEAN_REVERSION not registered" << std::endl;
+        return 1;
+    }
+
+    CSVParser parser;
+    if (parser.load_data("data/sample_data.csv")) {
+        size_t trades = 0;
+        Position position;
+        for (size_t i = 0; i < parser.get_data_count(); ++i) {
+            TradingSignal signal = strategy->generate_signal(parser.get_data(i), position);
+            if (signal.type != SignalType::HOLD) {
+                ++trades;
+            }
+        }
+        std::cout << "  " << trades << " signals over " << parser.get_data_count() << " sample bars" << std::endl;
+    }
+
+    std::cout << "Mean reversion strategy test completed!" << std::endl;
+    return 0;
+}
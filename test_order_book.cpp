@@ -0,0 +1,260 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include "backtester/order_book.h"
+#include "backtester/tick_backtester.h"
+#include "data/tick_data_parser.h"
+
+using namespace TradingBot;
+
+BookEvent make_event(int64_t timestamp, BookEventType type, BookSide side, double price, double quantity) {
+    BookEvent event;
+    event.timestamp = timestamp;
+    event.type = type;
+    event.side = side;
+    event.price = price;
+    event.quantity = quantity;
+    return event;
+}
+
+bool near(double a, double b) {
+    return std::fabs(a - b) < 1e-9;
+}
+
+bool test_levels_and_sweep() {
+    OrderBook book(0.01);
+    std::vector<Fill> fills;
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::BID, 99.99, 300), fills);
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::BID, 99.98, 500), fills);
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::ASK, 100.01, 200), fills);
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::ASK, 100.02, 400), fills);
+
+    if (!near(book.best_bid(), 99.99) || !near(book.best_ask(), 100.01)) {
+        std::cout << "Wrong top of book" << std::endl;
+        return false;
+    }
+
+    // Emptying the top bid falls back to the next level
+    book.apply(make_event(2, BookEventType::QUOTE, BookSide::BID, 99.99, 0), fills);
+    if (!near(book.best_bid(), 99.98)) {
+        std::cout << "Best bid did not move down after the top level emptied" << std::endl;
+        return false;
+    }
+
+    // Marketable buy walks two ask levels and rests nothing beyond its limit
+    uint64_t id = book.submit_limit(OrderSide::BUY, 300, 100.02, 3, fills);
+    if (fills.size() != 2 || !near(fills[0].price, 100.01) || !near(fills[0].quantity, 200) ||
+        !near(fills[1].price, 100.02) || !near(fills[1].quantity, 100) || book.remaining(id) != 0.0) {
+        std::cout << "Marketable limit did not sweep the ask side" << std::endl;
+        return false;
+    }
+    if (!near(book.best_ask(), 100.02) || !near(book.depth(BookSide::ASK, 100.02), 300)) {
+        std::cout << "Swept liquidity was not removed from the book" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_queue_position() {
+    OrderBook book(0.01);
+    std::vector<Fill> fills;
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::BID, 50.00, 100), fills);
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::ASK, 50.01, 100), fills);
+
+    // Join the back of a 100-lot queue
+    uint64_t id = book.submit_limit(OrderSide::BUY, 50, 50.00, 2, fills);
+    if (book.queue_ahead(id) != 100.0 || !fills.empty()) {
+        std::cout << "Resting order should queue behind displayed size" << std::endl;
+        return false;
+    }
+
+    // 60 printed: still 40 ahead
+    book.apply(make_event(3, BookEventType::TRADE, BookSide::BID, 50.00, 60), fills);
+    if (!fills.empty() || book.queue_ahead(id) != 40.0) {
+        std::cout << "Print should consume queue ahead before filling" << std::endl;
+        return false;
+    }
+
+    // Level shrinks to 30 via cancels: at most 30 can remain ahead
+    book.apply(make_event(4, BookEventType::QUOTE, BookSide::BID, 50.00, 30), fills);
+    if (book.queue_ahead(id) != 30.0) {
+        std::cout << "Cancels ahead did not advance the queue" << std::endl;
+        return false;
+    }
+
+    // 50 printed: 30 clears the queue, 20 fills us partially
+    book.apply(make_event(5, BookEventType::TRADE, BookSide::BID, 50.00, 50), fills);
+    if (fills.size() != 1 || !near(fills[0].quantity, 20) || !near(book.remaining(id), 30)) {
+        std::cout << "Expected a 20-lot partial fill" << std::endl;
+        return false;
+    }
+
+    // A print through our price fills the rest
+    fills.clear();
+    book.apply(make_event(6, BookEventType::TRADE, BookSide::BID, 49.99, 100), fills);
+    if (fills.size() != 1 || !near(fills[0].quantity, 30) || !near(fills[0].price, 50.00) ||
+        book.own_order_count() != 0) {
+        std::cout << "Trade-through should complete the order at its limit" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_shared_print_volume() {
+    OrderBook book(0.01);
+    std::vector<Fill> fills;
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::BID, 50.00, 100), fills);
+    book.apply(make_event(1, BookEventType::QUOTE, BookSide::ASK, 50.03, 100), fills);
+
+    // Behind 100 at 50.00, then a better-priced order at 50.01 with nothing ahead
+    uint64_t behind = book.submit_limit(OrderSide::BUY, 50, 50.00, 2, fills);
+    uint64_t better = book.submit_limit(OrderSide::BUY, 50, 50.01, 2, fills);
+
+    // 120 sold down to 50.00: the better price fills first, the other 70
+    // only eat into the queue at 50.00
+    book.apply(make_event(3, BookEventType::TRADE, BookSide::BID, 50.00, 120), fills);
+    if (fills.size() != 1 || fills[0].order_id != better || !near(fills[0].quantity, 50) ||
+        !near(book.queue_ahead(behind), 30) || !near(book.remaining(behind), 50)) {
+        std::cout << "Print volume was counted twice across own orders" << std::endl;
+        return false;
+    }
+
+    // Orders at one price share the queue ahead: 30 clears it for the first
+    // order, 50 fill it, and only the last 40 reach the 100 the second
+    // order joined behind (70 of which the print has now eaten)
+    fills.clear();
+    uint64_t second = book.submit_limit(OrderSide::BUY, 50, 50.00, 4, fills);
+    book.apply(make_event(5, BookEventType::TRADE, BookSide::BID, 50.00, 120), fills);
+    if (fills.size() != 1 || fills[0].order_id != behind || !near(fills[0].quantity, 50) ||
+        !near(book.queue_ahead(second), 30) || !near(book.remaining(second), 50)) {
+        std::cout << "Orders at one price did not share the queue ahead" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Random-walk L2 feed around 100.00 with a print every fourth event
+void generate_feed(TickDataParser& feed, size_t count) {
+    unsigned int state = 12345;
+    int64_t mid_tick = 10000;
+    for (size_t i = 0; i < count; ++i) {
+        state = state * 1103515245u + 12345u;
+        unsigned int r = (state >> 16) & 0x7fff;
+
+        if (r % 50 == 0) {
+            mid_tick += (r & 1) ? 1 : -1;
+        }
+
+        BookEvent event;
+        event.timestamp = static_cast<int64_t>(i);
+        event.quantity = 100.0 + (r % 400);
+        if (i % 4 == 3) {
+            event.type = BookEventType::TRADE;
+            event.side = (r & 2) ? BookSide::BID : BookSide::ASK;
+            event.price = (event.side == BookSide::BID ? mid_tick - 1 : mid_tick + 1) * 0.01;
+        } else {
+            event.type = BookEventType::QUOTE;
+            event.side = (r & 4) ? BookSide::BID : BookSide::ASK;
+            int64_t offset = 1 + static_cast<int64_t>(r % 5);
+            event.price = (event.side == BookSide::BID ? mid_tick - offset : mid_tick + offset) * 0.01;
+        }
+        feed.add_event(event);
+    }
+}
+
+bool test_tick_backtest() {
+    // Round-trip a small feed through the file format
+    const std::string data_file = "test_order_book_data.csv";
+    {
+        TickDataParser generated;
+        generate_feed(generated, 20000);
+        std::ofstream out(data_file);
+        out << "timestamp,type,side,price,quantity\n";
+        for (const BookEvent& event : generated.get_all_events()) {
+            out << event.timestamp << "," << (event.type == BookEventType::QUOTE ? 'Q' : 'T') << ","
+                << (event.side == BookSide::BID ? 'B' : 'A') << "," << event.price << ","
+                << event.quantity << "\n";
+        }
+    }
+
+    auto feed = std::make_shared<TickDataParser>();
+    bool loaded = feed->load_data(data_file);
+    std::remove(data_file.c_str());
+    if (!loaded || feed->get_event_count() != 20000) {
+        std::cout << "Failed to load tick data" << std::endl;
+        return false;
+    }
+
+    auto strategy = std::make_shared<SMACrossoverStrategy>();
+    strategy->initialize({{"short_period", 5.0}, {"long_period", 20.0}});
+
+    TickBacktester backtester;
+    backtester.initialize(BacktestConfig());
+    backtester.set_tick_config(TickBacktestConfig());
+    auto risk_manager = std::make_shared<RiskManager>();
+    BacktestResults results = backtester.run_tick_backtest(strategy, feed, risk_manager);
+
+    std::cout << "  Tick run: " << results.total_trades << " fills, return "
+              << (results.total_return * 100) << "%" << std::endl;
+
+    double position = 0.0;
+    for (const Trade& trade : results.trades) {
+        position += trade.action == "BUY" ? trade.quantity : -trade.quantity;
+        if (position < -1e-9) {
+            std::cout << "Position went short" << std::endl;
+            return false;
+        }
+    }
+    // Fills carry the feed time in epoch seconds
+    for (const Trade& trade : results.trades) {
+        if (trade.epoch == TimeUtils::NO_EPOCH) {
+            std::cout << "Tick fill without an epoch" << std::endl;
+            return false;
+        }
+    }
+
+    // Strategy and risk manager are reset, so a rerun matches
+    BacktestResults again = backtester.run_tick_backtest(strategy, feed, risk_manager);
+    if (again.total_trades != results.total_trades || again.equity_curve != results.equity_curve) {
+        std::cout << "Repeated tick run differs" << std::endl;
+        return false;
+    }
+    return results.total_trades > 0 && results.equity_curve.size() == 5000;
+}
+
+void report_throughput() {
+    TickDataParser feed;
+    generate_feed(feed, 4000000);
+
+    OrderBook book(0.01);
+    std::vector<Fill> fills;
+    std::vector<Fill> resting_fills;
+    book.apply(make_event(0, BookEventType::QUOTE, BookSide::BID, 99.99, 100), fills);
+    book.submit_limit(OrderSide::BUY, 1000000, 99.90, 0, resting_fills);
+
+    auto start = std::chrono::steady_clock::now();
+    for (const BookEvent& event : feed.get_all_events()) {
+        fills.clear();
+        book.apply(event, fills);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "  Replayed " << feed.get_event_count() << " events in " << seconds << "s ("
+              << static_cast<long long>(feed.get_event_count() / seconds) << " events/s)" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Order Book Test ===" << std::endl;
+
+    if (!test_levels_and_sweep() || !test_queue_position() || !test_shared_print_volume() ||
+        !test_tick_backtest()) {
+        return 1;
+    }
+    report_throughput();
+
+    std::cout << "Order book test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <iostream>
+#include <fstream>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include "backtester/backtester.h"
+#include "live/paper_trader.h"
+#include "utils/latency_histogram.h"
+#include "utils/spsc_queue.h"
+#include "test_helpers.h"
+
+using namespace TradingBot;
+
+bool test_spsc_queue() {
+    SPSCQueue<int> queue(1000);
+    const int count = 200000;
+    std::atomic<bool> ok(true);
+
+    std::thread consumer([&]() {
+        int expected = 0;
+        int value = 0;
+        while (expected < count) {
+            if (queue.try_pop(value)) {
+                if (value != expected++) {
+                    ok = false;
+                }
+            }
+        }
+    });
+
+    for (int i = 0; i < count; ++i) {
+        while (!queue.try_push(i)) {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+
+    if (!ok || !queue.empty() || queue.capacity() != 1024) {
+        std::cout << "SPSC queue lost or reordered items" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_latency_histogram() {
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        histogram.record(i * 1000);
+    }
+
+    // Log-linear buckets report within one sub-bucket (~6%)
+    uint64_t p50 = histogram.percentile(50.0);
+    uint64_t p99 = histogram.percentile(99.0);
+    if (histogram.count() != 1000 || histogram.min() != 1000 || histogram.max() != 1000000 ||
+        std::fabs(p50 - 500000.0) > 500000.0 * 0.07 || std::fabs(p99 - 990000.0) > 990000.0 * 0.07) {
+        std::cout << "Histogram percentiles out of tolerance: p50=" << p50 << " p99=" << p99 << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_paper_session() {
+    const std::string data_file = "test_paper_trader_data.csv";
+    if (!create_wave_data_file(data_file, 300)) {
+        std::cout << "Failed to create test data" << std::endl;
+        return false;
+    }
+
+    auto data = std::make_shared<CSVParser>();
+    bool loaded = data->load_data(data_file);
+    std::remove(data_file.c_str());
+    if (!loaded) {
+        std::cout << "Failed to load test data" << std::endl;
+        return false;
+    }
+
+    std::map<std::string, double> params = {{"short_period", 5.0}, {"long_period", 20.0}};
+
+    // Reference: the same quotes as a backtest
+    auto reference_strategy = std::make_shared<SMACrossoverStrategy>();
+    reference_strategy->initialize(params);
+    Backtester backtester;
+    backtester.initialize(BacktestConfig());
+    BacktestResults expected = backtester.run_backtest(reference_strategy, data, std::make_shared<RiskManager>());
+
+    // Replay feed polled as fast as it answers, with a queue large enough to drop nothing
+    auto strategy = std::make_shared<SMACrossoverStrategy>();
+    strategy->initialize(params);
+
+    PaperTradingConfig config;
+    config.poll_interval_ms = 0;
+    config.queue_capacity = 512;
+    config.decision_cpu = 0;
+
+    PaperTrader trader;
+    trader.initialize(BacktestConfig());
+    trader.set_paper_config(config);
+    if (!trader.start(strategy, std::make_shared<ReplayQuoteFeed>(data), std::make_shared<RiskManager>())) {
+        std::cout << "Failed to start paper trading" << std::endl;
+        return false;
+    }
+    const BacktestResults& actual = trader.wait();
+
+    std::cout << "  Paper session: " << trader.get_decisions() << " quotes, "
+              << actual.total_trades << " fills, pinned=" << trader.is_decision_thread_pinned() << std::endl;
+    std::cout << "  Tick-to-decision: " << trader.get_latency_histogram().summary() << std::endl;
+
+    if (trader.get_quotes_dropped() != 0 || trader.get_decisions() != data->get_data_count() ||
+        trader.get_latency_histogram().count() != data->get_data_count()) {
+        std::cout << "Quotes were lost between ingestion and decision" << std::endl;
+        return false;
+    }
+
+    // Same decision path: identical fills and statistics
+    if (actual.total_trades != expected.total_trades || actual.total_return != expected.total_return) {
+        std::cout << "Paper session diverged from the backtest" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Paper Trader Test ===" << std::endl;
+
+    if (!test_spsc_queue() || !test_latency_histogram() || !test_paper_session()) {
+        return 1;
+    }
+
+    std::cout << "Paper trader test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <stdexcept>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+#include <memory>
+#include "optimizer/parameter_optimizer.h"
+#include "test_helpers.h"
+
+using namespace TradingBot;
+
+int main() {
+    std::cout << "=== Parameter Optimizer Test ===" << std::endl;
+
+    const std::string data_file = "test_optimizer_data.csv";
+    if (!create_wave_data_file(data_file, 400, 0.02)) {
+        std::cout << "Failed to create test data" << std::endl;
+        return 1;
+    }
+
+    auto data = std::make_shared<CSVParser>();
+    if (!data->load_data(data_file)) {
+        std::cout << "Failed to load test data" << std::endl;
+        return 1;
+    }
+    std::remove(data_file.c_str());
+
+    OptimizerConfig config;
+    config.population_size = 16;
+    config.max_evaluations = 120;
+    config.max_generations = 30;
+    config.num_threads = 4;
+
+    ParameterOptimizer optimizer;
+    if (!optimizer.initialize(config)) {
+        std::cout << "Optimizer initialization failed" << std::endl;
+        return 1;
+    }
+
+    optimizer.add_parameter(ParameterRange("short_period", 2.0, 20.0, 1.0));
+    optimizer.add_parameter(ParameterRange("long_period", 5.0, 60.0, 1.0));
+    optimizer.add_parameter(ParameterRange("stop_loss_pct", 0.01, 0.10, 0.01));
+
+    auto factory = []() { return std::unique_ptr<Strategy>(new SMACrossoverStrategy()); };
+
+    OptimizationResult result = optimizer.optimize(factory, data, BacktestConfig(), RiskParameters());
+
+    std::cout << "Generations: " << result.generations << std::endl;
+    std::cout << "Backtests run: " << result.evaluations << std::endl;
+    std::cout << "Memoized candidates: " << result.cache_hits << std::endl;
+    std::cout << "Best Sharpe: " << result.best_score << std::endl;
+    for (const auto& param : result.best_parameters) {
+        std::cout << "  " << param.first << ": " << param.second << std::endl;
+    }
+
+    if (result.evaluations == 0 || result.evaluations > config.max_evaluations) {
+        std::cout << "Evaluation budget not respected" << std::endl;
+        return 1;
+    }
+
+    // Best point must satisfy the strategy constraints
+    SMACrossoverStrategy check;
+    if (!check.validate_parameters(result.best_parameters)) {
+        std::cout << "Best parameters violate strategy constraints" << std::endl;
+        return 1;
+    }
+
+    // Same seed, same answer
+    ParameterOptimizer repeat;
+    repeat.initialize(config);
+    for (const auto& range : optimizer.get_parameters()) {
+        repeat.add_parameter(range);
+    }
+    OptimizationResult repeat_result = repeat.optimize(factory, data, BacktestConfig(), RiskParameters());
+    if (repeat_result.best_parameters != result.best_parameters) {
+        std::cout << "Optimizer is not deterministic for a fixed seed" << std::endl;
+        return 1;
+    }
+
+    // A parameter pinned to one value (min == max, no step) is never mutated
+    OptimizerConfig pinned_config = config;
+    pinned_config.mutation_rate = 1.0;
+    pinned_config.max_evaluations = 40;
+    ParameterOptimizer pinned;
+    pinned.initialize(pinned_config);
+    pinned.add_parameter(ParameterRange("short_period", 2.0, 20.0, 1.0));
+    pinned.add_parameter(ParameterRange("long_period", 30.0, 30.0, 0.0));
+    OptimizationResult pinned_result = pinned.optimize(factory, data, BacktestConfig(), RiskParameters());
+    if (pinned_result.best_parameters["long_period"] != 30.0) {
+        std::cout << "Pinned parameter moved" << std::endl;
+        return 1;
+    }
+
+    // A risk value outside its limits makes the genome invalid rather than
+    // being dropped in favour of the base setting
+    ParameterOptimizer risky;
+    risky.initialize(config);
+    risky.add_parameter(ParameterRange("short_period", 2.0, 20.0, 1.0));
+    risky.add_parameter(ParameterRange("long_period", 5.0, 60.0, 1.0));
+    risky.add_parameter(ParameterRange("stop_loss_pct", 1.5, 3.0, 0.5));
+    bool rejected = false;
+    try {
+        risky.optimize(factory, data, BacktestConfig(), RiskParameters());
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    if (!rejected) {
+        std::cout << "Out-of-range stop loss was accepted" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Parameter optimizer test completed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,208 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include "risk/portfolio_risk.h"
+
+using namespace TradingBot;
+
+bool near(double a, double b, double tolerance) {
+    return std::fabs(a - b) <= tolerance * std::max(1.0, std::fabs(b));
+}
+
+// Covariance, exposure and VaR agree with a from-scratch computation
+bool test_incremental_var() {
+    const size_t n = 6;
+    PortfolioRiskLimits limits;
+    limits.max_gross_exposure = 10.0;
+    limits.max_net_exposure = 10.0;
+    limits.max_concentration = 10.0;
+    limits.max_var = 1.0;
+    PortfolioRiskEngine engine;
+    engine.initialize(limits, 1000000.0);
+    for (size_t i = 0; i < n; ++i) {
+        engine.add_symbol("SYM" + std::to_string(i));
+    }
+
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 0.01);
+    std::vector<double> closes(n, 100.0), previous(n, 0.0);
+    std::vector<double> covariance(n * n, 0.0);
+    for (int bar = 0; bar < 60; ++bar) {
+        double market = noise(rng);
+        for (size_t i = 0; i < n; ++i) {
+            previous[i] = closes[i];
+            closes[i] *= 1.0 + market + noise(rng);
+        }
+        engine.update_prices(closes);
+
+        if (bar > 0) {
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    double ri = closes[i] / previous[i] - 1.0;
+                    double rj = closes[j] / previous[j] - 1.0;
+                    covariance[i * n + j] = limits.covariance_decay * covariance[i * n + j] +
+                                            (1.0 - limits.covariance_decay) * ri * rj;
+                }
+            }
+        }
+
+        // Trade now and then; the cached VaR must follow the fills
+        if (bar % 7 == 3) {
+            size_t symbol = bar % n;
+            double quantity = bar % 2 == 0 ? 500.0 : -300.0;
+            engine.apply_fill(symbol, quantity, closes[symbol]);
+        }
+    }
+
+    double variance = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            if (!near(engine.get_covariance(i, j), covariance[i * n + j], 1e-9)) {
+                std::cout << "Covariance (" << i << "," << j << ") differs" << std::endl;
+                return false;
+            }
+            variance += engine.get_position(i) * closes[i] * covariance[i * n + j] *
+                        engine.get_position(j) * closes[j];
+        }
+    }
+    double expected = 2.326348 * std::sqrt(variance);
+    std::cout << "  VaR(99%) " << engine.get_value_at_risk() << " on gross exposure "
+              << engine.get_gross_exposure() << std::endl;
+    if (!near(engine.get_value_at_risk(), expected, 1e-5)) {
+        std::cout << "Incremental VaR " << engine.get_value_at_risk() << " != " << expected << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_limits() {
+    PortfolioRiskLimits limits;
+    limits.max_gross_exposure = 1.0;
+    limits.max_net_exposure = 0.5;
+    limits.max_concentration = 0.3;
+    limits.max_daily_loss = 0.05;
+    limits.max_var = 0.01;
+    limits.var_warmup_bars = 5;
+    PortfolioRiskEngine engine;
+    if (!engine.initialize(limits, 100000.0) || engine.initialize(PortfolioRiskLimits(), 0.0)) {
+        std::cout << "Limit validation failed" << std::endl;
+        return false;
+    }
+    engine.initialize(limits, 100000.0);
+    size_t a = engine.add_symbol("A");
+    size_t b = engine.add_symbol("B");
+    size_t c = engine.add_symbol("C");
+    if (engine.add_symbol("B") != b || engine.find_symbol("C") != c ||
+        engine.find_symbol("D") != PortfolioRiskEngine::npos) {
+        std::cout << "Symbol registration is not idempotent" << std::endl;
+        return false;
+    }
+    // Before any quote an order has no exposure to check
+    if (engine.check_order(a, 1.0) != RiskCheckResult::NO_PRICE) {
+        std::cout << "Order without a mark was accepted" << std::endl;
+        return false;
+    }
+    engine.update_prices({100.0, 100.0, 100.0});
+
+    // 35% of equity in one name
+    if (engine.check_order(a, 350.0) != RiskCheckResult::CONCENTRATION) {
+        std::cout << "Concentration limit not enforced" << std::endl;
+        return false;
+    }
+    engine.apply_fill(a, 300.0, 100.0);
+    engine.apply_fill(b, 200.0, 100.0);
+    // Net would be 60%
+    if (engine.check_order(c, 100.0) != RiskCheckResult::NET_EXPOSURE) {
+        std::cout << "Net exposure limit not enforced, got " << risk_check_name(engine.check_order(c, 100.0))
+                  << std::endl;
+        return false;
+    }
+    // A short keeps net down but pushes gross past 100%
+    engine.apply_fill(c, -300.0, 100.0);
+    if (engine.check_order(b, 250.0) != RiskCheckResult::GROSS_EXPOSURE) {
+        std::cout << "Gross exposure limit not enforced" << std::endl;
+        return false;
+    }
+
+    // Volatile bars: VaR now binds on new risk, while reductions still pass
+    for (int i = 0; i < 6; ++i) {
+        double move = i % 2 == 0 ? 1.03 : 0.98;
+        engine.update_prices({engine.get_price(a) * move, engine.get_price(b) * move,
+                              engine.get_price(c) / move});
+    }
+    if (engine.check_order(b, 50.0) != RiskCheckResult::VALUE_AT_RISK) {
+        std::cout << "VaR limit not enforced (VaR " << engine.get_value_at_risk() << ")" << std::endl;
+        return false;
+    }
+    if (engine.check_order(a, -100.0) != RiskCheckResult::ACCEPTED) {
+        std::cout << "Risk-reducing order was rejected" << std::endl;
+        return false;
+    }
+
+    // A 6% drop since the start of the day blocks anything adding risk
+    engine.start_day();
+    engine.update_prices({engine.get_price(a) * 0.9, engine.get_price(b) * 0.9, engine.get_price(c)});
+    if (engine.check_order(b, 1.0) != RiskCheckResult::DAILY_LOSS) {
+        std::cout << "Daily loss limit not enforced" << std::endl;
+        return false;
+    }
+    engine.start_day();
+    if (engine.check_order(b, 1.0) == RiskCheckResult::DAILY_LOSS) {
+        std::cout << "Daily loss carried into the next day" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Pre-trade checks cost the same whatever the size of the book
+bool test_check_latency() {
+    const size_t n = 400;
+    PortfolioRiskLimits limits;
+    limits.max_gross_exposure = 100.0;
+    limits.max_net_exposure = 100.0;
+    limits.max_concentration = 100.0;
+    limits.max_var = 100.0;
+    PortfolioRiskEngine engine;
+    engine.initialize(limits, 10000000.0);
+    for (size_t i = 0; i < n; ++i) {
+        engine.add_symbol("S" + std::to_string(i));
+    }
+
+    std::mt19937 rng(11);
+    std::normal_distribution<double> noise(0.0, 0.01);
+    std::vector<double> closes(n, 50.0);
+    for (int bar = 0; bar < 30; ++bar) {
+        for (double& close : closes) {
+            close *= 1.0 + noise(rng);
+        }
+        engine.update_prices(closes);
+    }
+    for (size_t i = 0; i < n; i += 2) {
+        engine.apply_fill(i, 100.0, closes[i]);
+    }
+
+    const int checks = 200000;
+    size_t accepted = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < checks; ++i) {
+        accepted += engine.check_order(static_cast<size_t>(i) % n, 10.0) == RiskCheckResult::ACCEPTED;
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / checks;
+    std::cout << "  " << ns << " ns per pre-trade check on " << n << " symbols" << std::endl;
+    return accepted == static_cast<size_t>(checks) && ns < 5000.0;
+}
+
+int main() {
+    std::cout << "=== Portfolio Risk Engine Test ===" << std::endl;
+
+    if (!test_incremental_var() || !test_limits() || !test_check_latency()) {
+        return 1;
+    }
+
+    std::cout << "Portfolio risk engine test completed!" << std::endl;
+    return 0;
+}
@@ -1,4 +1,7 @@
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 #include "risk/risk_manager.h"
 
 using namespace TradingBot;
@@ -50,6 +53,124 @@ int main() {
         std::cout << "Trade validation failed" << std::endl;
     }
     
+    // Streaming ATR matches the batch calculation at every bar
+    RiskManager sizing;
+    sizing.initialize(params);
+    std::vector<MarketData> bars;
+    PortfolioState marks;
+    for (int i = 0; i < 200; ++i) {
+        MarketData bar;
+        bar.close = 50.0 + 5.0 * std::sin(i / 7.0);
+        bar.high = bar.close + 0.5 + 0.3 * std::cos(i / 3.0);
+        bar.low = bar.close - 0.6;
+        bars.push_back(bar);
+        sizing.update_market_data(bar, marks);
+        
+        int period = params.atr_period;
+        if (bars.size() > static_cast<size_t>(period)) {
+            double batch = sizing.calculate_atr(bars, period);
+            if (!sizing.get_volatility().is_ready() || std::fabs(sizing.get_volatility().get_atr() - batch) > 1e-9) {
+                std::cout << "Streaming ATR " << sizing.get_volatility().get_atr() << " differs from "
+                          << batch << " at bar " << i << std::endl;
+                return 1;
+            }
+        }
+    }
+    
+    // Rolling stdev of the last window of returns
+    double mean = 0.0, m2 = 0.0;
+    for (size_t i = bars.size() - params.atr_period; i < bars.size(); ++i) {
+        mean += bars[i].close / bars[i - 1].close - 1.0;
+    }
+    mean /= params.atr_period;
+    for (size_t i = bars.size() - params.atr_period; i < bars.size(); ++i) {
+        double r = bars[i].close / bars[i - 1].close - 1.0;
+        m2 += (r - mean) * (r - mean);
+    }
+    double stdev = std::sqrt(m2 / (params.atr_period - 1));
+    if (std::fabs(sizing.get_volatility().get_return_stdev() - stdev) > 1e-12) {
+        std::cout << "Rolling stdev " << sizing.get_volatility().get_return_stdev() << " != " << stdev << std::endl;
+        return 1;
+    }
+    
+    // Risk amount covers a move of position_sizing_atr x ATR
+    PortfolioState fresh;
+    signal.price = bars.back().close;
+    double atr_size = sizing.calculate_position_size(signal, fresh, bars.back());
+    double expected = std::min(fresh.total_value * params.max_position_size /
+                                   (params.position_sizing_atr * sizing.get_volatility().get_atr()),
+                               fresh.total_value * 0.1 / signal.price);
+    std::cout << "ATR-sized position: " << atr_size << " shares (ATR "
+              << sizing.get_volatility().get_atr() << ")" << std::endl;
+    if (std::fabs(atr_size - expected) > 1e-9) {
+        std::cout << "ATR sizing gave " << atr_size << ", expected " << expected << std::endl;
+        return 1;
+    }
+    
+    // Daily loss limit: the day's opening value is taken at the first bar
+    // of each trading day, so a loss blocks entries until the next day
+    RiskManager daily;
+    daily.initialize(params);
+    PortfolioState book;
+    MarketData tick;
+    tick.close = 50.0;
+    tick.high = 50.5;
+    tick.low = 49.5;
+    tick.timestamp = "2023-03-01 09:30:00";
+    daily.update_market_data(tick, book);
+    book.total_value = 100000.0 * (1.0 - params.max_daily_loss - 0.01);
+    tick.timestamp = "2023-03-01 15:59:00";
+    daily.update_market_data(tick, book);
+    
+    TradingSignal entry;
+    entry.type = SignalType::BUY;
+    entry.price = 50.0;
+    TradingSignal exit = entry;
+    exit.type = SignalType::SELL;
+    if (daily.validate_trade(entry, book) || !daily.validate_trade(exit, book)) {
+        std::cout << "Daily loss limit should block entries but not exits" << std::endl;
+        return 1;
+    }
+    tick.timestamp = "2023-03-02 09:30:00";
+    daily.update_market_data(tick, book);
+    if (!daily.validate_trade(entry, book) || book.day_start_value != book.total_value) {
+        std::cout << "Daily loss limit did not reset on the next trading day" << std::endl;
+        return 1;
+    }
+    
+    // With a calendar, weekend and holiday bars join the next session: a
+    // bar on holiday Monday starts Tuesday's trading day, so Tuesday's
+    // first bar does not reset the loss again
+    SessionHours new_york;
+    new_york.utc_offset_minutes = -300;
+    new_york.open_minutes = 570;
+    new_york.close_minutes = 960;
+    SessionCalendar calendar(new_york);
+    calendar.add_holiday("2023-01-16");
+    RiskManager sessions;
+    sessions.initialize(params);
+    sessions.set_session_calendar(calendar);
+    PortfolioState account;
+    tick.timestamp = "2023-01-13 15:00:00";
+    sessions.update_market_data(tick, account);
+    tick.timestamp = "2023-01-16 15:00:00";
+    sessions.update_market_data(tick, account);
+    double holiday_open = account.day_start_value;
+    account.total_value = 100000.0 * (1.0 - params.max_daily_loss - 0.01);
+    tick.timestamp = "2023-01-17 15:00:00";
+    sessions.update_market_data(tick, account);
+    if (account.day_start_value != holiday_open || sessions.validate_trade(entry, account) ||
+        !sessions.get_session_calendar().covers(sessions.get_session_calendar().trading_day(1673967600))) {
+        std::cout << "Holiday bar did not join the next session" << std::endl;
+        return 1;
+    }
+    tick.timestamp = "2023-01-18 15:00:00";
+    sessions.update_market_data(tick, account);
+    if (account.day_start_value != account.total_value) {
+        std::cout << "Next session did not reset the daily loss" << std::endl;
+        return 1;
+    }
+    
     std::cout << "Risk Manager test completed!" << std::endl;
     return 0;
 }
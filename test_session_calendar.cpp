@@ -0,0 +1,100 @@
+#include <iostream>
+#include <cstdint>
+#include <string>
+#include "utils/session_calendar.h"
+#include "utils/time_utils.h"
+
+using namespace TradingBot;
+
+int64_t epoch_of(const std::string& text) {
+    int64_t epoch = 0;
+    TimeUtils::parse_timestamp(text, epoch);
+    return epoch;
+}
+
+int64_t day_of(const std::string& date) {
+    return epoch_of(date) / 86400;
+}
+
+// New York cash session in UTC-5, with a holiday
+bool test_exchange_hours() {
+    SessionHours hours;
+    hours.utc_offset_minutes = -5 * 60;
+    hours.open_minutes = 9 * 60 + 30;
+    hours.close_minutes = 16 * 60;
+    SessionCalendar calendar(hours);
+    calendar.add_holiday("2023-01-16");
+    calendar.build(epoch_of("2023-01-01"), epoch_of("2023-12-31"));
+
+    // 20:30 UTC is 15:30 local, still the same local date
+    if (calendar.trading_day(epoch_of("2023-01-13 20:30:00")) != day_of("2023-01-13") ||
+        !calendar.is_open(epoch_of("2023-01-13 20:30:00")) ||
+        calendar.is_open(epoch_of("2023-01-13 21:30:00")) ||
+        calendar.is_open(epoch_of("2023-01-16 15:00:00")) ||
+        calendar.is_open(epoch_of("2023-01-14 15:00:00"))) {
+        std::cout << "Exchange hours misplaced" << std::endl;
+        return false;
+    }
+
+    // 03:00 UTC on the 14th is still the 13th in New York
+    if (calendar.trading_day(epoch_of("2023-01-14 03:00:00")) != day_of("2023-01-13")) {
+        std::cout << "UTC offset ignored" << std::endl;
+        return false;
+    }
+
+    // Friday 13th, then the weekend and the holiday, then Tuesday 17th
+    int64_t friday = calendar.session_index(day_of("2023-01-13"));
+    if (calendar.session_index(day_of("2023-01-17")) != friday + 1 ||
+        calendar.is_trading_day(day_of("2023-01-16")) || !calendar.is_trading_day(day_of("2023-01-17"))) {
+        std::cout << "Weekend or holiday counted as a session" << std::endl;
+        return false;
+    }
+
+    // The table agrees with the direct count outside it
+    SessionCalendar unbuilt(hours);
+    unbuilt.add_holiday("2023-01-16");
+    for (int64_t day = day_of("2023-01-01"); day < day_of("2023-12-31"); ++day) {
+        if (unbuilt.session_index(day) != calendar.session_index(day) ||
+            unbuilt.is_trading_day(day) != calendar.is_trading_day(day)) {
+            std::cout << "Lookup table disagrees on " << TimeUtils::format_date(day * 86400) << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Futures-style session from 18:00 to 17:00: the evening belongs to the next day
+bool test_overnight_session() {
+    SessionHours hours;
+    hours.open_minutes = 18 * 60;
+    hours.close_minutes = 17 * 60;
+    SessionCalendar calendar(hours);
+
+    if (calendar.trading_day(epoch_of("2023-01-09 18:30:00")) != day_of("2023-01-10") ||
+        calendar.trading_day(epoch_of("2023-01-09 16:30:00")) != day_of("2023-01-09") ||
+        calendar.is_open(epoch_of("2023-01-09 17:30:00")) ||
+        !calendar.is_open(epoch_of("2023-01-09 18:30:00"))) {
+        std::cout << "Overnight session split at the wrong time" << std::endl;
+        return false;
+    }
+
+    int64_t begin = 0, end = 0;
+    calendar.day_bounds(epoch_of("2023-01-10 12:00:00"), begin, end);
+    if (begin != epoch_of("2023-01-09 18:00:00") || end != epoch_of("2023-01-10 18:00:00")) {
+        std::cout << "Day bounds " << TimeUtils::format_timestamp(begin) << " - "
+                  << TimeUtils::format_timestamp(end) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Session Calendar Test ===" << std::endl;
+
+    if (!test_exchange_hours() || !test_overnight_session()) {
+        return 1;
+    }
+
+    std::cout << "Session calendar test completed!" << std::endl;
+    return 0;
+}
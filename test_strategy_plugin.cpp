@@ -0,0 +1,64 @@
+#include "strategy/strategy_registry.h"
+
+// Example plugin: buys on the first bar and holds
+namespace {
+
+class BuyAndHoldStrategy : public TradingBot::Strategy {
+public:
+    BuyAndHoldStrategy() : Strategy("BUY_AND_HOLD"), quantity_(100.0) {}
+
+    bool initialize(const std::map<std::string, double>& params) override {
+        if (!validate_parameters(params)) {
+            return false;
+        }
+        quantity_ = params.at("quantity");
+        return true;
+    }
+
+    TradingBot::TradingSignal generate_signal(const TradingBot::MarketData& data,
+                                              const TradingBot::Position& current_position) override {
+        TradingBot::TradingSignal signal;
+        signal.price = data.close;
+        signal.timestamp = data.timestamp;
+        if (current_position.quantity <= 0.0) {
+            signal.type = TradingBot::SignalType::BUY;
+            signal.quantity = quantity_;
+            signal.reason = "Buy and hold";
+        }
+        return signal;
+    }
+
+    std::map<std::string, double> get_parameters() const override {
+        return {{"quantity", quantity_}};
+    }
+
+    bool validate_parameters(const std::map<std::string, double>& params) const override {
+        auto it = params.find("quantity");
+        return it != params.end() && it->second > 0.0;
+    }
+
+    std::unique_ptr<TradingBot::Strategy> clone() const override {
+        return std::unique_ptr<TradingBot::Strategy>(new BuyAndHoldStrategy(*this));
+    }
+
+private:
+    double quantity_;
+};
+
+} // namespace
+
+extern "C" int tradingbot_strategy_plugin_version() {
+    return TradingBot::STRATEGY_PLUGIN_API_VERSION;
+}
+
+extern "C" bool tradingbot_register_strategies(TradingBot::StrategyRegistry& registry) {
+    TradingBot::StrategyInfo info;
+    info.name = "BUY_AND_HOLD";
+    info.description = "Buy on the first bar and hold";
+    info.parameters = {
+        TradingBot::ParameterSpec("quantity", TradingBot::ParameterType::REAL, 1.0, 10000.0, 100.0, 0.0, "Shares bought"),
+    };
+    info.create = [] { return std::unique_ptr<TradingBot::Strategy>(new BuyAndHoldStrategy()); };
+    std::string error;
+    return registry.register_strategy(info, error);
+}
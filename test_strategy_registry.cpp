@@ -0,0 +1,94 @@
+#include <iostream>
+#include <string>
+#include "strategy/strategy_registry.h"
+
+using namespace TradingBot;
+
+// Built-ins are found by name or alias and accept their own defaults
+bool test_builtins() {
+    StrategyRegistry& registry = StrategyRegistry::instance();
+    for (const auto& name : registry.get_names()) {
+        const StrategyInfo* info = registry.find(name);
+        auto strategy = registry.create(name);
+        if (!info || !strategy || !strategy->initialize(registry.get_default_parameters(name)) ||
+            !strategy->validate_parameters(registry.get_default_parameters(name))) {
+            std::cout << name << " does not accept its default parameters" << std::endl;
+            return false;
+        }
+        std::cout << "  " << name << ": " << info->parameters.size() << " parameters" << std::endl;
+    }
+
+    if (registry.find("SMA") != registry.find("SMA_CROSSOVER") || registry.find("RSI_STRATEGY") == nullptr ||
+        registry.create("NOPE") != nullptr) {
+        std::cout << "Alias lookup failed" << std::endl;
+        return false;
+    }
+
+    // RSI is configured with the parameter names it reads
+    std::map<std::string, double> params;
+    std::string error;
+    if (!registry.resolve_parameters("RSI", {{"period", 10.0}}, params, error) || params.at("period") != 10.0 ||
+        params.at("overbought_threshold") != 70.0) {
+        std::cout << "RSI parameters not resolved: " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_schema_checks() {
+    StrategyRegistry& registry = StrategyRegistry::instance();
+    std::map<std::string, double> params;
+    std::string error;
+    if (registry.resolve_parameters("SMA", {{"short_period", 2.5}}, params, error) ||
+        error.find("short_period") == std::string::npos ||
+        registry.resolve_parameters("SMA", {{"long_period", 1000.0}}, params, error) ||
+        registry.resolve_parameters("EMA", {{"rsi_period", 14.0}}, params, error) ||
+        error.find("no parameter rsi_period") == std::string::npos) {
+        std::cout << "Out-of-schema parameter accepted (" << error << ")" << std::endl;
+        return false;
+    }
+
+    StrategyInfo duplicate;
+    duplicate.name = "SMA";
+    duplicate.create = [] { return std::unique_ptr<Strategy>(new SMACrossoverStrategy()); };
+    if (registry.register_strategy(duplicate, error)) {
+        std::cout << "Duplicate strategy name accepted" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_plugin() {
+    StrategyRegistry& registry = StrategyRegistry::instance();
+    std::string error;
+    if (registry.load_plugin("no_such_plugin.so", error)) {
+        std::cout << "Missing plugin reported as loaded" << std::endl;
+        return false;
+    }
+    if (!registry.load_plugin(STRATEGY_PLUGIN_PATH, error)) {
+        std::cout << "Plugin failed to load: " << error << std::endl;
+        return false;
+    }
+
+    auto strategy = registry.create("BUY_AND_HOLD");
+    MarketData bar;
+    bar.close = 50.0;
+    if (!strategy || !strategy->initialize(registry.get_default_parameters("BUY_AND_HOLD")) ||
+        strategy->generate_signal(bar, Position()).type != SignalType::BUY) {
+        std::cout << "Plugin strategy does not trade" << std::endl;
+        return false;
+    }
+    std::cout << "  Plugin registered " << strategy->get_name() << std::endl;
+    return true;
+}
+
+int main() {
+    std::cout << "=== Strategy Registry Test ===" << std::endl;
+
+    if (!test_builtins() || !test_schema_checks() || !test_plugin()) {
+        return 1;
+    }
+
+    std::cout << "Strategy registry test completed!" << std::endl;
+    return 0;
+}
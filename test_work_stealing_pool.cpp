@@ -0,0 +1,217 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "utils/work_stealing_pool.h"
+#include "utils/thread_utils.h"
+
+using namespace TradingBot;
+
+bool test_pool() {
+    std::atomic<int> done(0);
+    {
+        WorkStealingPool pool(4);
+
+        // Uneven fan-out from inside tasks
+        for (int i = 0; i < 8; ++i) {
+            pool.submit([&pool, &done, i]() {
+                for (int j = 0; j < i * 10; ++j) {
+                    pool.submit([&done]() { done.fetch_add(1); });
+                }
+                done.fetch_add(1);
+            });
+        }
+        pool.wait_idle();
+        if (done.load() != 8 + 280) {
+            std::cout << "Pool ran " << done.load() << " tasks" << std::endl;
+            return false;
+        }
+
+        pool.submit([]() { throw std::runtime_error("task failed"); });
+        try {
+            pool.wait_idle();
+            std::cout << "Task exception was not rethrown" << std::endl;
+            return false;
+        } catch (const std::runtime_error&) {
+        }
+
+        // Still usable afterwards; the destructor drains queued work
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&done]() { done.fetch_add(1); });
+        }
+    }
+    if (done.load() != 388) {
+        std::cout << "Destructor left tasks unfinished" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Recursive sum where every level waits on a group of its own
+long long tree_sum(WorkStealingPool& pool, int begin, int end) {
+    if (end - begin <= 64) {
+        long long sum = 0;
+        for (int i = begin; i < end; ++i) {
+            sum += i;
+        }
+        return sum;
+    }
+    int middle = begin + (end - begin) / 2;
+    long long left = 0;
+    TaskGroup group(pool);
+    group.run([&]() { left = tree_sum(pool, begin, middle); });
+    long long right = tree_sum(pool, middle, end);
+    group.wait();
+    return left + right;
+}
+
+bool test_task_groups() {
+    WorkStealingPool pool(3);
+
+    // Nested waits on a small pool must not deadlock
+    long long sum = tree_sum(pool, 0, 100000);
+    if (sum != 100000LL * 99999 / 2) {
+        std::cout << "Nested groups summed to " << sum << std::endl;
+        return false;
+    }
+
+    // Groups are independent: waiting on one does not wait for the other
+    std::atomic<bool> release(false);
+    TaskGroup slow(pool);
+    slow.run([&release]() {
+        while (!release.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    std::atomic<int> quick_done(0);
+    TaskGroup quick(pool);
+    for (int i = 0; i < 20; ++i) {
+        quick.run([&quick_done]() { quick_done.fetch_add(1); });
+    }
+    quick.wait();
+    release = true;
+    slow.wait();
+    if (quick_done.load() != 20) {
+        std::cout << "Quick group finished " << quick_done.load() << " tasks" << std::endl;
+        return false;
+    }
+
+    // Cancel skips tasks that have not started
+    std::atomic<int> ran(0);
+    TaskGroup cancelled(pool);
+    cancelled.cancel();
+    for (int i = 0; i < 50; ++i) {
+        cancelled.run([&ran]() { ran.fetch_add(1); });
+    }
+    cancelled.wait();
+    if (ran.load() != 0 || !cancelled.is_cancelled()) {
+        std::cout << "Cancelled group ran " << ran.load() << " tasks" << std::endl;
+        return false;
+    }
+
+    // The first failure cancels the rest and is rethrown by wait()
+    TaskGroup failing(pool);
+    std::atomic<int> after(0);
+    failing.run([]() { throw std::runtime_error("bad input"); });
+    try {
+        failing.wait();
+        std::cout << "Group exception was not rethrown" << std::endl;
+        return false;
+    } catch (const std::runtime_error&) {
+    }
+    failing.run([&after]() { after.fetch_add(1); });
+    failing.wait();
+    if (after.load() != 0) {
+        std::cout << "Failed group kept running tasks" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool test_parallel_for() {
+    WorkStealingPool pool(4);
+    std::vector<int> squares(10000, 0);
+    parallel_for(pool, squares.size(), 0, [&](size_t i) { squares[i] = static_cast<int>(i * i % 1000); });
+    for (size_t i = 0; i < squares.size(); ++i) {
+        if (squares[i] != static_cast<int>(i * i % 1000)) {
+            std::cout << "parallel_for missed index " << i << std::endl;
+            return false;
+        }
+    }
+
+    // At most max_tasks bodies at once
+    std::atomic<int> running(0), peak(0);
+    parallel_for(pool, 200, 2, [&](size_t) {
+        int now = running.fetch_add(1) + 1;
+        int seen = peak.load();
+        while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        running.fetch_sub(1);
+    });
+    if (peak.load() > 2) {
+        std::cout << "parallel_for ran " << peak.load() << " bodies at once" << std::endl;
+        return false;
+    }
+
+    try {
+        parallel_for(pool, 1000, 0, [](size_t i) {
+            if (i == 500) {
+                throw std::invalid_argument("index 500");
+            }
+        });
+        std::cout << "parallel_for swallowed an exception" << std::endl;
+        return false;
+    } catch (const std::invalid_argument&) {
+    }
+    return true;
+}
+
+bool test_placement() {
+    size_t cores = 0;
+    for (const auto& node : numa_cpu_nodes()) {
+        cores += node.size();
+    }
+
+    SchedulerOptions options;
+    options.num_threads = 2;
+    options.pin_threads = true;
+    WorkStealingPool pool(options);
+
+    std::atomic<int> done(0);
+    for (int i = 0; i < 10; ++i) {
+        pool.submit([&done]() { done.fetch_add(1); });
+    }
+    pool.wait_idle();
+
+    // Pinning is best effort (containers may refuse it) but never exceeds the workers
+    std::cout << "  " << cores << " cores on " << numa_cpu_nodes().size() << " NUMA node(s); "
+              << pool.get_pinned_count() << " of " << pool.get_thread_count() << " workers pinned across "
+              << pool.get_node_count() << " node(s)" << std::endl;
+    if (cores == 0 || done.load() != 10 || pool.get_pinned_count() > 2 || pool.get_node_count() < 1) {
+        return false;
+    }
+
+    // The shared scheduler takes options only before it starts
+    SchedulerOptions shared;
+    shared.num_threads = 3;
+    if (!WorkStealingPool::configure_shared(shared) || WorkStealingPool::shared().get_thread_count() != 3 ||
+        WorkStealingPool::configure_shared(shared)) {
+        std::cout << "Shared scheduler ignored its configuration" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Work-Stealing Scheduler Test ===" << std::endl;
+
+    if (!test_pool() || !test_task_groups() || !test_parallel_for() || !test_placement()) {
+        return 1;
+    }
+
+    std::cout << "Work-stealing scheduler test completed!" << std::endl;
+    return 0;
+}